@@ -28,5 +28,7 @@ int main () {
                 result += fusion::at_c<<%= n %>>(values);
             <% } %>
         }
+
+        boost::hana::benchmark::do_not_optimize(result);
     });
 }
@@ -23,5 +23,7 @@ int main () {
                 result += hana::at(values, hana::size_t<<%= n %>>);
             <% } %>
         }
+
+        hana::benchmark::do_not_optimize(result);
     });
 }
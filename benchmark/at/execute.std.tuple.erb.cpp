@@ -21,5 +21,7 @@ int main () {
                 result += std::get<<%= n %>>(values);
             <% } %>
         }
+
+        boost::hana::benchmark::do_not_optimize(result);
     });
 }
@@ -23,6 +23,48 @@ Distributed under the Boost Software License, Version 1.0.
       };
     }
 
+    // Compilation benchmarks may record the peak memory used by the
+    // compiler and the number of template instantiations and constant
+    // evaluations it performed along with each compilation time. These
+    // statistics are plotted as additional series on secondary axes.
+    var statistics = [
+      { key: 'memory', name: 'peak memory', axis: 1, suffix: 'MB', visible: true },
+      { key: 'instantiations', name: 'instantiations', axis: 2, suffix: '', visible: false },
+      { key: 'evaluations', name: 'constant evaluations', axis: 2, suffix: '', visible: false }
+    ];
+    var extraSeries = [];
+    options.series.forEach(function(series) {
+      statistics.forEach(function(stat) {
+        var points = (series.data || []).filter(function(point) {
+          return point != null && point[stat.key] != undefined;
+        });
+        if (points.length == 0)
+          return;
+
+        extraSeries.push({
+          name: series.name + ' (' + stat.name + ')',
+          data: points.map(function(point) { return [point.x, point[stat.key]]; }),
+          yAxis: stat.axis,
+          dashStyle: 'ShortDash',
+          visible: stat.visible,
+          tooltip: { valueSuffix: stat.suffix }
+        });
+      });
+    });
+
+    if (extraSeries.length > 0) {
+      options.yAxis = [options.yAxis, {
+        title: { text: "Peak memory (MB)" },
+        floor: 0,
+        opposite: true
+      }, {
+        title: { text: "Count" },
+        floor: 0,
+        opposite: true
+      }];
+      options.series = options.series.concat(extraSeries);
+    }
+
     if (options.subtitle == undefined) {
       options.subtitle = { text: "(smaller is better)" };
     }
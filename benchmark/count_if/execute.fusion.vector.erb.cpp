@@ -27,5 +27,7 @@ int main () {
                 return i % 2 == 0;
             });
         }
+
+        boost::hana::benchmark::do_not_optimize(result);
     });
 }
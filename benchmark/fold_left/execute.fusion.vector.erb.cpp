@@ -28,5 +28,7 @@ int main () {
                 return state + t;
             });
         }
+
+        boost::hana::benchmark::do_not_optimize(result);
     });
 }
@@ -20,5 +20,7 @@ int main () {
 
             result += std::accumulate(values.begin(), values.end(), 0);
         }
+
+        boost::hana::benchmark::do_not_optimize(result);
     });
 }
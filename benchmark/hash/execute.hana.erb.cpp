@@ -0,0 +1,46 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/ext/std/hash.hpp>
+#include <boost/hana/hashable.hpp>
+#include <boost/hana/struct_macros.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <string>
+
+
+struct Record {
+    BOOST_HANA_DEFINE_STRUCT(Record,
+        (int, id),
+        (int, x),
+        (int, y),
+        (int, z),
+        (std::string, name)
+    );
+};
+
+Record make_record(int i) {
+    return {i, i + 1, i + 2, i + 3, "record"};
+}
+
+
+int main () {
+    auto records = boost::hana::make_tuple(
+        <%= input_size.times.map { 'make_record(std::rand())' }.join(', ') %>
+    );
+
+    boost::hana::benchmark::measure([&] {
+        std::size_t result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            result += boost::hana::hash(records);
+        }
+
+        boost::hana::benchmark::do_not_optimize(result);
+    });
+}
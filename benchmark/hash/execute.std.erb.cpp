@@ -0,0 +1,68 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/struct_macros.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <string>
+
+
+struct Record {
+    BOOST_HANA_DEFINE_STRUCT(Record,
+        (int, id),
+        (int, x),
+        (int, y),
+        (int, z),
+        (std::string, name)
+    );
+};
+
+Record make_record(int i) {
+    return {i, i + 1, i + 2, i + 3, "record"};
+}
+
+// This is the kind of hash function that has to be written by hand for
+// every key type when using std::hash.
+inline void hash_combine(std::size_t& seed, std::size_t h) {
+    seed ^= h + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+namespace std {
+    template <>
+    struct hash<Record> {
+        std::size_t operator()(Record const& r) const {
+            std::size_t seed = 0;
+            hash_combine(seed, std::hash<int>{}(r.id));
+            hash_combine(seed, std::hash<int>{}(r.x));
+            hash_combine(seed, std::hash<int>{}(r.y));
+            hash_combine(seed, std::hash<int>{}(r.z));
+            hash_combine(seed, std::hash<std::string>{}(r.name));
+            return seed;
+        }
+    };
+}
+
+
+int main () {
+    auto records = boost::hana::make_tuple(
+        <%= input_size.times.map { 'make_record(std::rand())' }.join(', ') %>
+    );
+
+    boost::hana::benchmark::measure([&] {
+        std::size_t result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            boost::hana::for_each(records, [&](Record const& r) {
+                hash_combine(result, std::hash<Record>{}(r));
+            });
+        }
+
+        boost::hana::benchmark::do_not_optimize(result);
+    });
+}
@@ -0,0 +1,52 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/experimental/json.hpp>
+#include <boost/hana/struct_macros.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <string>
+
+
+struct Car {
+    BOOST_HANA_DEFINE_STRUCT(Car,
+        (std::string, brand),
+        (std::string, model)
+    );
+};
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (std::string, last_name),
+        (int, age),
+        (double, height),
+        (Car, car)
+    );
+};
+
+Person make_person(int i) {
+    return {"John", "Doe", i, 1.75 + i, {"BMW", "Z3"}};
+}
+
+
+int main () {
+    auto people = boost::hana::make_tuple(
+        <%= input_size.times.map { 'make_person(std::rand())' }.join(', ') %>
+    );
+
+    boost::hana::benchmark::measure([&] {
+        std::size_t result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            result += boost::hana::experimental::to_json(people).size();
+        }
+
+        boost::hana::benchmark::do_not_optimize(result);
+    });
+}
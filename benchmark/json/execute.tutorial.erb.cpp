@@ -0,0 +1,92 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana.hpp>
+#include <boost/hana/struct_macros.hpp>
+
+#include "measure.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <string>
+#include <type_traits>
+#include <utility>
+using namespace boost::hana;
+
+
+struct Car {
+    BOOST_HANA_DEFINE_STRUCT(Car,
+        (std::string, brand),
+        (std::string, model)
+    );
+};
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (std::string, last_name),
+        (int, age),
+        (double, height),
+        (Car, car)
+    );
+};
+
+Person make_person(int i) {
+    return {"John", "Doe", i, 1.75 + i, {"BMW", "Z3"}};
+}
+
+
+// This is the implementation from example/tutorial/introspection.json.cpp.
+template <typename Xs>
+std::string join(Xs&& xs, std::string sep) {
+    return fold(intersperse(std::forward<Xs>(xs), sep), "", _ + _);
+}
+
+std::string quote(std::string s) { return "\"" + s + "\""; }
+
+template <typename T>
+auto to_json(T const& x) -> decltype(std::to_string(x)) {
+    return std::to_string(x);
+}
+
+std::string to_json(char c) { return quote({c}); }
+std::string to_json(std::string s) { return quote(s); }
+
+template <typename T>
+    std::enable_if_t<models<Struct, T>(),
+std::string> to_json(T const& x) {
+    auto json = transform(keys(x), [&](auto name) {
+        auto const& member = at_key(x, name);
+        return quote(to<char const*>(name)) + " : " + to_json(member);
+    });
+
+    return "{" + join(std::move(json), ", ") + "}";
+}
+
+template <typename Xs>
+    std::enable_if_t<models<Sequence, Xs>(),
+std::string> to_json(Xs const& xs) {
+    auto json = transform(xs, [](auto const& x) {
+        return to_json(x);
+    });
+
+    return "[" + join(std::move(json), ", ") + "]";
+}
+
+
+int main () {
+    auto people = make_tuple(
+        <%= input_size.times.map { 'make_person(std::rand())' }.join(', ') %>
+    );
+
+    boost::hana::benchmark::measure([&] {
+        std::size_t result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            result += to_json(people).size();
+        }
+
+        boost::hana::benchmark::do_not_optimize(result);
+    });
+}
@@ -7,35 +7,192 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_BENCHMARK_MEASURE_HPP
 #define BOOST_HANA_BENCHMARK_MEASURE_HPP
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
 #include <iostream>
-#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#   include <cstring>
+#   include <linux/perf_event.h>
+#   include <sys/ioctl.h>
+#   include <sys/syscall.h>
+#   include <unistd.h>
+#endif
 
 
 namespace boost { namespace hana { namespace benchmark {
+    // Makes the compiler believe that `x` is read and may be modified, so
+    // that computing it can't be optimized away. Every benchmark should
+    // pass the result of the work it measures to this function.
+    template <typename T>
+    inline void do_not_optimize(T const& x) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(x) : "memory");
+#else
+        static char const volatile* sink;
+        sink = reinterpret_cast<char const volatile*>(&x);
+        (void)sink;
+#endif
+    }
+
+    // An object whose copies can't be elided by the optimizer, to measure
+    // how many copies an algorithm makes.
     template <int i>
     struct object {
         constexpr object() = default;
 
-        object(object const&) {
-            std::this_thread::sleep_for(std::chrono::nanoseconds(1));
+        object(object const& other) : value{other.value} {
+            do_not_optimize(value);
         }
+
+        int value = i;
     };
 
-    auto measure = [](auto f) {
-        constexpr auto repetitions = 500ull;
-        auto start = std::chrono::steady_clock::now();
-        for (auto i = repetitions; i > 0; --i) {
+    namespace measure_detail {
+        using clock = std::chrono::steady_clock;
+        using seconds = std::chrono::duration<double>;
+
+        // Time spent running the function before any sample is taken.
+        constexpr auto warmup = seconds{0.05};
+
+        // The function is called repeatedly for each sample, so that
+        // every sample lasts at least this long.
+        constexpr auto sample_duration = seconds{0.001};
+
+        // Samples are taken until this much time was spent, while taking
+        // at least `min_samples` and at most `max_samples` samples.
+        constexpr auto budget = seconds{0.5};
+        constexpr std::size_t min_samples = 10;
+        constexpr std::size_t max_samples = 1000;
+
+        // Counts the CPU cycles spent by the current thread in user mode,
+        // when the hardware counters are available through perf_event_open.
+        struct cycle_counter {
+#if defined(__linux__)
+            cycle_counter() {
+                perf_event_attr attr;
+                std::memset(&attr, 0, sizeof attr);
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.size = sizeof attr;
+                attr.config = PERF_COUNT_HW_CPU_CYCLES;
+                attr.disabled = 1;
+                attr.exclude_kernel = 1;
+                attr.exclude_hv = 1;
+                fd_ = static_cast<int>(::syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+            }
+
+            ~cycle_counter() { if (fd_ != -1) ::close(fd_); }
+
+            bool available() const { return fd_ != -1; }
+
+            void start() {
+                ::ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+                ::ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+            }
+
+            double stop() {
+                ::ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+                long long count;
+                if (::read(fd_, &count, sizeof count) != sizeof count)
+                    return -1;
+                return static_cast<double>(count);
+            }
+
+        private:
+            int fd_;
+#else
+            cycle_counter() = default;
+            bool available() const { return false; }
+            void start() { }
+            double stop() { return -1; }
+#endif
+            cycle_counter(cycle_counter const&) = delete;
+            cycle_counter& operator=(cycle_counter const&) = delete;
+        };
+
+        // Returns the value below which lie `p` percent of the sorted
+        // values, using the nearest-rank method.
+        inline double percentile(std::vector<double> const& sorted, double p) {
+            auto rank = static_cast<std::size_t>(std::ceil(p / 100 * sorted.size()));
+            return sorted[rank == 0 ? 0 : rank - 1];
+        }
+
+        inline double median(std::vector<double> values) {
+            std::sort(values.begin(), values.end());
+            auto n = values.size();
+            return n % 2 ? values[n / 2] : (values[n / 2 - 1] + values[n / 2]) / 2;
+        }
+
+        // Median absolute deviation from the median.
+        inline double mad(std::vector<double> const& values, double median) {
+            std::vector<double> deviations;
+            for (double x : values)
+                deviations.push_back(std::abs(x - median));
+            return measure_detail::median(deviations);
+        }
+    }
+
+    // Measures the time taken by a call to `f()`, and prints statistics in
+    // the format expected by the measure.rb script.
+    //
+    // `f` is first run for a short while to warm up the caches and the
+    // branch predictors, which also tells how many calls are needed for
+    // a sample to be long enough to be timed accurately. Then, samples are
+    // taken until the time budget is exhausted. The median time per call
+    // is reported as the execution time, along with the 95th percentile
+    // and the median absolute deviation. When the hardware counters can
+    // be used, the median number of CPU cycles per call is also reported.
+    template <typename F>
+    void measure(F f) {
+        using namespace measure_detail;
+
+        std::size_t warmup_calls = 0;
+        auto start = clock::now();
+        do {
             f();
+            ++warmup_calls;
+        } while (clock::now() - start < warmup);
+        auto per_call = seconds{clock::now() - start} / static_cast<double>(warmup_calls);
+
+        auto batch = static_cast<std::size_t>(std::ceil(sample_duration / per_call));
+        batch = std::max<std::size_t>(batch, 1);
+
+        cycle_counter cycles;
+        std::vector<double> times, cycle_counts;
+        start = clock::now();
+        while (times.size() < max_samples &&
+               (times.size() < min_samples || clock::now() - start < budget))
+        {
+            if (cycles.available())
+                cycles.start();
+            auto sample_start = clock::now();
+            for (auto i = batch; i > 0; --i)
+                f();
+            auto sample_stop = clock::now();
+            if (cycles.available()) {
+                double count = cycles.stop();
+                if (count >= 0)
+                    cycle_counts.push_back(count / batch);
+            }
+
+            times.push_back(seconds{sample_stop - sample_start}.count() / batch);
         }
-        auto stop = std::chrono::steady_clock::now();
 
-        auto time = std::chrono::duration_cast<std::chrono::duration<float>>(
-            (stop - start) / repetitions
-        );
-        std::cout << std::fixed;
-        std::cout << "[execution time: " << time.count() << "]" << std::endl;
-    };
+        std::sort(times.begin(), times.end());
+        double time = median(times);
+
+        std::cout << std::fixed << std::setprecision(9);
+        std::cout << "[execution time: " << time << "]" << std::endl;
+        std::cout << "[execution time p95: " << percentile(times, 95) << "]" << std::endl;
+        std::cout << "[execution time mad: " << mad(times, time) << "]" << std::endl;
+        std::cout << "[samples: " << times.size() << " x " << batch << " calls]" << std::endl;
+        if (!cycle_counts.empty() && cycle_counts.size() == times.size())
+            std::cout << "[cycles: " << median(cycle_counts) << "]" << std::endl;
+    }
 }}}
 
 #endif
@@ -7,7 +7,9 @@
 #
 # When called as a program, this script runs the command line given in
 # arguments and returns the total time. This is similar to the `time`
-# command from Bash.
+# command from Bash. It also returns the peak memory used by the command
+# and, when the compiler supports it, the number of template instantiations
+# and constant evaluations performed while compiling.
 #
 # This file can also be required as a Ruby module to gain access to the
 # methods defined below.
@@ -16,10 +18,15 @@
 # This file must not be used as-is. It must be processed by CMake first.
 
 require 'benchmark'
+require 'etc'
+require 'json'
 require 'open3'
 require 'pathname'
+require 'rbconfig'
 require 'ruby-progressbar'
+require 'shellwords'
 require 'tilt'
+require 'tmpdir'
 
 
 def split_at(n, list)
@@ -79,9 +86,141 @@ def cmake_bool(b)
   return false # otherwise
 end
 
+# Returns the peak resident set size, in kilobytes, of the child processes
+# of the current process that have terminated and been waited for. Returns
+# nil if this information can't be obtained on the current platform.
+def children_peak_memory
+  require 'fiddle'
+  getrusage = Fiddle::Function.new(Fiddle::Handle::DEFAULT['getrusage'],
+                                   [Fiddle::TYPE_INT, Fiddle::TYPE_VOIDP],
+                                   Fiddle::TYPE_INT)
+  rusage_children = -1
+  usage = "\0".b * 256 # larger than any `struct rusage`
+  return nil if getrusage.call(rusage_children, usage) != 0
+
+  # `ru_maxrss` comes right after `ru_utime` and `ru_stime`, which are two
+  # `struct timeval`s made of two longs (or a long and a padded int).
+  timeval = 2 * Fiddle::SIZEOF_LONG
+  maxrss = usage[2 * timeval, Fiddle::SIZEOF_LONG].unpack1('l!')
+
+  # `ru_maxrss` is in bytes on OS X and in kilobytes elsewhere.
+  RUBY_PLATFORM =~ /darwin/ ? maxrss / 1024 : maxrss
+rescue LoadError, Fiddle::DLError
+  nil
+end
+
+# Whether the compiler can report what it instantiated with `-ftime-trace`.
+# This requires Clang 9 or later, which is Apple Clang 12 or later. With
+# other compilers, the instantiation counts are simply not recorded.
+def compiler_has_time_trace
+  minimum = { "Clang" => "9", "AppleClang" => "12" }["@CMAKE_CXX_COMPILER_ID@"]
+  version = "@CMAKE_CXX_COMPILER_VERSION@"
+  return false if minimum.nil? or not Gem::Version.correct?(version)
+  Gem::Version.new(version) >= Gem::Version.new(minimum)
+end
+
+# Recompiles with `-ftime-trace` the file compiled by the given compiler
+# command line, and returns the number of templates instantiated and the
+# number of constant expressions evaluated by the compiler.
+#
+# The trace has to record every event to be exhaustive, which makes the
+# compilation noticeably slower. Hence, it is never done during the
+# compilation that is timed.
+def compilation_statistics(args)
+  return nil if not args.include?("-o")
+  output = args[args.index("-o") + 1]
+  trace = File.join(File.dirname(output), File.basename(output, ".*") + ".json")
+  return nil if not system(*args, "-ftime-trace", "-ftime-trace-granularity=0",
+                          out: File::NULL, err: File::NULL)
+  return nil if not File.exist?(trace)
+
+  events = JSON.parse(File.read(trace))["traceEvents"].map { |e| e["name"] }
+  {
+    instantiations: events.count { |e| ["InstantiateClass", "InstantiateFunction"].include?(e) },
+    evaluations: events.count { |e| e.to_s.start_with?("EvaluateAs") }
+  }
+rescue JSON::ParserError, NoMethodError
+  nil
+ensure
+  File.delete(trace) if trace and File.exist?(trace)
+end
+
+# Converts the flags exported by CMake in `input`, which contains one
+# `key=value` per line, to a JSON file at `output`. The `option`,
+# `definition` and `include` keys may appear several times, and their
+# values are gathered in lists.
+def export_flags(input, output)
+  lists = { "option" => "options", "definition" => "definitions",
+            "include" => "includes" }
+  exported = { "options" => [], "definitions" => [], "includes" => [] }
+  File.readlines(input, chomp: true).each { |line|
+    key, value = line.split("=", 2)
+    next if key.nil? or value.nil?
+    if lists.key?(key)
+      exported[lists[key]] << value
+    else
+      exported[key] = value
+    end
+  }
+  File.write(output, JSON.generate(exported))
+end
+
+# Returns the command lines used to compile a benchmark and to link it, as
+# arrays of arguments, using the compiler and the flags exported by CMake.
+def build_commands
+  exported = JSON.parse(File.read("@CMAKE_CURRENT_BINARY_DIR@/measure.flags.json"))
+  present = -> (list) { list.reject(&:empty?) }
+  flags = exported["flags"].shellsplit +
+          present[exported["options"]] +
+          present[exported["definitions"]].map { |d| "-D#{d}" } +
+          present[exported["includes"]].map { |i| "-I#{i}" }
+  compile = -> (source, object) {
+    [exported["compiler"], *flags, "-c", source.to_s, "-o", object.to_s]
+  }
+  link = -> (object, executable) {
+    [exported["compiler"], *flags, object.to_s, "-o", executable.to_s,
+     *exported["link"].shellsplit]
+  }
+  return compile, link
+end
+
+# Number of data points that are compiled concurrently. By default, the data
+# points are compiled one after the other, because compilations running at
+# the same time slow each other down and make the measured compilation times
+# noisy. Compiling several data points at once can be requested by setting
+# the `benchmark.jobs` environment variable to the number of jobs, or to
+# `auto` to use one job per processor.
+def benchmark_jobs
+  jobs = ENV["benchmark.jobs"]
+  return Etc.nprocessors if jobs == "auto"
+  [jobs.to_i, 1].max
+end
+
+# Returns the command prefix pinning a process to the given processor when
+# the `benchmark.pin` environment variable is set, and an empty prefix
+# otherwise. Pinning requires the `taskset` utility.
+def pin_to(processor)
+  return [] if not cmake_bool(ENV["benchmark.pin"] || "false")
+  @has_taskset = system("taskset", "-p", Process.pid.to_s, out: File::NULL,
+                                                          err: File::NULL) if @has_taskset.nil?
+  @has_taskset ? ["taskset", "-c", (processor % Etc.nprocessors).to_s] : []
+end
+
 # aspect must be one of :compilation_time, :bloat, :execution_time
+#
+# For :compilation_time, each data point is a hash containing the size of
+# the input (x), the compilation time in seconds (y), the peak memory used
+# by the compiler in megabytes (memory) and, when the compiler supports it,
+# the number of template instantiations (instantiations) and of constant
+# evaluations (evaluations). For the other aspects, each data point is an
+# array containing the size of the input and the measured statistic.
+#
+# Each data point is written to its own file in a scratch directory, and
+# up to `benchmark_jobs` of them are compiled at the same time (only one by
+# default). Programs are only run once everything was compiled, one at a
+# time, so execution times are never measured while the compiler is running. The data points
+# are returned in the order of the range, whatever order they complete in.
 def measure(aspect, template_relative, range)
-  measure_file = Pathname.new("@CMAKE_CURRENT_SOURCE_DIR@/measure.cpp")
   template = Pathname.new(template_relative).expand_path
   range = range.to_a
 
@@ -89,43 +228,80 @@ def measure(aspect, template_relative, range)
     range = [range[0], range[-1]]
   end
 
-  make = -> (target) {
-    command = "@CMAKE_COMMAND@ --build @CMAKE_BINARY_DIR@ --target #{target}"
-    stdout, stderr, status = Open3.capture3(command)
-  }
+  compile, link = build_commands
+  launcher = [RbConfig.ruby, "@CMAKE_CURRENT_BINARY_DIR@/measure.rb"]
 
   progress = ProgressBar.create(format: '%p%% %t | %B |',
                                 title: template_relative,
-                                total: range.size,
+                                total: range.size * (aspect == :execution_time ? 2 : 1),
                                 output: STDERR)
-  range.map do |n|
-    # Evaluate the ERB template with the given environment, and save
-    # the result in the `measure.cpp` file.
+  progress_lock = Mutex.new
+  scratch = Pathname.new(Dir.mktmpdir("measure", "@CMAKE_CURRENT_BINARY_DIR@"))
+
+  # Evaluate the ERB template for each input size, and compile the result.
+  # The timing statistics are output to stdout by the measure.rb launcher.
+  build = -> (n, worker) {
     code = Tilt::ERBTemplate.new(template).render(nil, input_size: n)
-    measure_file.write(code)
+    source = scratch + "#{n}.cpp"
+    object = scratch + "#{n}.o"
+    executable = scratch + "#{n}"
+    source.write(code)
 
-    # Compile the file and get timing statistics. The timing statistics
-    # are output to stdout when we compile the file because of the way
-    # the `compile.benchmark.measure` CMake target is setup.
-    stdout, stderr, status = make["compile.benchmark.measure"]
+    stdout, stderr, status = Open3.capture3(*pin_to(worker), *launcher,
+                                            *compile[source, object])
     raise "compilation error: #{stderr}\n\n#{code}" if not status.success?
     ctime = stdout.match(/\[compilation time: (.+)\]/i)
-    # Size of the generated executable in KB
-    size = File.size("@CMAKE_CURRENT_BINARY_DIR@/compile.benchmark.measure").to_f / 1000
-
-    # If we didn't match anything, that's because we went too fast, CMake
-    # did not have the time to see the changes to the measure file and
-    # the target was not rebuilt. So we sleep for a bit and then retry
-    # this iteration.
-    (sleep 0.2; redo) if ctime.nil?
-    stat = ctime.captures[0].to_f if aspect == :compilation_time
-    stat = size if aspect == :bloat
-
-    # Run the resulting program and get timing statistics. The statistics
-    # should be written to stdout by the `measure` function of the
-    # `measure.hpp` header.
-    if aspect == :execution_time
-      stdout, stderr, status = make["run.benchmark.measure"]
+
+    if aspect != :compilation_time
+      stdout, stderr, status = Open3.capture3(*link[object, executable])
+      raise "link error: #{stderr}\n\n#{code}" if not status.success?
+    end
+
+    if aspect == :compilation_time
+      memory = stdout.match(/\[peak memory: (.+)\]/i)
+      instantiations = stdout.match(/\[template instantiations: (.+)\]/i)
+      evaluations = stdout.match(/\[constant evaluations: (.+)\]/i)
+
+      stat = { x: n, y: ctime.captures[0].to_f }
+      stat[:memory] = memory.captures[0].to_f / 1024 if memory
+      stat[:instantiations] = instantiations.captures[0].to_i if instantiations
+      stat[:evaluations] = evaluations.captures[0].to_i if evaluations
+    elsif aspect == :bloat
+      # Size of the generated executable in KB
+      stat = [n, File.size(executable).to_f / 1000]
+    else
+      stat = [n, executable, code]
+    end
+
+    progress_lock.synchronize { progress.increment }
+    stat
+  }
+
+  results = Array.new(range.size)
+  pending = Queue.new
+  range.each_with_index { |n, i| pending << [n, i] }
+  errors = []
+  workers = Array.new([benchmark_jobs, range.size].min) { |worker|
+    Thread.new {
+      while errors.empty? and (job = pending.pop(true) rescue nil)
+        n, i = job
+        begin
+          results[i] = build[n, worker]
+        rescue => e
+          progress_lock.synchronize { errors << e }
+        end
+      end
+    }
+  }
+  workers.each(&:join)
+  raise errors.first if not errors.empty?
+
+  # Run the resulting programs and get timing statistics. The statistics
+  # should be written to stdout by the `measure` function of the
+  # `measure.hpp` header.
+  if aspect == :execution_time
+    results.map! do |n, executable, code|
+      stdout, stderr, status = Open3.capture3(*pin_to(0), executable.to_s)
       raise "runtime error: #{stderr}\n\n#{code}" if not status.success?
       match = stdout.match(/\[execution time: (.+)\]/i)
       if match.nil?
@@ -133,14 +309,14 @@ def measure(aspect, template_relative, range)
                "Did you use the `measure` function in the `measure.hpp` header? " +
                "stdout follows:\n#{stdout}")
       end
-      stat = match.captures[0].to_f
+      progress.increment
+      [n, match.captures[0].to_f]
     end
-
-    progress.increment
-    [n, stat]
   end
+
+  results
 ensure
-  measure_file.write("")
+  scratch.rmtree if scratch
   progress.finish if progress
 end
 
@@ -149,13 +325,26 @@ def time_execution(erb_file, range)
 end
 
 def time_compilation(erb_file, range)
-  measure(:compilation_time, erb_file, range)
+  measure(:compilation_time, erb_file, range).to_json
 end
 
 if __FILE__ == $0
   command = ARGV.join(' ')
   time = Benchmark.realtime { `#{command}` }
+  status = $?
+  memory = children_peak_memory
 
   puts "[command line: #{command}]"
   puts "[compilation time: #{time}]"
+  puts "[peak memory: #{memory}]" if memory
+
+  if compiler_has_time_trace
+    stats = compilation_statistics(ARGV)
+    if stats
+      puts "[template instantiations: #{stats[:instantiations]}]"
+      puts "[constant evaluations: #{stats[:evaluations]}]"
+    end
+  end
+
+  exit status.exitstatus || 1 if not status.success?
 end
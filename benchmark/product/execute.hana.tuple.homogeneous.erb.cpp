@@ -20,5 +20,7 @@ int main() {
 
             result += boost::hana::product<>(values);
         }
+
+        boost::hana::benchmark::do_not_optimize(result);
     });
 }
@@ -21,7 +21,7 @@ int main () {
             );
 
             auto result = boost::hana::reverse(std::move(values));
-            (void)result;
+            boost::hana::benchmark::do_not_optimize(result);
         }
     });
 }
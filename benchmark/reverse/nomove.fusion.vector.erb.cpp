@@ -29,7 +29,7 @@ int main () {
             auto result = boost::fusion::as_vector(
                 boost::fusion::reverse(values)
             );
-            (void)result;
+            boost::hana::benchmark::do_not_optimize(result);
         }
     });
 }
@@ -30,5 +30,7 @@ int main () {
                 })
             );
         }
+
+        boost::hana::benchmark::do_not_optimize(result);
     });
 }
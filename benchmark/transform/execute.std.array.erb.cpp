@@ -24,5 +24,7 @@ int main () {
                 return result += t;
             });
         }
+
+        boost::hana::benchmark::do_not_optimize(result);
     });
 }
@@ -0,0 +1,86 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/json.hpp>
+#include <boost/hana/struct_macros.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <string>
+#include <vector>
+using namespace boost::hana;
+
+
+struct Car {
+    BOOST_HANA_DEFINE_STRUCT(Car,
+        (std::string, brand),
+        (std::string, model)
+    );
+};
+
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (int, age),
+        (std::vector<Car>, cars)
+    );
+};
+
+int main() {
+
+{
+
+//! [write_json]
+Person john{"John", 30, {{"BMW", "Z3"}, {"Audi", "A4"}}};
+
+char buffer[128];
+char* last = experimental::write_json(buffer, john);
+
+BOOST_HANA_RUNTIME_CHECK(std::string(buffer, last) ==
+    R"({"name":"John","age":30,"cars":[{"brand":"BMW","model":"Z3"},)"
+    R"({"brand":"Audi","model":"A4"}]})"
+);
+//! [write_json]
+
+}{
+
+//! [to_json]
+Car bmw{"BMW", "Z3"};
+BOOST_HANA_RUNTIME_CHECK(
+    experimental::to_json(make_tuple(bmw, 1, 2.5, true, "quote\"d")) ==
+    R"([{"brand":"BMW","model":"Z3"},1,2.5,true,"quote\"d"])"
+);
+//! [to_json]
+
+}{
+
+//! [read_json]
+std::string json = R"({"name": "John", "age": 30, "height": 1.8,
+                       "cars": [{"brand": "BMW", "model": "Z3"}]})";
+
+Person john;
+experimental::read_json(json.data(), json.data() + json.size(), john);
+
+BOOST_HANA_RUNTIME_CHECK(john.name == "John");
+BOOST_HANA_RUNTIME_CHECK(john.age == 30); // "height" is not a member; it is skipped
+BOOST_HANA_RUNTIME_CHECK(john.cars.size() == 1 && john.cars[0].model == "Z3");
+//! [read_json]
+
+}{
+
+//! [from_json]
+auto xs = experimental::from_json<_tuple<int, std::string, std::vector<Car>>>(
+    std::string{R"([1, "two", [{"brand": "Audi", "model": "A4"}]])"}
+);
+
+BOOST_HANA_RUNTIME_CHECK(at_c<0>(xs) == 1);
+BOOST_HANA_RUNTIME_CHECK(at_c<1>(xs) == "two");
+BOOST_HANA_RUNTIME_CHECK(at_c<2>(xs)[0].brand == "Audi");
+//! [from_json]
+
+}
+
+}
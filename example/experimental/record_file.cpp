@@ -0,0 +1,74 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/record_file.hpp>
+#include <boost/hana/struct_macros.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+using namespace boost::hana;
+
+
+struct Tick {
+    BOOST_HANA_DEFINE_STRUCT(Tick,
+        (std::uint64_t, time),
+        (double, price),
+        (std::int32_t, qty)
+    );
+};
+
+// A later version of Tick, with one more member
+struct TickV2 {
+    BOOST_HANA_DEFINE_STRUCT(TickV2,
+        (std::uint64_t, time),
+        (std::uint32_t, venue),
+        (double, price),
+        (std::int32_t, qty)
+    );
+};
+
+int main() {
+
+//! [write]
+std::vector<Tick> ticks;
+for (std::uint64_t t = 0; t < 1000; ++t)
+    ticks.push_back(Tick{t, 100.0 + t, 10});
+
+{
+    experimental::record_writer<Tick> writer{"ticks.bin"};
+    writer.write(ticks.data(), ticks.size());
+    writer.write(Tick{1000, 1100.0, 20});
+    writer.close();
+}
+//! [write]
+
+//! [read]
+// The schema matches; the records are used in place.
+experimental::mapped_records<Tick> file{"ticks.bin"};
+BOOST_HANA_RUNTIME_CHECK(file.schema_matches());
+BOOST_HANA_RUNTIME_CHECK(file.size() == 1001);
+
+double total = 0;
+for (Tick const& tick : file)
+    total += tick.price * tick.qty;
+BOOST_HANA_RUNTIME_CHECK(file[1000].qty == 20);
+
+// The schema does not match; the known members are projected.
+experimental::mapped_records<TickV2> old_file{"ticks.bin"};
+BOOST_HANA_RUNTIME_CHECK(!old_file.schema_matches());
+
+TickV2 tick = old_file.project(1000);
+BOOST_HANA_RUNTIME_CHECK(tick.time == 1000);
+BOOST_HANA_RUNTIME_CHECK(tick.venue == 0);
+BOOST_HANA_RUNTIME_CHECK(tick.price == 1100.0);
+//! [read]
+
+(void)total;
+std::remove("ticks.bin");
+
+}
@@ -0,0 +1,59 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/serialization.hpp>
+#include <boost/hana/struct_macros.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+using namespace boost::hana;
+
+
+struct Trade {
+    BOOST_HANA_DEFINE_STRUCT(Trade,
+        (std::uint64_t, id),
+        (double, price),     // id, price and quantity are written
+        (std::int32_t, qty), // with a single memcpy
+        (std::string, symbol)
+    );
+};
+
+int main() {
+
+{
+
+//! [serialize]
+Trade trade{42, 13.37, 100, "HANA"};
+
+std::vector<char> buffer;
+experimental::serialize(trade, buffer);
+
+BOOST_HANA_RUNTIME_CHECK(buffer.size() == experimental::serialized_size(trade));
+BOOST_HANA_RUNTIME_CHECK(buffer.size() == 8 + 8 + 4 + (8 + 4));
+//! [serialize]
+
+}{
+
+//! [deserialize]
+std::vector<Trade> trades{{1, 1.5, 10, "A"}, {2, 2.5, 20, "BB"}};
+auto record = make_tuple(trades, std::string{"batch"});
+
+std::string buffer;
+experimental::serialize(record, buffer);
+
+auto copy = experimental::deserialize<decltype(record)>(buffer);
+BOOST_HANA_RUNTIME_CHECK(at_c<0>(copy).size() == 2);
+BOOST_HANA_RUNTIME_CHECK(at_c<0>(copy)[1].symbol == "BB");
+BOOST_HANA_RUNTIME_CHECK(at_c<0>(copy)[1].qty == 20);
+BOOST_HANA_RUNTIME_CHECK(at_c<1>(copy) == "batch");
+//! [deserialize]
+
+}
+
+}
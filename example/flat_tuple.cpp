@@ -0,0 +1,55 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/flat_tuple.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/sequence.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+using namespace boost::hana;
+
+
+int main() {
+
+{
+
+//! [make<FlatTuple>]
+auto xs = make<FlatTuple>(1, 2, '3', std::string{"456"});
+
+constexpr auto ys = make<FlatTuple>(1, '2', 3.456);
+//! [make<FlatTuple>]
+(void)xs; (void)ys;
+
+}{
+
+//! [main]
+using Message = _flat_tuple<std::uint32_t, double, char>;
+static_assert(std::is_standard_layout<Message>{}, "");
+static_assert(std::is_trivially_copyable<Message>{}, "");
+
+// Laid out like struct { std::uint32_t m0; double m1; char m2; }
+Message message{std::uint32_t{42}, 3.5, 'x'};
+
+char buffer[sizeof(Message)];
+std::memcpy(buffer, &message, sizeof(Message));
+
+Message received;
+std::memcpy(&received, buffer, sizeof(Message));
+BOOST_HANA_RUNTIME_CHECK(received == message);
+
+// All the Sequence operations are available
+BOOST_HANA_RUNTIME_CHECK(at_c<1>(received) == 3.5);
+BOOST_HANA_RUNTIME_CHECK(reverse(received) == make<FlatTuple>('x', 3.5, 42u));
+BOOST_HANA_CONSTANT_CHECK(length(received) == boost::hana::size_t<3>);
+//! [main]
+
+}
+
+}
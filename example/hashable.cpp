@@ -0,0 +1,41 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/ext/std/hash.hpp>
+#include <boost/hana/hashable.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <string>
+#include <unordered_map>
+using namespace boost::hana;
+
+
+int main() {
+
+{
+
+//! [hash]
+// The hash of a Constant is its value's hash, computed at compile-time.
+static_assert(hash(int_<3>) == hash(3), "");
+static_assert(hash(make_tuple(1, int_<2>)) == hash(make_tuple(1, 2)), "");
+
+// Tuples can be used as keys of hash-based containers.
+std::unordered_map<_tuple<std::string, int>, double> prices{
+    {make_tuple(std::string{"apple"}, 1), 0.5},
+    {make_tuple(std::string{"apple"}, 6), 2.5}
+};
+BOOST_HANA_RUNTIME_CHECK(prices.at(make_tuple(std::string{"apple"}, 6)) == 2.5);
+
+BOOST_HANA_RUNTIME_CHECK(hash(type<int>) != hash(type<char>));
+//! [hash]
+
+}
+
+}
@@ -10,8 +10,10 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/enumerable.hpp>
 #include <boost/hana/functional/placeholder.hpp>
 #include <boost/hana/lazy.hpp>
+#include <boost/hana/logical.hpp>
 
 #include <sstream>
+#include <string>
 using namespace boost::hana;
 
 
@@ -63,6 +65,19 @@ BOOST_HANA_RUNTIME_CHECK(extract(i_plus_one) == 3);
 BOOST_HANA_RUNTIME_CHECK(extract(i_plus_one) == 4);
 //! [comonad]
 
+}{
+
+//! [lazy_ref]
+std::string s = "abcdef";
+auto reverse = [](std::string s) {
+    return std::string(s.rbegin(), s.rend());
+};
+
+// `s` is only copied into `reverse`'s parameter if that branch is taken.
+BOOST_HANA_RUNTIME_CHECK(eval_if(true_, lazy_ref(s), lazy_ref(reverse)(s)) == "abcdef");
+BOOST_HANA_RUNTIME_CHECK(eval_if(false_, lazy_ref(s), lazy_ref(reverse)(s)) == "fedcba");
+//! [lazy_ref]
+
 }
 
 }
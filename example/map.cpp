@@ -154,6 +154,37 @@ BOOST_HANA_CONSTANT_CHECK(keys(m) ^in^ permutations(make<Tuple>(int_<1>, type<vo
 
 }{
 
+//! [keys_view]
+using namespace std::literals;
+
+auto m = make<Map>(
+    make<Pair>(int_<1>, "foobar"s),
+    make<Pair>(type<void>, 1234)
+);
+
+// The keys are not copied; `ks` refers to the keys stored in `m`.
+auto ks = keys_view(m);
+BOOST_HANA_CONSTANT_CHECK(ks ^in^ permutations(make<Tuple>(int_<1>, type<void>)));
+//! [keys_view]
+
+}{
+
+//! [values_view]
+using namespace std::literals;
+
+auto m = make<Map>(
+    make<Pair>(int_<1>, "foobar"s),
+    make<Pair>(type<void>, 1234)
+);
+
+// The values are not copied, and they can be modified through the view.
+for_each(values_view(m), [](auto& value) { value += value; });
+BOOST_HANA_RUNTIME_CHECK(m[int_<1>] == "foobarfoobar");
+BOOST_HANA_RUNTIME_CHECK(m[type<void>] == 2468);
+//! [values_view]
+
+}{
+
 //! [from_Foldable]
 using namespace std::literals;
 
@@ -213,6 +244,58 @@ BOOST_HANA_RUNTIME_CHECK(
 BOOST_HANA_RUNTIME_CHECK(erase_key(m, type<char>) == m);
 //! [erase_key]
 
+}{
+
+//! [erase_keys]
+using namespace std::literals;
+
+auto m = make_map(
+    make_pair(type<int>, "abcd"s),
+    make_pair(type<void>, 1234),
+    make_pair(BOOST_HANA_STRING("foobar!"), type<char>)
+);
+
+BOOST_HANA_RUNTIME_CHECK(
+    erase_keys(m, make_set(type<int>, BOOST_HANA_STRING("foobar!"))) ==
+    make_map(make_pair(type<void>, 1234))
+);
+
+BOOST_HANA_RUNTIME_CHECK(erase_keys(m, make<Tuple>(type<char>)) == m);
+//! [erase_keys]
+
+}{
+
+//! [union_]
+using namespace std::literals;
+
+auto m1 = make_map(
+    make_pair(type<int>, "abcd"s),
+    make_pair(type<void>, 1234)
+);
+
+auto m2 = make_map(
+    make_pair(type<void>, 5678),
+    make_pair(type<char>, 'x')
+);
+
+BOOST_HANA_RUNTIME_CHECK(
+    union_(m1, m2) == make_map(
+        make_pair(type<int>, "abcd"s),
+        make_pair(type<void>, 5678),
+        make_pair(type<char>, 'x')
+    )
+);
+
+auto plus = [](int x, int y) { return x + y; };
+BOOST_HANA_RUNTIME_CHECK(
+    union_(m1, m2, plus) == make_map(
+        make_pair(type<int>, "abcd"s),
+        make_pair(type<void>, 1234 + 5678),
+        make_pair(type<char>, 'x')
+    )
+);
+//! [union_]
+
 }
 
 }
@@ -0,0 +1,104 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/lazy.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/par.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <vector>
+using namespace boost::hana;
+
+
+int main() {
+
+{
+
+//! [main]
+std::vector<double> xs(100000);
+for (std::size_t i = 0; i < xs.size(); ++i)
+    xs[i] = i;
+
+std::vector<double> roots = transform(par, xs, [](double x) {
+    return std::sqrt(x);
+});
+BOOST_HANA_RUNTIME_CHECK(roots[49] == 7.0);
+
+BOOST_HANA_RUNTIME_CHECK(sum<double>(par, xs) == 99999.0 * 100000.0 / 2);
+BOOST_HANA_RUNTIME_CHECK(count_if(par, roots, [](double r) {
+    return r == std::floor(r);
+}) == 317);
+
+// Expensive elements are worth splitting even in small numbers.
+auto stages = make<Tuple>(1, 2, 3, 4);
+BOOST_HANA_RUNTIME_CHECK(product<>(par(1), stages) == 24);
+//! [main]
+
+}{
+
+//! [for_each_parallel]
+std::atomic<int> loaded{0};
+auto loaders = make<Tuple>(
+    [&] { ++loaded; },                 // e.g. load the configuration
+    [&] { loaded += 2; },              // e.g. connect to a database
+    [&] { loaded += 3; }               // e.g. warm up a cache
+);
+
+for_each_parallel(loaders, [](auto const& load) { load(); });
+BOOST_HANA_RUNTIME_CHECK(loaded == 6);
+//! [for_each_parallel]
+
+}{
+
+//! [transform_parallel]
+auto stages = make<Tuple>(1, 2.5, std::string{"abc"});
+
+auto results = transform_parallel(stages, [](auto const& x) {
+    return x + x;
+});
+BOOST_HANA_RUNTIME_CHECK(results == make<Tuple>(2, 5.0, std::string{"abcabc"}));
+//! [transform_parallel]
+
+}{
+
+//! [eval_parallel]
+auto compute = [](auto x) { return x * 2; };
+
+// Flat structures of lazy values
+auto flat = eval_parallel(make<Tuple>(lazy(compute)(1), lazy(compute)(2.5)));
+BOOST_HANA_RUNTIME_CHECK(flat == make<Tuple>(2, 5.0));
+
+// Graphs of stages; the "report" stage runs once "parse" and "load"
+// have both completed.
+std::atomic<int> done{0};
+auto step = [&](int result) { ++done; return result; };
+auto finish = [&] { return done.load(); };
+
+auto results = eval_parallel(
+    make<Map>(
+        make<Pair>(BOOST_HANA_STRING("parse"),  lazy(step)(1)),
+        make<Pair>(BOOST_HANA_STRING("load"),   lazy(step)(2)),
+        make<Pair>(BOOST_HANA_STRING("report"), lazy(finish)())
+    ),
+    make<Map>(
+        make<Pair>(BOOST_HANA_STRING("report"),
+                   make<Tuple>(BOOST_HANA_STRING("parse"), BOOST_HANA_STRING("load")))
+    )
+);
+BOOST_HANA_RUNTIME_CHECK(results[BOOST_HANA_STRING("parse")] == 1);
+BOOST_HANA_RUNTIME_CHECK(results[BOOST_HANA_STRING("report")] == 2);
+//! [eval_parallel]
+
+}
+
+}
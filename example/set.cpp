@@ -105,6 +105,46 @@ BOOST_HANA_CONSTANT_CHECK(erase_key(xs, type<int>) == set(int_<0>, type<void>));
 BOOST_HANA_CONSTANT_CHECK(erase_key(xs, type<char>) == xs);
 //! [erase_key]
 
+}{
+
+//! [union_]
+constexpr auto xs = set(int_<0>, type<int>);
+auto ys = set(type<int>, BOOST_HANA_STRING("abc"));
+
+BOOST_HANA_CONSTANT_CHECK(
+    union_(xs, ys) == set(int_<0>, type<int>, BOOST_HANA_STRING("abc"))
+);
+//! [union_]
+
+}{
+
+//! [intersection]
+constexpr auto xs = set(int_<0>, type<int>, type<void>);
+constexpr auto ys = set(type<void>, int_<1>, long_<0>);
+
+BOOST_HANA_CONSTANT_CHECK(intersection(xs, ys) == set(int_<0>, type<void>));
+//! [intersection]
+
+}{
+
+//! [difference]
+constexpr auto xs = set(int_<0>, type<int>, type<void>);
+constexpr auto ys = set(type<void>, int_<1>, long_<0>);
+
+BOOST_HANA_CONSTANT_CHECK(difference(xs, ys) == set(type<int>));
+//! [difference]
+
+}{
+
+//! [symmetric_difference]
+constexpr auto xs = set(int_<0>, type<int>, type<void>);
+constexpr auto ys = set(type<void>, int_<1>, long_<0>);
+
+BOOST_HANA_CONSTANT_CHECK(
+    symmetric_difference(xs, ys) == set(type<int>, int_<1>)
+);
+//! [symmetric_difference]
+
 }
 
 }
@@ -13,7 +13,10 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/struct_macros.hpp>
 #include <boost/hana/tuple.hpp>
 
+#include <cstdint>
+#include <sstream>
 #include <string>
+#include <type_traits>
 using namespace boost::hana;
 
 
@@ -142,6 +145,42 @@ BOOST_HANA_RUNTIME_CHECK(members(john) == make_tuple("John", 30));
 
 }{
 
+//! [members_ref]
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (unsigned short, age)
+    );
+};
+
+Person john{"John", 30};
+auto refs = members_ref(john); // no member is copied
+static_assert(std::is_same<
+    decltype(refs), _tuple<std::string&, unsigned short&>
+>{}, "");
+BOOST_HANA_RUNTIME_CHECK(&at_c<0>(refs) == &john.name);
+//! [members_ref]
+
+}{
+
+//! [tie_members]
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (unsigned short, age)
+    );
+};
+
+// Lexicographical comparison, without copying any member.
+auto older = [](Person const& a, Person const& b) {
+    return tie_members(a) < tie_members(b);
+};
+BOOST_HANA_RUNTIME_CHECK(older(Person{"Jane", 25}, Person{"John", 30}));
+BOOST_HANA_RUNTIME_CHECK(!older(Person{"John", 30}, Person{"John", 30}));
+//! [tie_members]
+
+}{
+
 //! [keys]
 struct Person {
     BOOST_HANA_DEFINE_STRUCT(Person,
@@ -157,6 +196,56 @@ BOOST_HANA_CONSTANT_CHECK(
 );
 //! [keys]
 
+}{
+
+//! [visit_member]
+struct Person {
+    BOOST_HANA_DEFINE_STRUCT(Person,
+        (std::string, name),
+        (unsigned short, age)
+    );
+};
+
+Person john{"John", 30};
+std::string field = "age"; // only known at runtime
+
+std::ostringstream out;
+bool found = visit_member(john, field, [&](auto const& member) {
+    out << member;
+});
+BOOST_HANA_RUNTIME_CHECK(found);
+BOOST_HANA_RUNTIME_CHECK(out.str() == "30");
+
+BOOST_HANA_RUNTIME_CHECK(!visit_member(john, "height", [](auto const&) { }));
+//! [visit_member]
+
+}{
+
+//! [layout]
+struct Point {
+    BOOST_HANA_DEFINE_STRUCT(Point,
+        (std::int32_t, x),
+        (std::int32_t, y),
+        (char, tag),
+        (double, weight)
+    );
+};
+
+constexpr auto members = layout<Point>();
+static_assert(members[1].offset == 4 && members[1].size == 4, "");
+static_assert(members[3].offset == 16, ""); // 7 bytes of padding before
+
+BOOST_HANA_CONSTANT_CHECK(padding_bytes<Point>() == boost::hana::size_t<7>);
+BOOST_HANA_CONSTANT_CHECK(!is_tightly_packed<Point>());
+
+// x, y and tag can be copied with a single memcpy; weight can't be
+// part of that block because of the padding before it.
+constexpr auto runs = contiguous_trivial_runs<Point>();
+static_assert(runs.size() == 2, "");
+static_assert(runs[0].first == 0 && runs[0].last == 3 && runs[0].size == 9, "");
+static_assert(runs[1].first == 3 && runs[1].last == 4 && runs[1].size == 8, "");
+//! [layout]
+
 }
 
 }
@@ -20,6 +20,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/foldable.hpp>
 #include <boost/hana/functor.hpp>
 #include <boost/hana/group.hpp>
+#include <boost/hana/hashable.hpp>
 #include <boost/hana/integral_domain.hpp>
 #include <boost/hana/iterable.hpp>
 #include <boost/hana/logical.hpp>
@@ -37,6 +38,7 @@ Distributed under the Boost Software License, Version 1.0.
 // Data types
 #include <boost/hana/bool.hpp>
 #include <boost/hana/either.hpp>
+#include <boost/hana/flat_tuple.hpp>
 #include <boost/hana/integral_constant.hpp>
 #include <boost/hana/lazy.hpp>
 #include <boost/hana/map.hpp>
@@ -2194,7 +2196,12 @@ of `n` heterogeneous elements.
 
 @note
 You can zoom on the chart by selecting an area to zoom into. Also, you can
-hide a series of points by clicking on it in the legend on the right.
+hide a series of points by clicking on it in the legend on the right. The
+dashed series show the peak memory used by the compiler, which is often
+what limits the size of the computations a build machine can handle. When
+the benchmarks are generated with Clang, the number of template
+instantiations and constant evaluations are also available as hidden
+series.
 
 The benchmark methodology is to always create the sequences in the most
 efficient way possible. For Hana, and `std::tuple`, this simply means using
@@ -2368,9 +2375,11 @@ For comparison, we also show the same algorithm as executed on a runtime
 sequence, and on a sequence whose length is known at compile-time but whose
 `transform` algorithm does not use explicit loop unrolling. All the benchmarks
 presented here are done in a _Release_ CMake configuration, which takes care
-of passing the proper optimization flags (usually `-O3`). Let's start with the
-following chart, which shows the execution time required to `transform`
-different kinds of sequences:
+of passing the proper optimization flags (usually `-O3`). Each execution time
+is the median over many samples taken after a short warm-up, and the result
+of each benchmark is made opaque to the optimizer so the work can't be
+optimized away. Let's start with the following chart, which shows the
+execution time required to `transform` different kinds of sequences:
 
 <div class="benchmark-chart"
      style="min-width: 310px; height: 400px; margin: 0 auto"
@@ -2615,7 +2624,9 @@ the headers provided by the library is also available in the panel on the left
 - `boost/hana.hpp`\n
   This is the master header of the library. It includes the whole public
   interface of the library except adapters for external libraries, which
-  must be included separately.
+  must be included separately. `boost/hana/par.hpp`, which provides the
+  `par` execution policy, is not included either because it requires
+  linking with the platform's threading library.
 
 - `boost/hana/`\n
   This is the main directory of the library containing the definitions of
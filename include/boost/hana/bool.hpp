@@ -13,6 +13,7 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/fwd/bool.hpp>
 
+#include <boost/hana/config.hpp>
 #include <boost/hana/constant.hpp>
 #include <boost/hana/core/convert.hpp>
 #include <boost/hana/core/datatype.hpp>
@@ -182,6 +183,16 @@ namespace boost { namespace hana {
     //////////////////////////////////////////////////////////////////////////
     template <typename T>
     struct eval_if_impl<IntegralConstant<T>> {
+#ifdef BOOST_HANA_CONFIG_HAS_CXX1Z_IF_CONSTEXPR
+        template <typename Cond, typename Then, typename Else>
+        static constexpr decltype(auto)
+        apply(Cond const&, Then&& t, Else&& e) {
+            if constexpr (static_cast<bool>(Cond::value))
+                return hana::eval(static_cast<Then&&>(t));
+            else
+                return hana::eval(static_cast<Else&&>(e));
+        }
+#else
         template <typename Cond, typename Then, typename Else>
         static constexpr decltype(auto)
         apply(Cond const&, Then&& t, Else&& e) {
@@ -198,6 +209,7 @@ namespace boost { namespace hana {
         static constexpr decltype(auto)
         apply(decltype(false_) const&, Then&&, Else&& e)
         { return hana::eval(static_cast<Else&&>(e)); }
+#endif
     };
 
     template <typename T>
@@ -102,6 +102,13 @@ Distributed under the Boost Software License, Version 1.0.
 #   define BOOST_HANA_CONFIG_HAS_CXX1Z_FOLD_EXPRESSIONS
 #endif
 
+// Enables selecting the branch of a compile-time `eval_if` with C++1z
+// `if constexpr`, instead of dispatching on `true_` and `false_` through
+// overloading. Enabled whenever the compiler supports `if constexpr`.
+#if defined(__cpp_if_constexpr)
+#   define BOOST_HANA_CONFIG_HAS_CXX1Z_IF_CONSTEXPR
+#endif
+
 // BOOST_HANA_CONFIG_HAS_CONSTEXPR_LAMBDA enables some constructs requiring
 // `constexpr` lambdas, which are not in the language (yet).
 // Currently always disabled.
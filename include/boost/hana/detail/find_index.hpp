@@ -0,0 +1,99 @@
+/*!
+@file
+Defines `boost::hana::detail::first_true`, `boost::hana::detail::satisfies`,
+`boost::hana::detail::returns_constants`, `boost::hana::detail::any_satisfies`
+and `boost::hana::detail::find_equal`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_FIND_INDEX_HPP
+#define BOOST_HANA_DETAIL_FIND_INDEX_HPP
+
+#include <boost/hana/comparable.hpp>
+#include <boost/hana/constant.hpp>
+#include <boost/hana/core/datatype.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/detail/std/declval.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/logical.hpp>
+
+
+namespace boost { namespace hana { namespace detail {
+    //! @ingroup group-details
+    //! Returns the index of the first `true` in `b...`, or `sizeof...(b)`
+    //! if there is none.
+    //!
+    //! This is computed with a loop in a `constexpr` function, which only
+    //! requires a constant number of template instantiations.
+    template <bool ...b>
+    constexpr detail::std::size_t first_true() {
+        constexpr bool bs[] = {b..., true};
+        detail::std::size_t i = 0;
+        while (!bs[i])
+            ++i;
+        return i;
+    }
+
+    //! @ingroup group-details
+    //! Returns whether `pred(x)` is a true-valued compile-time `Logical`,
+    //! where `pred` and `x` are objects of type `Pred&` and `X`.
+    //!
+    //! The predicate is not called; only the type of its result is used.
+    //! Hence, this fails to compile if the predicate returns a runtime
+    //! `Logical`, whose value would depend on the call.
+    template <typename Pred, typename X>
+    constexpr bool satisfies() {
+        using Result = decltype(
+            detail::std::declval<Pred&>()(detail::std::declval<X>())
+        );
+        static_assert(_models<Constant, typename datatype<Result>::type>{},
+        "the predicate must return a compile-time Logical");
+        return hana::if_(hana::value<Result>(), true, false);
+    }
+
+    //! @ingroup group-details
+    //! Returns whether `pred(x)` is a compile-time `Logical` for each `x`
+    //! of type `X...`, where `pred` is an object of type `Pred&`.
+    template <typename Pred, typename ...X>
+    constexpr bool returns_constants() {
+        return detail::first_true<
+            !_models<Constant, typename datatype<decltype(
+                detail::std::declval<Pred&>()(detail::std::declval<X>())
+            )>::type>{}()...
+        >() == sizeof...(X);
+    }
+
+    //! @ingroup group-details
+    //! Returns whether `pred(x)` is true for any of the `x...`.
+    //!
+    //! The predicate is called from left to right and not anymore once it
+    //! returned a true-valued `Logical`, which may be a runtime one.
+    template <typename Pred, typename ...X>
+    constexpr bool any_satisfies(Pred& pred, X&& ...x) {
+        bool found = false;
+        bool results[] = {false, (found = found ||
+            hana::if_(pred(static_cast<X&&>(x)), true, false))...};
+        (void)results;
+        return found;
+    }
+
+    //! @ingroup group-details
+    //! Returns the index of the first of the `Ks...` comparing `equal` to
+    //! `K`, or `sizeof...(Ks)` if there is none.
+    //!
+    //! The comparisons must return compile-time `Logical`s.
+    template <typename K, typename ...Ks>
+    constexpr detail::std::size_t find_equal() {
+        return detail::first_true<
+            hana::value<decltype(hana::equal(
+                detail::std::declval<K const&>(),
+                detail::std::declval<Ks const&>()
+            ))>()...
+        >();
+    }
+}}} // end namespace boost::hana::detail
+
+#endif // !BOOST_HANA_DETAIL_FIND_INDEX_HPP
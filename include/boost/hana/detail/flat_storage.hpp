@@ -0,0 +1,278 @@
+/*!
+@file
+Defines `boost::hana::detail::flat_storage`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_FLAT_STORAGE_HPP
+#define BOOST_HANA_DETAIL_FLAT_STORAGE_HPP
+
+#include <boost/hana/detail/std/size_t.hpp>
+
+
+namespace boost { namespace hana { namespace detail {
+    //! @ingroup group-details
+    //! Aggregate holding objects of types `X0, ..., Xn` as data members, in
+    //! that order.
+    //!
+    //! `flat_storage<X0, ..., Xn>` is a plain `struct` whose members are
+    //! named `m0, ..., mn`. Since it has no base classes and no member
+    //! functions, it is standard-layout and trivially copyable whenever all
+    //! the `Xi`s are. Up to 16 members, it is laid out exactly like the
+    //! equivalent `struct` written by hand. After that, the members past
+    //! the 16th are stored in a nested `flat_storage` named `rest`, which
+    //! is the last member.
+    template <typename ...Xs>
+    struct flat_storage;
+
+    template <>
+    struct flat_storage<> { };
+
+    template <typename X0>
+    struct flat_storage<X0> {
+        X0 m0;
+    };
+
+    template <typename X0, typename X1>
+    struct flat_storage<X0, X1> {
+        X0 m0; X1 m1;
+    };
+
+    template <typename X0, typename X1, typename X2>
+    struct flat_storage<X0, X1, X2> {
+        X0 m0; X1 m1; X2 m2;
+    };
+
+    template <typename X0, typename X1, typename X2, typename X3>
+    struct flat_storage<X0, X1, X2, X3> {
+        X0 m0; X1 m1; X2 m2; X3 m3;
+    };
+
+    template <typename X0, typename X1, typename X2, typename X3, typename X4>
+    struct flat_storage<X0, X1, X2, X3, X4> {
+        X0 m0; X1 m1; X2 m2; X3 m3; X4 m4;
+    };
+
+    template <typename X0, typename X1, typename X2, typename X3, typename X4,
+              typename X5>
+    struct flat_storage<X0, X1, X2, X3, X4, X5> {
+        X0 m0; X1 m1; X2 m2; X3 m3; X4 m4; X5 m5;
+    };
+
+    template <typename X0, typename X1, typename X2, typename X3, typename X4,
+              typename X5, typename X6>
+    struct flat_storage<X0, X1, X2, X3, X4, X5, X6> {
+        X0 m0; X1 m1; X2 m2; X3 m3; X4 m4; X5 m5; X6 m6;
+    };
+
+    template <typename X0, typename X1, typename X2, typename X3, typename X4,
+              typename X5, typename X6, typename X7>
+    struct flat_storage<X0, X1, X2, X3, X4, X5, X6, X7> {
+        X0 m0; X1 m1; X2 m2; X3 m3; X4 m4; X5 m5; X6 m6; X7 m7;
+    };
+
+    template <typename X0, typename X1, typename X2, typename X3, typename X4,
+              typename X5, typename X6, typename X7, typename X8>
+    struct flat_storage<X0, X1, X2, X3, X4, X5, X6, X7, X8> {
+        X0 m0; X1 m1; X2 m2; X3 m3; X4 m4; X5 m5; X6 m6; X7 m7; X8 m8;
+    };
+
+    template <typename X0, typename X1, typename X2, typename X3, typename X4,
+              typename X5, typename X6, typename X7, typename X8, typename X9>
+    struct flat_storage<X0, X1, X2, X3, X4, X5, X6, X7, X8, X9> {
+        X0 m0; X1 m1; X2 m2; X3 m3; X4 m4; X5 m5; X6 m6; X7 m7; X8 m8; X9 m9;
+    };
+
+    template <typename X0, typename X1, typename X2, typename X3, typename X4,
+              typename X5, typename X6, typename X7, typename X8, typename X9,
+              typename X10>
+    struct flat_storage<X0, X1, X2, X3, X4, X5, X6, X7, X8, X9, X10> {
+        X0 m0; X1 m1; X2 m2; X3 m3; X4 m4; X5 m5; X6 m6; X7 m7; X8 m8; X9 m9;
+        X10 m10;
+    };
+
+    template <typename X0, typename X1, typename X2, typename X3, typename X4,
+              typename X5, typename X6, typename X7, typename X8, typename X9,
+              typename X10, typename X11>
+    struct flat_storage<X0, X1, X2, X3, X4, X5, X6, X7, X8, X9, X10, X11> {
+        X0 m0; X1 m1; X2 m2; X3 m3; X4 m4; X5 m5; X6 m6; X7 m7; X8 m8; X9 m9;
+        X10 m10; X11 m11;
+    };
+
+    template <typename X0, typename X1, typename X2, typename X3, typename X4,
+              typename X5, typename X6, typename X7, typename X8, typename X9,
+              typename X10, typename X11, typename X12>
+    struct flat_storage<X0, X1, X2, X3, X4, X5, X6, X7, X8, X9, X10, X11, X12> {
+        X0 m0; X1 m1; X2 m2; X3 m3; X4 m4; X5 m5; X6 m6; X7 m7; X8 m8; X9 m9;
+        X10 m10; X11 m11; X12 m12;
+    };
+
+    template <typename X0, typename X1, typename X2, typename X3, typename X4,
+              typename X5, typename X6, typename X7, typename X8, typename X9,
+              typename X10, typename X11, typename X12, typename X13>
+    struct flat_storage<X0, X1, X2, X3, X4, X5, X6, X7, X8, X9, X10, X11, X12,
+                        X13> {
+        X0 m0; X1 m1; X2 m2; X3 m3; X4 m4; X5 m5; X6 m6; X7 m7; X8 m8; X9 m9;
+        X10 m10; X11 m11; X12 m12; X13 m13;
+    };
+
+    template <typename X0, typename X1, typename X2, typename X3, typename X4,
+              typename X5, typename X6, typename X7, typename X8, typename X9,
+              typename X10, typename X11, typename X12, typename X13,
+              typename X14>
+    struct flat_storage<X0, X1, X2, X3, X4, X5, X6, X7, X8, X9, X10, X11, X12,
+                        X13, X14> {
+        X0 m0; X1 m1; X2 m2; X3 m3; X4 m4; X5 m5; X6 m6; X7 m7; X8 m8; X9 m9;
+        X10 m10; X11 m11; X12 m12; X13 m13; X14 m14;
+    };
+
+    template <typename X0, typename X1, typename X2, typename X3, typename X4,
+              typename X5, typename X6, typename X7, typename X8, typename X9,
+              typename X10, typename X11, typename X12, typename X13,
+              typename X14, typename X15>
+    struct flat_storage<X0, X1, X2, X3, X4, X5, X6, X7, X8, X9, X10, X11, X12,
+                        X13, X14, X15> {
+        X0 m0; X1 m1; X2 m2; X3 m3; X4 m4; X5 m5; X6 m6; X7 m7; X8 m8; X9 m9;
+        X10 m10; X11 m11; X12 m12; X13 m13; X14 m14; X15 m15;
+    };
+
+    template <typename X0, typename X1, typename X2, typename X3, typename X4,
+              typename X5, typename X6, typename X7, typename X8, typename X9,
+              typename X10, typename X11, typename X12, typename X13,
+              typename X14, typename X15, typename X16, typename ...Xn>
+    struct flat_storage<X0, X1, X2, X3, X4, X5, X6, X7, X8, X9, X10, X11, X12,
+                        X13, X14, X15, X16, Xn...> {
+        X0 m0; X1 m1; X2 m2; X3 m3; X4 m4; X5 m5; X6 m6; X7 m7; X8 m8; X9 m9;
+        X10 m10; X11 m11; X12 m12; X13 m13; X14 m14; X15 m15;
+        flat_storage<X16, Xn...> rest;
+    };
+
+    //! @ingroup group-details
+    //! Returns the `n`-th member of a `flat_storage`, with the same value
+    //! category as the `flat_storage` itself.
+    template <detail::std::size_t n, bool = (n < 16)>
+    struct flat_get {
+        template <typename Storage>
+        static constexpr decltype(auto) apply(Storage&& s) {
+            return flat_get<n - 16>::apply(static_cast<Storage&&>(s).rest);
+        }
+    };
+
+    template <>
+    struct flat_get<0, true> {
+        template <typename Storage>
+        static constexpr decltype(auto) apply(Storage&& s)
+        { return (static_cast<Storage&&>(s).m0); }
+    };
+
+    template <>
+    struct flat_get<1, true> {
+        template <typename Storage>
+        static constexpr decltype(auto) apply(Storage&& s)
+        { return (static_cast<Storage&&>(s).m1); }
+    };
+
+    template <>
+    struct flat_get<2, true> {
+        template <typename Storage>
+        static constexpr decltype(auto) apply(Storage&& s)
+        { return (static_cast<Storage&&>(s).m2); }
+    };
+
+    template <>
+    struct flat_get<3, true> {
+        template <typename Storage>
+        static constexpr decltype(auto) apply(Storage&& s)
+        { return (static_cast<Storage&&>(s).m3); }
+    };
+
+    template <>
+    struct flat_get<4, true> {
+        template <typename Storage>
+        static constexpr decltype(auto) apply(Storage&& s)
+        { return (static_cast<Storage&&>(s).m4); }
+    };
+
+    template <>
+    struct flat_get<5, true> {
+        template <typename Storage>
+        static constexpr decltype(auto) apply(Storage&& s)
+        { return (static_cast<Storage&&>(s).m5); }
+    };
+
+    template <>
+    struct flat_get<6, true> {
+        template <typename Storage>
+        static constexpr decltype(auto) apply(Storage&& s)
+        { return (static_cast<Storage&&>(s).m6); }
+    };
+
+    template <>
+    struct flat_get<7, true> {
+        template <typename Storage>
+        static constexpr decltype(auto) apply(Storage&& s)
+        { return (static_cast<Storage&&>(s).m7); }
+    };
+
+    template <>
+    struct flat_get<8, true> {
+        template <typename Storage>
+        static constexpr decltype(auto) apply(Storage&& s)
+        { return (static_cast<Storage&&>(s).m8); }
+    };
+
+    template <>
+    struct flat_get<9, true> {
+        template <typename Storage>
+        static constexpr decltype(auto) apply(Storage&& s)
+        { return (static_cast<Storage&&>(s).m9); }
+    };
+
+    template <>
+    struct flat_get<10, true> {
+        template <typename Storage>
+        static constexpr decltype(auto) apply(Storage&& s)
+        { return (static_cast<Storage&&>(s).m10); }
+    };
+
+    template <>
+    struct flat_get<11, true> {
+        template <typename Storage>
+        static constexpr decltype(auto) apply(Storage&& s)
+        { return (static_cast<Storage&&>(s).m11); }
+    };
+
+    template <>
+    struct flat_get<12, true> {
+        template <typename Storage>
+        static constexpr decltype(auto) apply(Storage&& s)
+        { return (static_cast<Storage&&>(s).m12); }
+    };
+
+    template <>
+    struct flat_get<13, true> {
+        template <typename Storage>
+        static constexpr decltype(auto) apply(Storage&& s)
+        { return (static_cast<Storage&&>(s).m13); }
+    };
+
+    template <>
+    struct flat_get<14, true> {
+        template <typename Storage>
+        static constexpr decltype(auto) apply(Storage&& s)
+        { return (static_cast<Storage&&>(s).m14); }
+    };
+
+    template <>
+    struct flat_get<15, true> {
+        template <typename Storage>
+        static constexpr decltype(auto) apply(Storage&& s)
+        { return (static_cast<Storage&&>(s).m15); }
+    };
+
+}}} // end namespace boost::hana::detail
+
+#endif // !BOOST_HANA_DETAIL_FLAT_STORAGE_HPP
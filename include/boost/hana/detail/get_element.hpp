@@ -0,0 +1,57 @@
+/*!
+@file
+Defines `boost::hana::detail::get_element`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_GET_ELEMENT_HPP
+#define BOOST_HANA_DETAIL_GET_ELEMENT_HPP
+
+#include <boost/hana/detail/std/conditional.hpp>
+#include <boost/hana/detail/std/is_lvalue_reference.hpp>
+#include <boost/hana/detail/std/is_rvalue_reference.hpp>
+#include <boost/hana/detail/std/remove_cv.hpp>
+#include <boost/hana/detail/std/remove_reference.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+
+
+namespace boost { namespace hana { namespace detail {
+    //! @ingroup group-details
+    //! Returns the `n`th element of a foreign sequence, with the value
+    //! category of that sequence.
+    //!
+    //! `Access::at<n>(xs)` must return a reference to the `n`th element of
+    //! `xs`, and `Access::element<n, Xs>` must be the type with which that
+    //! element is declared in the sequence type `Xs`. Like `std::get` on a
+    //! `std::tuple`, the element of a rvalue sequence is moved out of it,
+    //! unless that element is declared as a reference, in which case the
+    //! referenced object is returned as-is. Hence, unpacking a sequence of
+    //! references never moves from the referenced objects.
+    template <typename Access, detail::std::size_t n>
+    struct get_element {
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs& xs)
+        { return Access::template at<n>(xs); }
+
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            using T = typename Access::template element<
+                n, typename detail::std::remove_cv<Xs>::type
+            >;
+            using Elem = typename detail::std::remove_reference<
+                decltype(Access::template at<n>(xs))
+            >::type;
+            using Result = typename detail::std::conditional<
+                detail::std::is_lvalue_reference<T>::value ||
+                detail::std::is_rvalue_reference<T>::value,
+                T&&, Elem&&
+            >::type;
+            return static_cast<Result>(Access::template at<n>(xs));
+        }
+    };
+}}} // end namespace boost::hana::detail
+
+#endif // !BOOST_HANA_DETAIL_GET_ELEMENT_HPP
@@ -0,0 +1,148 @@
+/*!
+@file
+Defines `boost::hana::detail::key_of` and `boost::hana::detail::key_index`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_KEY_INDEX_HPP
+#define BOOST_HANA_DETAIL_KEY_INDEX_HPP
+
+#include <boost/hana/core/datatype.hpp>
+#include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
+#include <boost/hana/detail/std/is_base_of.hpp>
+#include <boost/hana/detail/std/is_same.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/fwd/integral_constant.hpp>
+#include <boost/hana/fwd/string.hpp>
+#include <boost/hana/fwd/type.hpp>
+
+
+namespace boost { namespace hana { namespace detail {
+    template <typename T>
+    struct type_key;
+
+    template <unsigned long long v>
+    struct integral_key;
+
+    //! @ingroup group-details
+    //! Canonical C++ type of an object whose value is known at compile-time.
+    //!
+    //! For some objects whose value is known at compile-time, it is possible
+    //! to find a C++ type which is the same for two such objects if and only
+    //! if they compare `equal`. When this is the case, `key_of<X>::type` is
+    //! that type and `key_of<X>::available` is true. This is the case for
+    //! `Type`s, `IntegralConstant`s and `String`s. Note that the key of an
+    //! `IntegralConstant` only depends on its value, since `int_<1>` and
+    //! `long_<1>` compare equal. Negative `IntegralConstant`s have no key,
+    //! because the usual arithmetic conversions make them equal to some
+    //! unsigned values, e.g. `int_<-1>` and `ulong<ULONG_MAX>`.
+    template <typename X, typename = void>
+    struct key_of : key_of<X, when<true>> { };
+
+    template <typename X, bool condition>
+    struct key_of<X, when<condition>> {
+        static constexpr bool available = false;
+    };
+
+    template <typename X>
+    struct key_of<X, when<
+        detail::std::is_same<typename datatype<X>::type, Type>::value
+    >> {
+        static constexpr bool available = true;
+        using type = type_key<typename X::type>;
+    };
+
+    template <typename T, T v>
+    struct key_of<_integral_constant<T, v>, when<!(v < 0)>> {
+        static constexpr bool available = true;
+        using type = integral_key<static_cast<unsigned long long>(v)>;
+    };
+
+    template <char ...s>
+    struct key_of<_string<s...>, when<true>> {
+        static constexpr bool available = true;
+        using type = _string<s...>;
+    };
+
+    template <typename Key>
+    struct key_leaf { };
+
+    template <detail::std::size_t i, typename Key>
+    struct indexed_key : key_leaf<Key> { };
+
+    template <typename Indices, typename ...Keys>
+    struct key_index_impl;
+
+    template <detail::std::size_t ...i, typename ...Keys>
+    struct key_index_impl<detail::std::index_sequence<i...>, Keys...>
+        : indexed_key<i, Keys>...
+    { };
+
+    template <bool ...b>
+    struct bools;
+
+    //! @ingroup group-details
+    //! Constant-time lookup of compile-time objects by their `key_of`.
+    //!
+    //! Given objects of types `Xs...`, `key_index<Xs...>::available` is
+    //! whether all of them have a `key_of`. When this is the case,
+    //! `contains<Y>()` returns whether an object of type `Y` compares
+    //! `equal` to one of the `Xs...`, and `find<Y>()` returns the index
+    //! of that object, or `sizeof...(Xs)` if there is none. These lookups
+    //! are implemented by checking whether a type is a base class of an
+    //! index inheriting from one class per key, so they cost a constant
+    //! number of instantiations instead of a linear number of comparisons.
+    template <typename ...Xs>
+    struct key_index {
+        static constexpr bool available = detail::std::is_same<
+            bools<key_of<typename detail::std::decay<Xs>::type>::available..., true>,
+            bools<true, key_of<typename detail::std::decay<Xs>::type>::available...>
+        >::value;
+
+        template <typename Y>
+        using key = typename key_of<typename detail::std::decay<Y>::type>::type;
+
+        // This is a nested class rather than an alias so that it is only
+        // instantiated when all the keys are available.
+        struct index
+            : key_index_impl<
+                detail::std::make_index_sequence<sizeof...(Xs)>, key<Xs>...
+            >
+        { };
+
+        template <typename Y>
+        static constexpr bool can_find()
+        { return key_of<typename detail::std::decay<Y>::type>::available; }
+
+        template <typename Y>
+        static constexpr bool contains()
+        { return detail::std::is_base_of<key_leaf<key<Y>>, index>::value; }
+
+        template <typename ...Ys>
+        static constexpr bool contains_all() {
+            return detail::std::is_same<
+                bools<contains<Ys>()..., true>, bools<true, contains<Ys>()...>
+            >::value;
+        }
+
+        template <typename Key, detail::std::size_t i>
+        static constexpr detail::std::size_t index_of(indexed_key<i, Key> const*)
+        { return i; }
+
+        template <typename Key>
+        static constexpr detail::std::size_t index_of(...)
+        { return sizeof...(Xs); }
+
+        template <typename Y>
+        static constexpr detail::std::size_t find()
+        { return index_of<key<Y>>(static_cast<index const*>(nullptr)); }
+    };
+}}} // end namespace boost::hana::detail
+
+#endif // !BOOST_HANA_DETAIL_KEY_INDEX_HPP
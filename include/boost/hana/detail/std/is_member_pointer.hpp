@@ -0,0 +1,34 @@
+/*!
+@file
+Defines an equivalent to `std::is_member_pointer`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_STD_IS_MEMBER_POINTER_HPP
+#define BOOST_HANA_DETAIL_STD_IS_MEMBER_POINTER_HPP
+
+#include <boost/hana/detail/std/integral_constant.hpp>
+#include <boost/hana/detail/std/remove_cv.hpp>
+
+
+namespace boost { namespace hana { namespace detail { namespace std {
+    namespace is_member_pointer_detail {
+        template <typename T>
+        struct is_member_pointer : false_type { };
+
+        template <typename T, typename U>
+        struct is_member_pointer<T U::*> : true_type { };
+    }
+
+    template <typename T>
+    struct is_member_pointer
+        : is_member_pointer_detail::is_member_pointer<
+            typename remove_cv<T>::type
+        >
+    { };
+}}}} // end namespace boost::hana::detail::std
+
+#endif // !BOOST_HANA_DETAIL_STD_IS_MEMBER_POINTER_HPP
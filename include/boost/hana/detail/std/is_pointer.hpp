@@ -0,0 +1,32 @@
+/*!
+@file
+Defines an equivalent to `std::is_pointer`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_STD_IS_POINTER_HPP
+#define BOOST_HANA_DETAIL_STD_IS_POINTER_HPP
+
+#include <boost/hana/detail/std/integral_constant.hpp>
+#include <boost/hana/detail/std/remove_cv.hpp>
+
+
+namespace boost { namespace hana { namespace detail { namespace std {
+    namespace is_pointer_detail {
+        template <typename T>
+        struct is_pointer : false_type { };
+
+        template <typename T>
+        struct is_pointer<T*> : true_type { };
+    }
+
+    template <typename T>
+    struct is_pointer
+        : is_pointer_detail::is_pointer<typename remove_cv<T>::type>
+    { };
+}}}} // end namespace boost::hana::detail::std
+
+#endif // !BOOST_HANA_DETAIL_STD_IS_POINTER_HPP
@@ -0,0 +1,175 @@
+/*!
+@file
+Defines `boost::hana::detail::struct_layout`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_STRUCT_LAYOUT_HPP
+#define BOOST_HANA_DETAIL_STRUCT_LAYOUT_HPP
+
+#include <boost/hana/core/datatype.hpp>
+#include <boost/hana/detail/constexpr/array.hpp>
+#include <boost/hana/detail/std/declval.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
+#include <boost/hana/detail/std/is_standard_layout.hpp>
+#include <boost/hana/detail/std/remove_cv.hpp>
+#include <boost/hana/detail/std/remove_reference.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/fwd/foldable.hpp>
+#include <boost/hana/fwd/product.hpp>
+#include <boost/hana/fwd/struct.hpp>
+#include <boost/hana/fwd/tuple.hpp>
+#include <boost/hana/fwd/type.hpp>
+
+
+namespace boost { namespace hana { namespace detail {
+    // The offsets of the members of a `Struct`, when they are known.
+    //
+    // They are known when the `Struct`'s accessors are provided by a
+    // `member_offsets` function, like the one generated by the
+    // `BOOST_HANA_DEFINE_STRUCT` and `BOOST_HANA_ADAPT_STRUCT` macros.
+    // `member_offsets()` must return a function object whose return type,
+    // when called with `hana::type<S>`, is a `Tuple` of `IntegralConstant`s
+    // holding the offsets. Since `offsetof` is only meaningful for
+    // standard-layout types, the offsets are never used otherwise.
+    template <typename S,
+              bool = detail::std::is_standard_layout<S>{},
+              typename = void>
+    struct member_offsets {
+        static constexpr bool available = false;
+
+        static constexpr detail::std::size_t get(detail::std::size_t)
+        { return 0; }
+    };
+
+    template <typename S>
+    struct member_offsets<S, true, decltype((void)
+        accessors_impl<typename datatype<S>::type>::member_offsets()
+    )> {
+        static constexpr bool available = true;
+
+        using Offsets = decltype(
+            accessors_impl<typename datatype<S>::type>::member_offsets()(
+                hana::type<S>
+            )
+        );
+
+        template <typename ...Offset>
+        static constexpr detail::constexpr_::array<
+            detail::std::size_t, sizeof...(Offset) + 1
+        > to_array(_tuple<Offset...> const*)
+        { return {{Offset::value..., 0}}; }
+
+        static constexpr detail::std::size_t get(detail::std::size_t i)
+        { return to_array(static_cast<Offsets const*>(nullptr))[i]; }
+    };
+
+    // Groups the members of a `Struct` into runs of adjacent members that
+    // satisfy `Pred` and that have no padding between them, so that they
+    // can be handled as a single block of memory. `run_end(i)` is the index
+    // one past the last member of the run starting at the `i`-th member,
+    // and it is `i` when the `i`-th member is in the middle of a run.
+    // Members that can't be part of a run are runs of their own.
+    template <typename S, template <typename> class Pred, typename ...Members>
+    struct struct_layout {
+        static constexpr detail::std::size_t n = sizeof...(Members);
+        using Offsets = member_offsets<S>;
+
+        static constexpr bool in_block(detail::std::size_t i) {
+            constexpr bool preds[] = {static_cast<bool>(Pred<Members>{})..., false};
+            return Offsets::available && preds[i];
+        }
+
+        static constexpr detail::std::size_t size(detail::std::size_t i) {
+            constexpr detail::std::size_t sizes[] = {sizeof(Members)..., 0};
+            return sizes[i];
+        }
+
+        static constexpr detail::std::size_t alignment(detail::std::size_t i) {
+            constexpr detail::std::size_t alignments[] = {alignof(Members)..., 1};
+            return alignments[i];
+        }
+
+        static constexpr detail::std::size_t member_bytes() {
+            constexpr detail::std::size_t sizes[] = {sizeof(Members)..., 0};
+            detail::std::size_t total = 0;
+            for (detail::std::size_t i = 0; i < n; ++i)
+                total += sizes[i];
+            return total;
+        }
+
+        // Whether the members fit in an object of `bytes` bytes, i.e. whether
+        // their sizes add up to at most `bytes` and, when their offsets are
+        // known, each of them ends within the object. This fails when the
+        // same member is listed twice, or when an accessor does not return
+        // a member stored in the object.
+        static constexpr bool fits_in(detail::std::size_t bytes) {
+            if (member_bytes() > bytes)
+                return false;
+            if (Offsets::available)
+                for (detail::std::size_t i = 0; i < n; ++i)
+                    if (Offsets::get(i) > bytes - size(i))
+                        return false;
+            return true;
+        }
+
+        static constexpr bool contiguous(detail::std::size_t i) {
+            return in_block(i) && in_block(i + 1) &&
+                   Offsets::get(i) + size(i) == Offsets::get(i + 1);
+        }
+
+        static constexpr detail::std::size_t run_end(detail::std::size_t i) {
+            if (!in_block(i))
+                return i + 1;
+            if (i > 0 && contiguous(i - 1))
+                return i;
+            detail::std::size_t j = i;
+            while (contiguous(j))
+                ++j;
+            return j + 1;
+        }
+
+        static constexpr detail::std::size_t run_bytes(detail::std::size_t i) {
+            return Offsets::get(run_end(i) - 1) + size(run_end(i) - 1)
+                 - Offsets::get(i);
+        }
+    };
+
+    template <typename S, template <typename> class Pred>
+    struct make_struct_layout {
+        template <typename ...Accessors>
+        constexpr struct_layout<S, Pred,
+            typename detail::std::remove_cv<
+                typename detail::std::remove_reference<decltype(
+                    hana::second(detail::std::declval<Accessors>())(
+                        detail::std::declval<S&>()
+                    )
+                )>::type
+            >::type...
+        > operator()(Accessors&& ...) const { return {}; }
+    };
+
+    template <typename S, template <typename> class Pred>
+    using struct_layout_of = decltype(hana::unpack(
+        hana::accessors<typename datatype<S>::type>(),
+        make_struct_layout<S, Pred>{}
+    ));
+
+    // How the `i`-th member of a `Struct` is handled: it is either in the
+    // middle of a run, alone, or at the beginning of a run.
+    using in_run = detail::std::integral_constant<int, 0>;
+    using alone = detail::std::integral_constant<int, 1>;
+    using run_start = detail::std::integral_constant<int, 2>;
+
+    template <detail::std::size_t run_end, detail::std::size_t i>
+    using run_kind = detail::std::integral_constant<int,
+        run_end == i     ? in_run::value :
+        run_end == i + 1 ? alone::value  :
+                           run_start::value
+    >;
+}}} // end namespace boost::hana::detail
+
+#endif // !BOOST_HANA_DETAIL_STRUCT_LAYOUT_HPP
@@ -0,0 +1,167 @@
+/*!
+@file
+Defines `boost::hana::detail::thread_pool`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_THREAD_POOL_HPP
+#define BOOST_HANA_DETAIL_THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace boost { namespace hana { namespace detail {
+    //! @ingroup group-details
+    //! Minimal pool of worker threads used by the parallel algorithms.
+    //!
+    //! The only operation provided by the pool is `parallel_for(n, f)`,
+    //! which calls `f(i)` for every `i` in `[0, n)` and returns once all
+    //! the calls have completed. The calling thread takes part in the
+    //! work, which means that `parallel_for` may be called from inside
+    //! a task without risking a deadlock, even when every worker is busy.
+    //! If some calls to `f` throw, the remaining indices are skipped and
+    //! the first exception is rethrown in the calling thread.
+    struct thread_pool {
+        explicit thread_pool(::std::size_t workers) {
+            for (::std::size_t i = 0; i < workers; ++i)
+                workers_.emplace_back([this] { work(); });
+        }
+
+        thread_pool(thread_pool const&) = delete;
+        thread_pool& operator=(thread_pool const&) = delete;
+
+        ~thread_pool() {
+            {
+                ::std::lock_guard<::std::mutex> lock{mutex_};
+                stopped_ = true;
+            }
+            ready_.notify_all();
+            for (auto& worker : workers_)
+                worker.join();
+        }
+
+        //! Number of threads that may run tasks concurrently, including
+        //! the thread calling `parallel_for`.
+        ::std::size_t concurrency() const
+        { return workers_.size() + 1; }
+
+        template <typename F>
+        void parallel_for(::std::size_t n, F const& f) {
+            if (n == 0)
+                return;
+
+            auto job = ::std::make_shared<job_t>(n, &f, [](void const* f, ::std::size_t i) {
+                (*static_cast<F const*>(f))(i);
+            });
+
+            ::std::size_t helpers = n - 1 < workers_.size() ? n - 1 : workers_.size();
+            if (helpers != 0) {
+                {
+                    ::std::lock_guard<::std::mutex> lock{mutex_};
+                    for (::std::size_t i = 0; i < helpers; ++i)
+                        jobs_.push_back(job);
+                }
+                if (helpers == 1) ready_.notify_one();
+                else              ready_.notify_all();
+            }
+
+            job->run();
+            job->wait();
+            if (job->error)
+                ::std::rethrow_exception(job->error);
+        }
+
+    private:
+        // A job is shared between the calling thread and the helpers it
+        // posted to the queue. Helpers that are only dequeued once all the
+        // indices were claimed find nothing to do, but they may still touch
+        // the job after `parallel_for` returned; hence the shared ownership.
+        struct job_t {
+            job_t(::std::size_t n, void const* f, void (*call)(void const*, ::std::size_t))
+                : size{n}, function{f}, call{call}
+            { }
+
+            void run() {
+                ::std::size_t i;
+                while ((i = next.fetch_add(1)) < size) {
+                    if (!failed.load(::std::memory_order_relaxed)) {
+                        try { call(function, i); }
+                        catch (...) {
+                            ::std::lock_guard<::std::mutex> lock{mutex};
+                            if (!error) error = ::std::current_exception();
+                            failed = true;
+                        }
+                    }
+
+                    if (done.fetch_add(1) + 1 == size) {
+                        ::std::lock_guard<::std::mutex> lock{mutex};
+                        finished.notify_all();
+                    }
+                }
+            }
+
+            void wait() {
+                ::std::unique_lock<::std::mutex> lock{mutex};
+                finished.wait(lock, [this] { return done.load() == size; });
+            }
+
+            ::std::size_t const size;
+            void const* const function;
+            void (* const call)(void const*, ::std::size_t);
+            ::std::atomic< ::std::size_t> next{0};
+            ::std::atomic< ::std::size_t> done{0};
+            ::std::atomic<bool> failed{false};
+            ::std::exception_ptr error;
+            ::std::mutex mutex;
+            ::std::condition_variable finished;
+        };
+
+        void work() {
+            while (true) {
+                ::std::shared_ptr<job_t> job;
+                {
+                    ::std::unique_lock<::std::mutex> lock{mutex_};
+                    ready_.wait(lock, [this] { return stopped_ || !jobs_.empty(); });
+                    if (jobs_.empty())
+                        return;
+                    job = ::std::move(jobs_.front());
+                    jobs_.pop_front();
+                }
+                job->run();
+            }
+        }
+
+        ::std::vector< ::std::thread> workers_;
+        ::std::deque< ::std::shared_ptr<job_t>> jobs_;
+        ::std::mutex mutex_;
+        ::std::condition_variable ready_;
+        bool stopped_ = false;
+    };
+
+    //! @ingroup group-details
+    //! Returns the pool shared by all the parallel algorithms.
+    //!
+    //! The pool is created on first use with one worker less than the
+    //! number of hardware threads, since the calling thread also runs
+    //! tasks.
+    inline thread_pool& default_thread_pool() {
+        static thread_pool pool{[] {
+            unsigned threads = ::std::thread::hardware_concurrency();
+            return threads > 1 ? threads - 1 : 0u;
+        }()};
+        return pool;
+    }
+}}} // end namespace boost::hana::detail
+
+#endif // !BOOST_HANA_DETAIL_THREAD_POOL_HPP
@@ -0,0 +1,46 @@
+/*!
+@file
+Forward declares `boost::hana::union_`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_UNION_FWD_HPP
+#define BOOST_HANA_DETAIL_UNION_FWD_HPP
+
+#include <boost/hana/fwd/core/datatype.hpp>
+#include <boost/hana/fwd/core/when.hpp>
+
+
+namespace boost { namespace hana {
+    template <typename T, typename = void>
+    struct union_impl;
+
+    template <typename T, typename>
+    struct union_impl : union_impl<T, when<true>> { };
+
+    struct _union {
+        template <typename Xs, typename Ys>
+        constexpr decltype(auto) operator()(Xs&& xs, Ys&& ys) const {
+            return union_impl<typename datatype<Xs>::type>::apply(
+                static_cast<Xs&&>(xs),
+                static_cast<Ys&&>(ys)
+            );
+        }
+
+        template <typename Xs, typename Ys, typename F>
+        constexpr decltype(auto) operator()(Xs&& xs, Ys&& ys, F&& f) const {
+            return union_impl<typename datatype<Xs>::type>::apply(
+                static_cast<Xs&&>(xs),
+                static_cast<Ys&&>(ys),
+                static_cast<F&&>(f)
+            );
+        }
+    };
+
+    constexpr _union union_{};
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_DETAIL_UNION_FWD_HPP
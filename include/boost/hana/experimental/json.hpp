@@ -0,0 +1,883 @@
+/*!
+@file
+Defines experimental facilities to read and write `Struct`s and `Sequence`s
+as JSON.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_JSON_HPP
+#define BOOST_HANA_EXPERIMENTAL_JSON_HPP
+
+#include <boost/hana/core/datatype.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/is_floating_point.hpp>
+#include <boost/hana/detail/std/is_integral.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/detail/wrong.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/iterable.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/sequence.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/struct.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <stdexcept>
+#include <streambuf>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+
+namespace boost { namespace hana { namespace experimental {
+    //! Writes the JSON representation of an object to an output iterator.
+    //!
+    //! Given an object and an output iterator over `char`s, `write_json`
+    //! writes the JSON representation of the object to the output iterator
+    //! and returns the iterator past the last written character. Nothing
+    //! is ever concatenated into intermediate strings; characters are
+    //! written directly to the output, which can be a raw buffer, a
+    //! `std::back_insert_iterator` or a `std::ostreambuf_iterator`.
+    //!
+    //! The following objects can be written:
+    //! - `Struct`s are written as JSON objects. The `"name":` prefix of each
+    //!   member is computed at compile-time from the (compile-time `String`)
+    //!   name of the member, and it is written as a single block.
+    //! - `Sequence`s and `std::vector`s are written as JSON arrays.
+    //! - compile-time `String`s, `std::string`s, `char const*`s and `char`s
+    //!   are written as JSON strings.
+    //! - `bool`s are written as `true` or `false`, and other arithmetic
+    //!   types are written as JSON numbers. Non-finite floating point
+    //!   numbers are written as `null`.
+    //!
+    //! Other types can be made writable by specializing the
+    //! `experimental::json_writer` template.
+    //!
+    //!
+    //! @param out
+    //! An output iterator to which the JSON is written.
+    //!
+    //! @param x
+    //! The object to write.
+    //!
+    //!
+    //! ### Example
+    //! @snippet example/experimental/json.cpp write_json
+    template <typename T, typename = void>
+    struct json_writer : json_writer<T, when<true>> { };
+
+    struct _write_json {
+        template <typename Out, typename T>
+        Out operator()(Out out, T const& x) const {
+            return json_writer<T>::apply(out, x);
+        }
+    };
+
+    constexpr _write_json write_json{};
+
+    //! Returns a `std::string` containing the JSON representation of an
+    //! object.
+    //!
+    //! This is equivalent to calling `write_json` with a
+    //! `std::back_insert_iterator` to an empty `std::string`.
+    //!
+    //!
+    //! ### Example
+    //! @snippet example/experimental/json.cpp to_json
+    struct _to_json {
+        template <typename T>
+        std::string operator()(T const& x) const {
+            std::string json;
+            write_json(std::back_inserter(json), x);
+            return json;
+        }
+    };
+
+    constexpr _to_json to_json{};
+
+    namespace json_detail {
+        template <typename Out, detail::std::size_t n>
+        Out write_literal(Out out, char const (&s)[n])
+        { return std::copy(s, s + n - 1, out); }
+
+        template <typename Out>
+        Out write_string(Out out, char const* first, char const* last) {
+            constexpr char hex[] = "0123456789abcdef";
+            *out++ = '"';
+            for (; first != last; ++first) {
+                unsigned char const c = static_cast<unsigned char>(*first);
+                switch (c) {
+                    case '"':  *out++ = '\\'; *out++ = '"'; break;
+                    case '\\': *out++ = '\\'; *out++ = '\\'; break;
+                    case '\b': *out++ = '\\'; *out++ = 'b'; break;
+                    case '\f': *out++ = '\\'; *out++ = 'f'; break;
+                    case '\n': *out++ = '\\'; *out++ = 'n'; break;
+                    case '\r': *out++ = '\\'; *out++ = 'r'; break;
+                    case '\t': *out++ = '\\'; *out++ = 't'; break;
+                    default:
+                        if (c < 0x20) {
+                            out = write_literal(out, "\\u00");
+                            *out++ = hex[c >> 4];
+                            *out++ = hex[c & 0xf];
+                        }
+                        else {
+                            *out++ = static_cast<char>(c);
+                        }
+                }
+            }
+            *out++ = '"';
+            return out;
+        }
+
+        // The `"name":` prefix of a member, preceded by `{` for the first
+        // member and by `,` for the other members. Member names are
+        // assumed not to need escaping, since they are C++ identifiers.
+        template <bool first, typename Name>
+        struct member_prefix {
+            static_assert(detail::wrong<Name>{},
+            "hana::experimental::write_json(out, object) requires the names "
+            "of the members of a Struct to be compile-time Strings");
+        };
+
+        template <bool first, char ...s>
+        struct member_prefix<first, _string<s...>> {
+            static constexpr char value[] = {
+                first ? '{' : ',', '"', s..., '"', ':', '\0'
+            };
+        };
+
+        template <bool first, char ...s>
+        constexpr char member_prefix<first, _string<s...>>::value[];
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Default writers
+    //////////////////////////////////////////////////////////////////////////
+    template <typename T, bool condition>
+    struct json_writer<T, when<condition>> {
+        static_assert(detail::wrong<json_writer<T>>{},
+        "hana::experimental::write_json(out, x) does not know how to write "
+        "an object of this type; specialize hana::experimental::json_writer");
+    };
+
+    template <>
+    struct json_writer<bool> {
+        template <typename Out>
+        static Out apply(Out out, bool b)
+        { return b ? json_detail::write_literal(out, "true")
+                   : json_detail::write_literal(out, "false"); }
+    };
+
+    template <>
+    struct json_writer<char> {
+        template <typename Out>
+        static Out apply(Out out, char c)
+        { return json_detail::write_string(out, &c, &c + 1); }
+    };
+
+    template <typename T>
+    struct json_writer<T, when<detail::std::is_integral<T>{}()>> {
+        static bool is_negative(T x, std::true_type /* signed */)
+        { return x < 0; }
+
+        static bool is_negative(T, std::false_type /* signed */)
+        { return false; }
+
+        template <typename Out>
+        static Out apply(Out out, T x) {
+            // Enough for the digits of a 128-bit integer and the sign.
+            char buffer[40];
+            char* const last = buffer + sizeof(buffer);
+            char* first = last;
+            bool const negative = is_negative(x, std::is_signed<T>{});
+            do {
+                int const digit = static_cast<int>(x % 10);
+                *--first = static_cast<char>('0' + (negative ? -digit : digit));
+                x /= 10;
+            } while (x != 0);
+            if (negative)
+                *--first = '-';
+            return std::copy(first, last, out);
+        }
+    };
+
+    template <typename T>
+    struct json_writer<T, when<detail::std::is_floating_point<T>{}()>> {
+        template <typename Out>
+        static Out apply(Out out, T x) {
+            if (!std::isfinite(x))
+                return json_detail::write_literal(out, "null");
+
+            // Use the shortest of the two usual precisions that still
+            // reads back as the same number.
+            std::string s = format(x, std::numeric_limits<T>::digits10);
+            if (!reads_back(s, x))
+                s = format(x, std::numeric_limits<T>::max_digits10);
+            return std::copy(s.begin(), s.end(), out);
+        }
+
+        // The streams below use the classic "C" locale, so that the decimal
+        // separator is always a dot regardless of the global locale.
+        static std::string format(T x, int precision) {
+            std::ostringstream os;
+            os.imbue(std::locale::classic());
+            os.precision(precision);
+            os << x;
+            return os.str();
+        }
+
+        static bool reads_back(std::string const& s, T x) {
+            std::istringstream in{s};
+            in.imbue(std::locale::classic());
+            T y;
+            return (in >> y) && y == x;
+        }
+    };
+
+    template <char ...s>
+    struct json_writer<_string<s...>> {
+        template <typename Out>
+        static Out apply(Out out, _string<s...> const&) {
+            constexpr char str[] = {s..., '\0'};
+            return json_detail::write_string(out, str, str + sizeof...(s));
+        }
+    };
+
+    template <typename Traits, typename Allocator>
+    struct json_writer<std::basic_string<char, Traits, Allocator>> {
+        template <typename Out>
+        static Out apply(Out out, std::basic_string<char, Traits, Allocator> const& s)
+        { return json_detail::write_string(out, s.data(), s.data() + s.size()); }
+    };
+
+    template <>
+    struct json_writer<char const*> {
+        template <typename Out>
+        static Out apply(Out out, char const* s) {
+            char const* last = s;
+            while (*last != '\0')
+                ++last;
+            return json_detail::write_string(out, s, last);
+        }
+    };
+
+    template <>
+    struct json_writer<char*> : json_writer<char const*> { };
+
+    template <detail::std::size_t n>
+    struct json_writer<char[n]> {
+        template <typename Out>
+        static Out apply(Out out, char const (&s)[n])
+        { return json_writer<char const*>::apply(out, s); }
+    };
+
+    template <typename T, typename Allocator>
+    struct json_writer<std::vector<T, Allocator>> {
+        template <typename Out>
+        static Out apply(Out out, std::vector<T, Allocator> const& xs) {
+            *out++ = '[';
+            for (auto it = xs.begin(); it != xs.end(); ++it) {
+                if (it != xs.begin())
+                    *out++ = ',';
+                out = json_writer<T>::apply(out, *it);
+            }
+            *out++ = ']';
+            return out;
+        }
+    };
+
+    template <typename S>
+    struct json_writer<S, when<_models<Sequence, S>{}()>> {
+        template <typename Out, typename Xs>
+        static Out apply(Out out, Xs const& xs) {
+            *out++ = '[';
+            bool first = true;
+            hana::for_each(xs, [&](auto const& x) {
+                if (!first)
+                    *out++ = ',';
+                first = false;
+                out = write_json(out, x);
+            });
+            *out++ = ']';
+            return out;
+        }
+    };
+
+    template <typename S>
+    struct json_writer<S, when<_models<Struct, S>{}()>> {
+        template <typename Out, detail::std::size_t i, typename Accessor>
+        static Out write_member(Out out, S const& x, Accessor const& accessor) {
+            using Name = typename detail::std::decay<
+                decltype(hana::first(accessor))
+            >::type;
+            out = json_detail::write_literal(out,
+                        json_detail::member_prefix<i == 0, Name>::value);
+            return write_json(out, hana::second(accessor)(x));
+        }
+
+        template <typename Out, detail::std::size_t ...i>
+        static Out apply_impl(Out out, S const& x, detail::std::index_sequence<i...>) {
+            auto accessors = hana::accessors<typename datatype<S>::type>();
+            (void)accessors; // unused when the Struct has no members
+            using swallow = int[];
+            (void)swallow{0,
+                ((void)(out = write_member<Out, i>(out, x, hana::at_c<i>(accessors))), 0)...
+            };
+            if (sizeof...(i) == 0)
+                *out++ = '{';
+            *out++ = '}';
+            return out;
+        }
+
+        template <typename Out>
+        static Out apply(Out out, S const& x) {
+            constexpr detail::std::size_t n = decltype(hana::length(
+                hana::accessors<typename datatype<S>::type>()
+            ))::value;
+            return apply_impl(out, x, detail::std::make_index_sequence<n>{});
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Reading
+    //////////////////////////////////////////////////////////////////////////
+    //! Exception thrown when the JSON given to `read_json` or `from_json`
+    //! is malformed or does not match the type it is read into.
+    struct json_error : std::runtime_error {
+        using std::runtime_error::runtime_error;
+    };
+
+    //! Reads a JSON value from a range of characters into an object.
+    //!
+    //! Given a range `[first, last)` of characters and an object, `read_json`
+    //! parses the JSON value at the beginning of the range (after optional
+    //! whitespace) and stores it directly into the object. It returns a
+    //! pointer past the parsed value, and it throws a `json_error` if the
+    //! JSON is malformed or does not match the type of the object.
+    //!
+    //! No document is ever built in memory. The input is parsed in a single
+    //! pass and each value is stored directly into its final destination:
+    //! - For `Struct`s, the key of each member is matched against the names
+    //!   of the members with `visit_member`, which dispatches through a
+    //!   table generated at compile-time. Keys that do not correspond to a
+    //!   member are skipped, and members whose key is not present are left
+    //!   untouched.
+    //! - `Sequence`s are read from JSON arrays that must have exactly as
+    //!   many elements as the `Sequence`.
+    //! - `std::vector`s are read from JSON arrays of any length.
+    //! - Numbers are parsed directly into arithmetic members, and strings
+    //!   are decoded directly into `std::string`s.
+    //!
+    //! Other types can be made readable by specializing the
+    //! `experimental::json_reader` template.
+    //!
+    //!
+    //! @param first, last
+    //! The range of characters to parse.
+    //!
+    //! @param x
+    //! The object to read the JSON value into.
+    //!
+    //!
+    //! ### Example
+    //! @snippet example/experimental/json.cpp read_json
+    template <typename T, typename = void>
+    struct json_reader : json_reader<T, when<true>> { };
+
+    struct _read_json {
+        template <typename T>
+        char const* operator()(char const* first, char const* last, T& x) const;
+    };
+
+    constexpr _read_json read_json{};
+
+    //! Creates an object of type `T` from its JSON representation.
+    //!
+    //! `from_json<T>(json)` default-constructs an object of type `T` and
+    //! reads `json` into it with `read_json`. `json` may be any object
+    //! with `data()` and `size()` member functions, like a `std::string`.
+    //! Only whitespace may follow the JSON value; otherwise, a `json_error`
+    //! is thrown.
+    //!
+    //!
+    //! ### Example
+    //! @snippet example/experimental/json.cpp from_json
+    template <typename T>
+    struct _from_json {
+        template <typename String>
+        T operator()(String const& json) const;
+    };
+
+    template <typename T>
+    constexpr _from_json<T> from_json{};
+
+    namespace json_detail {
+        [[noreturn]] inline void fail(char const* what)
+        { throw json_error{what}; }
+
+        inline bool is_space(char c)
+        { return c == ' ' || c == '\n' || c == '\r' || c == '\t'; }
+
+        inline char const* skip_spaces(char const* first, char const* last) {
+            while (first != last && is_space(*first))
+                ++first;
+            return first;
+        }
+
+        // Skips leading whitespace and makes sure the range is not empty.
+        inline char const* next(char const* first, char const* last) {
+            first = skip_spaces(first, last);
+            if (first == last)
+                fail("hana::experimental::read_json: unexpected end of input");
+            return first;
+        }
+
+        inline char const* expect(char const* first, char const* last, char c) {
+            first = next(first, last);
+            if (*first != c)
+                fail("hana::experimental::read_json: unexpected character");
+            return first + 1;
+        }
+
+        template <detail::std::size_t n>
+        char const* expect_literal(char const* first, char const* last,
+                                   char const (&s)[n])
+        {
+            if (static_cast<detail::std::size_t>(last - first) < n - 1 ||
+                !std::equal(s, s + n - 1, first))
+                fail("hana::experimental::read_json: invalid literal");
+            return first + n - 1;
+        }
+
+        inline unsigned hex_digit(char c) {
+            if (c >= '0' && c <= '9') return static_cast<unsigned>(c - '0');
+            if (c >= 'a' && c <= 'f') return static_cast<unsigned>(c - 'a' + 10);
+            if (c >= 'A' && c <= 'F') return static_cast<unsigned>(c - 'A' + 10);
+            fail("hana::experimental::read_json: invalid \\u escape");
+        }
+
+        inline char const* read_hex4(char const* first, char const* last,
+                                     unsigned& code)
+        {
+            if (last - first < 4)
+                fail("hana::experimental::read_json: invalid \\u escape");
+            code = 0;
+            for (int i = 0; i != 4; ++i)
+                code = code * 16 + hex_digit(*first++);
+            return first;
+        }
+
+        inline void append_utf8(std::string& s, unsigned long code) {
+            if (code < 0x80) {
+                s += static_cast<char>(code);
+            } else if (code < 0x800) {
+                s += static_cast<char>(0xc0 | (code >> 6));
+                s += static_cast<char>(0x80 | (code & 0x3f));
+            } else if (code < 0x10000) {
+                s += static_cast<char>(0xe0 | (code >> 12));
+                s += static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+                s += static_cast<char>(0x80 | (code & 0x3f));
+            } else {
+                s += static_cast<char>(0xf0 | (code >> 18));
+                s += static_cast<char>(0x80 | ((code >> 12) & 0x3f));
+                s += static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+                s += static_cast<char>(0x80 | (code & 0x3f));
+            }
+        }
+
+        // Reads the rest of a string whose opening quote was already
+        // consumed, appending its decoded contents to `s`.
+        inline char const* read_string_tail(char const* first, char const* last,
+                                            std::string& s)
+        {
+            while (true) {
+                char const* run = first;
+                while (first != last && *first != '"' && *first != '\\')
+                    ++first;
+                s.append(run, first);
+                if (first == last)
+                    fail("hana::experimental::read_json: unterminated string");
+                if (*first++ == '"')
+                    return first;
+
+                if (first == last)
+                    fail("hana::experimental::read_json: unterminated string");
+                switch (*first++) {
+                    case '"':  s += '"'; break;
+                    case '\\': s += '\\'; break;
+                    case '/':  s += '/'; break;
+                    case 'b':  s += '\b'; break;
+                    case 'f':  s += '\f'; break;
+                    case 'n':  s += '\n'; break;
+                    case 'r':  s += '\r'; break;
+                    case 't':  s += '\t'; break;
+                    case 'u': {
+                        unsigned code;
+                        first = read_hex4(first, last, code);
+                        if (code >= 0xdc00 && code < 0xe000)
+                            fail("hana::experimental::read_json: unpaired surrogate");
+                        if (code >= 0xd800 && code < 0xdc00) {
+                            unsigned low;
+                            if (last - first < 2 || first[0] != '\\' || first[1] != 'u')
+                                fail("hana::experimental::read_json: unpaired surrogate");
+                            first = read_hex4(first + 2, last, low);
+                            if (low < 0xdc00 || low >= 0xe000)
+                                fail("hana::experimental::read_json: unpaired surrogate");
+                            code = 0x10000 + ((code - 0xd800) << 10) + (low - 0xdc00);
+                        }
+                        append_utf8(s, code);
+                        break;
+                    }
+                    default:
+                        fail("hana::experimental::read_json: invalid escape sequence");
+                }
+            }
+        }
+
+        // Returns the end of the JSON number starting at `first`, following
+        // the JSON grammar strictly: an optional minus sign, an integer part
+        // without leading zeros, and optional fraction and exponent parts.
+        inline char const* scan_number(char const* first, char const* last) {
+            auto digits = [&] {
+                char const* const start = first;
+                while (first != last && *first >= '0' && *first <= '9')
+                    ++first;
+                if (first == start)
+                    fail("hana::experimental::read_json: invalid number");
+            };
+
+            if (first != last && *first == '-')
+                ++first;
+            if (first != last && *first == '0')
+                ++first;
+            else
+                digits();
+            if (first != last && *first == '.') {
+                ++first;
+                digits();
+            }
+            if (first != last && (*first == 'e' || *first == 'E')) {
+                ++first;
+                if (first != last && (*first == '+' || *first == '-'))
+                    ++first;
+                digits();
+            }
+            return first;
+        }
+
+        inline char const* skip_string(char const* first, char const* last) {
+            first = next(first, last);
+            if (*first++ != '"')
+                fail("hana::experimental::read_json: expected a string");
+            while (first != last && *first != '"') {
+                if (*first == '\\' && last - first < 2)
+                    break;
+                first += *first == '\\' ? 2 : 1;
+            }
+            if (first == last || *first != '"')
+                fail("hana::experimental::read_json: unterminated string");
+            return first + 1;
+        }
+
+        // Skips over a value that is not an object or an array.
+        inline char const* skip_scalar(char const* first, char const* last) {
+            first = next(first, last);
+            switch (*first) {
+                case '"': return skip_string(first, last);
+                case 't': return expect_literal(first, last, "true");
+                case 'f': return expect_literal(first, last, "false");
+                case 'n': return expect_literal(first, last, "null");
+                default:
+                    if (*first != '-' && (*first < '0' || *first > '9'))
+                        fail("hana::experimental::read_json: expected a value");
+                    return scan_number(first, last);
+            }
+        }
+
+        // Skips over any JSON value; this is used for unknown keys. Nested
+        // objects and arrays are tracked with an explicit stack of closing
+        // brackets instead of recursion, so that deeply nested input can't
+        // overflow the call stack.
+        inline char const* skip_value(char const* first, char const* last) {
+            std::string closing;
+            while (true) {
+                first = next(first, last);
+                if (*first == '{' || *first == '[') {
+                    char const close = *first == '{' ? '}' : ']';
+                    first = next(first + 1, last);
+                    if (*first != close) {
+                        closing += close;
+                        if (close == '}')
+                            first = expect(skip_string(first, last), last, ':');
+                        continue;
+                    }
+                    ++first;
+                } else {
+                    first = skip_scalar(first, last);
+                }
+
+                // A value was skipped; close the containers it ends, if any.
+                while (true) {
+                    if (closing.empty())
+                        return first;
+                    first = next(first, last);
+                    if (*first == closing.back()) {
+                        closing.pop_back();
+                        ++first;
+                        continue;
+                    }
+                    if (*first != ',')
+                        fail("hana::experimental::read_json: expected ',' or a closing bracket");
+                    ++first;
+                    if (closing.back() == '}')
+                        first = expect(skip_string(first, last), last, ':');
+                    break;
+                }
+            }
+        }
+
+        // A stream buffer reading directly from a range of characters.
+        struct range_buffer : std::streambuf {
+            range_buffer(char const* first, char const* last) {
+                char* const f = const_cast<char*>(first);
+                setg(f, f, f + (last - first));
+            }
+
+            bool exhausted() const { return gptr() == egptr(); }
+        };
+
+        // Parses the JSON number in `[first, last)` with the classic "C"
+        // locale, so that the decimal separator is always a dot regardless
+        // of the global locale.
+        template <typename T>
+        void parse_number(char const* first, char const* last, T& x) {
+            range_buffer buffer{first, last};
+            std::istream in{&buffer};
+            in.imbue(std::locale::classic());
+            in >> x;
+            if (in.fail() || !buffer.exhausted())
+                fail("hana::experimental::read_json: number out of range");
+        }
+
+        // A non-owning view of a key in the input, used to look up members
+        // with `visit_member`.
+        struct key_view {
+            char const* data_;
+            detail::std::size_t size_;
+            char const* data() const { return data_; }
+            detail::std::size_t size() const { return size_; }
+        };
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Default readers
+    //////////////////////////////////////////////////////////////////////////
+    template <typename T, bool condition>
+    struct json_reader<T, when<condition>> {
+        static_assert(detail::wrong<json_reader<T>>{},
+        "hana::experimental::read_json(first, last, x) does not know how to "
+        "read an object of this type; specialize hana::experimental::json_reader");
+    };
+
+    template <>
+    struct json_reader<bool> {
+        static char const* apply(char const* first, char const* last, bool& b) {
+            first = json_detail::next(first, last);
+            b = *first == 't';
+            return b ? json_detail::expect_literal(first, last, "true")
+                     : json_detail::expect_literal(first, last, "false");
+        }
+    };
+
+    template <>
+    struct json_reader<char> {
+        static char const* apply(char const* first, char const* last, char& c) {
+            std::string s;
+            first = json_detail::expect(first, last, '"');
+            first = json_detail::read_string_tail(first, last, s);
+            if (s.size() != 1)
+                json_detail::fail("hana::experimental::read_json: expected a single character");
+            c = s[0];
+            return first;
+        }
+    };
+
+    template <typename T>
+    struct json_reader<T, when<detail::std::is_integral<T>{}()>> {
+        static char const* apply(char const* first, char const* last, T& x) {
+            using Unsigned = unsigned long long;
+            first = json_detail::next(first, last);
+            bool const negative = *first == '-';
+            if (negative)
+                ++first;
+
+            char const* const digits = first;
+            Unsigned value = 0;
+            constexpr Unsigned max = std::numeric_limits<Unsigned>::max();
+            while (first != last && *first >= '0' && *first <= '9') {
+                Unsigned const digit = static_cast<Unsigned>(*first++ - '0');
+                if (value > (max - digit) / 10)
+                    json_detail::fail("hana::experimental::read_json: integer out of range");
+                value = value * 10 + digit;
+            }
+            if (first == digits)
+                json_detail::fail("hana::experimental::read_json: expected an integer");
+
+            Unsigned const max_value = Unsigned(std::numeric_limits<T>::max());
+            Unsigned const limit = !negative ? max_value
+                                 : std::is_signed<T>{} ? max_value + 1
+                                 : 0;
+            if (value > limit)
+                json_detail::fail("hana::experimental::read_json: integer out of range");
+            // The magnitude of the smallest signed integer can't be
+            // represented as a positive signed integer, hence the dance.
+            x = negative && value != 0
+                ? static_cast<T>(-static_cast<T>(value - 1) - 1)
+                : static_cast<T>(value);
+            return first;
+        }
+    };
+
+    template <typename T>
+    struct json_reader<T, when<detail::std::is_floating_point<T>{}()>> {
+        static char const* apply(char const* first, char const* last, T& x) {
+            first = json_detail::next(first, last);
+            if (*first == 'n') {
+                x = std::numeric_limits<T>::quiet_NaN();
+                return json_detail::expect_literal(first, last, "null");
+            }
+
+            char const* const end = json_detail::scan_number(first, last);
+            json_detail::parse_number(first, end, x);
+            return end;
+        }
+    };
+
+    template <>
+    struct json_reader<std::string> {
+        static char const* apply(char const* first, char const* last,
+                                 std::string& s)
+        {
+            first = json_detail::expect(first, last, '"');
+            s.clear();
+            return json_detail::read_string_tail(first, last, s);
+        }
+    };
+
+    template <typename T, typename Allocator>
+    struct json_reader<std::vector<T, Allocator>> {
+        static char const* apply(char const* first, char const* last,
+                                 std::vector<T, Allocator>& xs)
+        {
+            xs.clear();
+            first = json_detail::expect(first, last, '[');
+            first = json_detail::next(first, last);
+            if (*first == ']')
+                return first + 1;
+            while (true) {
+                xs.emplace_back();
+                first = read_json(first, last, xs.back());
+                first = json_detail::next(first, last);
+                if (*first == ']')
+                    return first + 1;
+                if (*first != ',')
+                    json_detail::fail("hana::experimental::read_json: expected ',' or ']'");
+                ++first;
+            }
+        }
+    };
+
+    template <typename S>
+    struct json_reader<S, when<_models<Sequence, S>{}()>> {
+        template <typename Xs>
+        static char const* apply(char const* first, char const* last, Xs& xs) {
+            first = json_detail::expect(first, last, '[');
+            bool is_first = true;
+            hana::for_each(xs, [&](auto& x) {
+                if (!is_first)
+                    first = json_detail::expect(first, last, ',');
+                is_first = false;
+                first = read_json(first, last, x);
+            });
+            return json_detail::expect(first, last, ']');
+        }
+    };
+
+    template <typename S>
+    struct json_reader<S, when<_models<Struct, S>{}()>> {
+        static char const* apply(char const* first, char const* last, S& x) {
+            first = json_detail::expect(first, last, '{');
+            first = json_detail::next(first, last);
+            if (*first == '}')
+                return first + 1;
+
+            std::string escaped_key;
+            while (true) {
+                first = json_detail::expect(first, last, '"');
+
+                // Keys are almost always plain identifiers, in which case
+                // they are looked up in place, without being copied.
+                char const* key = first;
+                while (first != last && *first != '"' && *first != '\\')
+                    ++first;
+                if (first == last)
+                    json_detail::fail("hana::experimental::read_json: unterminated string");
+                json_detail::key_view name{key, static_cast<detail::std::size_t>(first - key)};
+                if (*first == '\\') {
+                    escaped_key.assign(key, first);
+                    first = json_detail::read_string_tail(first, last, escaped_key);
+                    name = {escaped_key.data(), escaped_key.size()};
+                }
+                else {
+                    ++first;
+                }
+
+                first = json_detail::expect(first, last, ':');
+                bool const found = hana::visit_member(x, name, [&](auto& member) {
+                    first = read_json(first, last, member);
+                });
+                if (!found)
+                    first = json_detail::skip_value(first, last);
+
+                first = json_detail::next(first, last);
+                if (*first == '}')
+                    return first + 1;
+                if (*first != ',')
+                    json_detail::fail("hana::experimental::read_json: expected ',' or '}'");
+                ++first;
+            }
+        }
+    };
+
+    //! @cond
+    template <typename T>
+    char const* _read_json::operator()(char const* first, char const* last, T& x) const {
+        return json_reader<T>::apply(first, last, x);
+    }
+
+    template <typename T>
+    template <typename String>
+    T _from_json<T>::operator()(String const& json) const {
+        T x{};
+        char const* const last = json.data() + json.size();
+        char const* first = read_json(json.data(), last, x);
+        if (json_detail::skip_spaces(first, last) != last)
+            json_detail::fail("hana::experimental::from_json: unexpected trailing characters");
+        return x;
+    }
+    //! @endcond
+}}} // end namespace boost::hana::experimental
+
+#endif // !BOOST_HANA_EXPERIMENTAL_JSON_HPP
@@ -0,0 +1,563 @@
+/*!
+@file
+Defines experimental facilities to store arrays of `Struct`s in files that
+can be memory-mapped and used without being parsed.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_RECORD_FILE_HPP
+#define BOOST_HANA_EXPERIMENTAL_RECORD_FILE_HPP
+
+#include <boost/hana/core/convert.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/hashable.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/struct.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || (defined(__APPLE__) && defined(__MACH__))
+#   define BOOST_HANA_EXPERIMENTAL_RECORD_FILE_USE_MMAP
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+
+namespace boost { namespace hana { namespace experimental {
+    //! Exception thrown when a record file can't be written, opened, or
+    //! when its contents are malformed.
+    struct record_file_error : std::runtime_error {
+        using std::runtime_error::runtime_error;
+    };
+
+    //! Describes a member of the records stored in a record file.
+    //!
+    //! `kind` is `'i'` for signed integral types, `'u'` for unsigned
+    //! integral types, `'b'` for `bool`, `'f'` for floating point types,
+    //! `'e'` for enumerations and `'a'` for any other type. Together with
+    //! `size`, it allows detecting that a member changed type without
+    //! changing name.
+    struct record_column {
+        std::string name;
+        char kind;
+        std::uint64_t size;
+        std::uint64_t offset;
+
+        friend bool operator==(record_column const& a, record_column const& b) {
+            return a.name == b.name && a.kind == b.kind &&
+                   a.size == b.size && a.offset == b.offset;
+        }
+
+        friend bool operator!=(record_column const& a, record_column const& b)
+        { return !(a == b); }
+    };
+
+    namespace record_file_detail {
+        template <typename T>
+        constexpr char kind_of() {
+            return std::is_same<T, bool>{}          ? 'b' :
+                   std::is_enum<T>{}                ? 'e' :
+                   std::is_floating_point<T>{}      ? 'f' :
+                   std::is_integral<T>{} && std::is_signed<T>{} ? 'i' :
+                   std::is_integral<T>{}            ? 'u' :
+                                                      'a';
+        }
+
+        template <typename S>
+        struct describe_columns {
+            std::vector<record_column>* columns;
+
+            template <typename Member>
+            void operator()(Member const& member) const {
+                using T = std::decay_t<decltype(
+                    hana::second(member)(std::declval<S&>())
+                )>;
+                member_layout layout = hana::layout<S>()[columns->size()];
+                columns->push_back(record_column{
+                    hana::to<char const*>(hana::first(member)),
+                    kind_of<T>(), layout.size, layout.offset
+                });
+            }
+        };
+
+        // The first bytes of every record file. The last character is the
+        // version of the format.
+        constexpr char magic[8] = {'H', 'A', 'N', 'A', 'R', 'E', 'C', '1'};
+        constexpr std::uint32_t byte_order_mark = 0x01020304;
+
+        // The fixed part of the header; it is followed by the description
+        // of each column and by padding up to `header_size` bytes.
+        struct header {
+            char magic[8];
+            std::uint32_t byte_order_mark;
+            std::uint32_t column_count;
+            std::uint64_t header_size;
+            std::uint64_t record_size;
+            std::uint64_t record_alignment;
+            std::uint64_t record_count;
+            std::uint64_t schema_hash;
+        };
+
+        // The records start at a multiple of this many bytes, which is
+        // enough for any reasonable alignment requirement.
+        constexpr std::size_t data_alignment = 64;
+
+        template <typename T>
+        void put(std::string& out, T const& x) {
+            out.append(reinterpret_cast<char const*>(&x), sizeof(x));
+        }
+
+        template <typename T>
+        T get(char const*& p, char const* last) {
+            if (static_cast<std::size_t>(last - p) < sizeof(T))
+                throw record_file_error{"record file: truncated header"};
+            T x;
+            std::memcpy(&x, p, sizeof(T));
+            p += sizeof(T);
+            return x;
+        }
+
+        inline std::string encode_columns(std::vector<record_column> const& columns) {
+            std::string out;
+            for (auto const& c : columns) {
+                put(out, static_cast<std::uint32_t>(c.name.size()));
+                out += c.name;
+                out += c.kind;
+                put(out, c.size);
+                put(out, c.offset);
+            }
+            return out;
+        }
+
+        inline std::uint64_t
+        hash_schema(std::vector<record_column> const& columns,
+                    std::uint64_t record_size)
+        {
+            std::string bytes = encode_columns(columns);
+            put(bytes, record_size);
+            return hash_detail::bytes(bytes.data(), bytes.size());
+        }
+
+#ifdef BOOST_HANA_EXPERIMENTAL_RECORD_FILE_USE_MMAP
+        // A read-only mapping of a whole file. Mappings start on a page
+        // boundary, so they are aligned for any record.
+        class mapping {
+            void* address_ = nullptr;
+            std::size_t size_ = 0;
+
+        public:
+            mapping(std::string const& path, std::size_t /* alignment */) {
+                int fd = ::open(path.c_str(), O_RDONLY);
+                if (fd < 0)
+                    throw record_file_error{"record file: can't open " + path};
+                struct ::stat info;
+                if (::fstat(fd, &info) != 0) {
+                    ::close(fd);
+                    throw record_file_error{"record file: can't stat " + path};
+                }
+                size_ = static_cast<std::size_t>(info.st_size);
+                if (size_ != 0) {
+                    address_ = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+                    if (address_ == MAP_FAILED) {
+                        address_ = nullptr;
+                        ::close(fd);
+                        throw record_file_error{"record file: can't map " + path};
+                    }
+                }
+                ::close(fd);
+            }
+
+            mapping(mapping&& other) noexcept
+                : address_(other.address_), size_(other.size_)
+            { other.address_ = nullptr; other.size_ = 0; }
+
+            mapping& operator=(mapping&& other) noexcept {
+                std::swap(address_, other.address_);
+                std::swap(size_, other.size_);
+                return *this;
+            }
+
+            ~mapping() {
+                if (address_)
+                    ::munmap(address_, size_);
+            }
+
+            char const* data() const
+            { return static_cast<char const*>(address_); }
+
+            std::size_t size() const { return size_; }
+        };
+#else
+        // Without `mmap`, the whole file is read in a buffer whose start is
+        // aligned on `alignment` bytes, which is the alignment of the records.
+        class mapping {
+            std::vector<char> buffer_;
+            std::size_t offset_ = 0;
+            std::size_t size_ = 0;
+
+        public:
+            mapping(std::string const& path, std::size_t alignment) {
+                std::FILE* file = std::fopen(path.c_str(), "rb");
+                if (!file)
+                    throw record_file_error{"record file: can't open " + path};
+                bool ok = std::fseek(file, 0, SEEK_END) == 0;
+                long size = ok ? std::ftell(file) : -1;
+                ok = size >= 0 && std::fseek(file, 0, SEEK_SET) == 0;
+                if (ok) {
+                    size_ = static_cast<std::size_t>(size);
+                    buffer_.resize(size_ + alignment - 1);
+                    void* start = buffer_.data();
+                    std::size_t space = buffer_.size();
+                    std::align(alignment, size_, start, space);
+                    offset_ = static_cast<std::size_t>(
+                        static_cast<char*>(start) - buffer_.data());
+                    ok = std::fread(start, 1, size_, file) == size_;
+                }
+                std::fclose(file);
+                if (!ok)
+                    throw record_file_error{"record file: can't read " + path};
+            }
+
+            char const* data() const { return buffer_.data() + offset_; }
+
+            std::size_t size() const { return size_; }
+        };
+#endif
+
+        // Copies `size` bytes from offset `from` of a stored record to
+        // offset `to` of a `Struct`.
+        struct copy_step {
+            std::size_t from;
+            std::size_t to;
+            std::size_t size;
+        };
+    }
+
+    //! Returns the description of the members of a `Struct`, as they are
+    //! written in the header of a record file.
+    //!
+    //! `S` must be a trivially copyable `Struct` whose keys are
+    //! compile-time `String`s and whose members have known offsets, i.e.
+    //! for which `hana::layout<S>()` is valid.
+    template <typename S>
+    std::vector<record_column> record_schema() {
+        static_assert(std::is_trivially_copyable<S>{},
+        "record files can only store trivially copyable Structs");
+
+        std::vector<record_column> columns;
+        hana::for_each(hana::accessors<S>(),
+            record_file_detail::describe_columns<S>{&columns});
+        return columns;
+    }
+
+    //! Returns the hash of the description of the members of a `Struct`,
+    //! as it is written in the header of a record file.
+    //!
+    //! Unlike `hana::hash`, the schema hash is stable across executions
+    //! of a program and across programs, as long as they are compiled for
+    //! the same platform.
+    template <typename S>
+    std::uint64_t record_schema_hash() {
+        return record_file_detail::hash_schema(record_schema<S>(), sizeof(S));
+    }
+
+    //! Writes an array of `Struct`s to a record file.
+    //!
+    //! A record file is made of a header describing `S`, followed by the
+    //! object representations of the records, in order. The header holds
+    //! the name, kind, size and offset of each member of `S` as given by
+    //! `accessors<S>()` and `layout<S>()`, the size and alignment of `S`,
+    //! the number of records, and a hash of all this called the schema
+    //! hash. The records are written with their padding bytes, which
+    //! should be initialized if the file is to be shared.
+    //!
+    //! Records are appended with `write`. The number of records is
+    //! written in the header by `close`, which is called by the destructor
+    //! when it wasn't called explicitly. However, errors are only reported
+    //! when `close` is called explicitly.
+    //!
+    //! Numbers are written with the native byte order of the machine, and
+    //! files written on a machine with a different byte order are rejected
+    //! by `mapped_records`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/experimental/record_file.cpp write
+    template <typename S>
+    class record_writer {
+        std::FILE* file_;
+        std::uint64_t count_ = 0;
+
+        void fail(char const* what) {
+            if (file_) {
+                std::fclose(file_);
+                file_ = nullptr;
+            }
+            throw record_file_error{what};
+        }
+
+    public:
+        explicit record_writer(std::string const& path)
+            : file_(std::fopen(path.c_str(), "wb"))
+        {
+            namespace rfd = record_file_detail;
+            if (!file_)
+                throw record_file_error{"record file: can't create " + path};
+
+            std::vector<record_column> columns = record_schema<S>();
+            std::string encoded = rfd::encode_columns(columns);
+            std::size_t size = sizeof(rfd::header) + encoded.size();
+            std::size_t align = rfd::data_alignment > alignof(S)
+                                    ? rfd::data_alignment : alignof(S);
+            size = (size + align - 1) / align * align;
+
+            rfd::header h{};
+            std::memcpy(h.magic, rfd::magic, sizeof(h.magic));
+            h.byte_order_mark = rfd::byte_order_mark;
+            h.column_count = static_cast<std::uint32_t>(columns.size());
+            h.header_size = size;
+            h.record_size = sizeof(S);
+            h.record_alignment = alignof(S);
+            h.record_count = 0;
+            h.schema_hash = rfd::hash_schema(columns, sizeof(S));
+
+            std::string bytes(reinterpret_cast<char const*>(&h), sizeof(h));
+            bytes += encoded;
+            bytes.resize(size, '\0');
+            if (std::fwrite(bytes.data(), 1, bytes.size(), file_) != bytes.size())
+                fail("record file: can't write the header");
+        }
+
+        record_writer(record_writer const&) = delete;
+        record_writer& operator=(record_writer const&) = delete;
+
+        ~record_writer() {
+            try { close(); } catch (record_file_error const&) { }
+        }
+
+        //! Appends `n` records stored contiguously at `records`.
+        void write(S const* records, std::size_t n) {
+            if (!file_)
+                throw record_file_error{"record file: the writer is closed"};
+            if (n != 0 && std::fwrite(records, sizeof(S), n, file_) != n)
+                fail("record file: can't write the records");
+            count_ += n;
+        }
+
+        //! Appends a single record.
+        void write(S const& record) { write(&record, 1); }
+
+        //! Returns the number of records written so far.
+        std::size_t size() const { return static_cast<std::size_t>(count_); }
+
+        //! Writes the number of records in the header and closes the file.
+        //! Does nothing if the file is already closed.
+        void close() {
+            if (!file_)
+                return;
+            if (std::fseek(file_, offsetof(record_file_detail::header,
+                                           record_count), SEEK_SET) != 0 ||
+                std::fwrite(&count_, sizeof(count_), 1, file_) != 1)
+                fail("record file: can't write the number of records");
+            std::FILE* file = file_;
+            file_ = nullptr;
+            if (std::fclose(file) != 0)
+                throw record_file_error{"record file: can't close the file"};
+        }
+    };
+
+    //! Writes `n` records to a new record file at `path`.
+    //! @relates record_writer
+    template <typename S>
+    void write_records(std::string const& path, S const* records, std::size_t n) {
+        record_writer<S> writer{path};
+        writer.write(records, n);
+        writer.close();
+    }
+
+    //! Maps a record file written by `record_writer` in memory.
+    //!
+    //! When the schema of the file is exactly the schema of `S`, which is
+    //! checked when the file is opened, the records are used in place:
+    //! `mapped_records` is then a random-access range of `S const&` and
+    //! accessing a record does not read or copy anything but the record
+    //! itself. Nothing is parsed, so opening a file costs the same no
+    //! matter how many records it holds, and the pages of the file are
+    //! only read from the disk when the corresponding records are used.
+    //! On platforms without `mmap`, the whole file is read in memory when
+    //! it is opened instead.
+    //!
+    //! When the schema of the file differs, for example because members
+    //! were added, removed or reordered since the file was written, only
+    //! `project` can be used. It copies the members of a stored record
+    //! that have the same name, kind and size as a member of `S` into an
+    //! `S`, and leaves the other members of `S` untouched.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/experimental/record_file.cpp read
+    template <typename S>
+    class mapped_records {
+        record_file_detail::mapping mapping_;
+        char const* records_ = nullptr;
+        std::size_t count_ = 0;
+        std::size_t record_size_ = 0;
+        std::uint64_t schema_hash_ = 0;
+        bool matches_ = false;
+        std::vector<record_column> columns_;
+        std::vector<record_file_detail::copy_step> steps_;
+
+        static void check(bool condition, char const* what)
+        { if (!condition) throw record_file_error{what}; }
+
+    public:
+        using value_type = S;
+        using reference = S const&;
+        using iterator = S const*;
+        using const_iterator = S const*;
+        using size_type = std::size_t;
+
+        explicit mapped_records(std::string const& path)
+            : mapping_(path, alignof(S))
+        {
+            namespace rfd = record_file_detail;
+            char const* first = mapping_.data();
+            char const* last = first + mapping_.size();
+            char const* p = first;
+
+            auto h = rfd::get<rfd::header>(p, last);
+            check(std::memcmp(h.magic, rfd::magic, sizeof(h.magic)) == 0,
+                  "record file: not a record file");
+            check(h.byte_order_mark == rfd::byte_order_mark,
+                  "record file: written with another byte order");
+            check(h.header_size >= sizeof(h) &&
+                  h.header_size <= mapping_.size() && h.record_size != 0,
+                  "record file: malformed header");
+            last = first + h.header_size;
+            for (std::uint32_t i = 0; i < h.column_count; ++i) {
+                record_column c;
+                auto length = rfd::get<std::uint32_t>(p, last);
+                check(length <= static_cast<std::size_t>(last - p),
+                      "record file: truncated header");
+                c.name.assign(p, length);
+                p += length;
+                c.kind = rfd::get<char>(p, last);
+                c.size = rfd::get<std::uint64_t>(p, last);
+                c.offset = rfd::get<std::uint64_t>(p, last);
+                check(c.offset <= h.record_size &&
+                      c.size <= h.record_size - c.offset,
+                      "record file: malformed header");
+                columns_.push_back(std::move(c));
+            }
+            check((mapping_.size() - h.header_size) / h.record_size >= h.record_count,
+                  "record file: truncated records");
+
+            records_ = first + h.header_size;
+            count_ = static_cast<std::size_t>(h.record_count);
+            record_size_ = static_cast<std::size_t>(h.record_size);
+            schema_hash_ = h.schema_hash;
+
+            std::vector<record_column> expected = record_schema<S>();
+            matches_ = h.record_size == sizeof(S) &&
+                       h.header_size % alignof(S) == 0 &&
+                       h.schema_hash == rfd::hash_schema(expected, sizeof(S)) &&
+                       columns_ == expected;
+
+            if (matches_) {
+                steps_.push_back(rfd::copy_step{0, 0, sizeof(S)});
+                return;
+            }
+            for (auto const& want : expected) {
+                for (auto const& have : columns_) {
+                    if (have.name != want.name || have.kind != want.kind ||
+                        have.size != want.size)
+                        continue;
+                    std::size_t from = static_cast<std::size_t>(have.offset);
+                    std::size_t to = static_cast<std::size_t>(want.offset);
+                    std::size_t size = static_cast<std::size_t>(want.size);
+                    if (!steps_.empty() &&
+                        steps_.back().from + steps_.back().size == from &&
+                        steps_.back().to + steps_.back().size == to)
+                        steps_.back().size += size;
+                    else
+                        steps_.push_back(rfd::copy_step{from, to, size});
+                    break;
+                }
+            }
+        }
+
+        //! Returns whether the schema of the file is the schema of `S`, in
+        //! which case the records can be accessed in place.
+        bool schema_matches() const { return matches_; }
+
+        //! Returns the schema hash stored in the file.
+        std::uint64_t schema_hash() const { return schema_hash_; }
+
+        //! Returns the description of the members stored in the file.
+        std::vector<record_column> const& columns() const { return columns_; }
+
+        //! Returns the number of records in the file.
+        std::size_t size() const { return count_; }
+        bool empty() const { return count_ == 0; }
+
+        //! Accesses the records in place.
+        //!
+        //! These functions may only be used when `schema_matches()`;
+        //! otherwise, they throw a `record_file_error`, except for
+        //! `operator[]` which does not check anything.
+        S const* data() const {
+            check(matches_, "record file: the schema does not match");
+            return reinterpret_cast<S const*>(records_);
+        }
+
+        S const* begin() const { return data(); }
+        S const* end() const { return data() + count_; }
+
+        S const& operator[](std::size_t i) const
+        { return reinterpret_cast<S const*>(records_)[i]; }
+
+        S const& at(std::size_t i) const {
+            check(i < count_, "record file: index out of range");
+            return data()[i];
+        }
+
+        //! Copies the members of the `i`-th record which are known to both
+        //! the file and `S` into `out`. This works whether the schemas
+        //! match or not.
+        void project(std::size_t i, S& out) const {
+            assert(i < count_ &&
+                "mapped_records::project(i) requires i to be less than size()");
+            char const* record = records_ + i * record_size_;
+            char* target = reinterpret_cast<char*>(&out);
+            for (auto const& step : steps_)
+                std::memcpy(target + step.to, record + step.from, step.size);
+        }
+
+        //! Returns the `i`-th record projected onto a value-initialized `S`.
+        S project(std::size_t i) const {
+            S out{};
+            project(i, out);
+            return out;
+        }
+    };
+}}} // end namespace boost::hana::experimental
+
+#endif // !BOOST_HANA_EXPERIMENTAL_RECORD_FILE_HPP
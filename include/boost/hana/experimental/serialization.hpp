@@ -0,0 +1,586 @@
+/*!
+@file
+Defines experimental facilities to serialize `Struct`s and `Sequence`s to a
+compact binary representation.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXPERIMENTAL_SERIALIZATION_HPP
+#define BOOST_HANA_EXPERIMENTAL_SERIALIZATION_HPP
+
+#include <boost/hana/core/datatype.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
+#include <boost/hana/detail/std/is_enum.hpp>
+#include <boost/hana/detail/std/is_member_pointer.hpp>
+#include <boost/hana/detail/std/is_pointer.hpp>
+#include <boost/hana/detail/std/is_same.hpp>
+#include <boost/hana/detail/std/is_trivially_copyable.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/detail/std/void_t.hpp>
+#include <boost/hana/detail/struct_layout.hpp>
+#include <boost/hana/detail/wrong.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/iterable.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/sequence.hpp>
+#include <boost/hana/struct.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace boost { namespace hana { namespace experimental {
+    //! Writes the binary representation of an object to a buffer.
+    //!
+    //! The binary representation of an object is defined as follows:
+    //! - Trivially copyable objects that are neither `Struct`s nor
+    //!   `Sequence`s are represented by their object representation, i.e.
+    //!   their `sizeof(T)` bytes. Enumerations are represented by the
+    //!   bytes of their underlying value, and `bool`s must be represented
+    //!   by the bytes of `false` or `true` when they are read.
+    //! - `Struct`s are represented by the concatenation of the
+    //!   representations of their members, in the order of `accessors`.
+    //!   Hence, padding bytes are never written.
+    //! - `Sequence`s are represented by the concatenation of the
+    //!   representations of their elements.
+    //! - `std::vector`s and `std::basic_string`s are represented by their
+    //!   number of elements as a 64-bit unsigned integer, followed by the
+    //!   representations of their elements.
+    //!
+    //! Numbers are written with the native byte order of the machine, so
+    //! the representation is not portable across platforms with different
+    //! byte orders or different sizes for the fundamental types.
+    //!
+    //! When the members of a `Struct` are defined with the
+    //! `BOOST_HANA_DEFINE_STRUCT` or the `BOOST_HANA_ADAPT_STRUCT` macros
+    //! and the `Struct` is standard-layout, the offsets of its members are
+    //! known at compile-time. In that case, runs of adjacent trivially
+    //! copyable members without padding between them are copied with a
+    //! single `std::memcpy`, and so are the elements of `std::vector`s of
+    //! trivially copyable types.
+    //!
+    //! Other types can be made serializable by specializing the
+    //! `experimental::serializer` template.
+    //!
+    //!
+    //! @param x
+    //! The object to serialize.
+    //!
+    //! @param out
+    //! Either a pointer to a buffer of at least `serialized_size(x)` bytes,
+    //! in which case a pointer past the last written byte is returned, or
+    //! a container of `char`s with `data()`, `size()` and `resize()` member
+    //! functions (like `std::string` or `std::vector<char>`), in which case
+    //! the representation is appended to the container.
+    //!
+    //!
+    //! ### Example
+    //! @snippet example/experimental/serialization.cpp serialize
+    template <typename T, typename = void>
+    struct serializer : serializer<T, when<true>> { };
+
+    struct _serialize {
+        template <typename T>
+        char* operator()(T const& x, char* out) const;
+
+        template <typename T, typename Buffer, typename = decltype(
+            std::declval<Buffer&>().resize(std::declval<Buffer&>().size())
+        )>
+        void operator()(T const& x, Buffer& out) const;
+    };
+
+    constexpr _serialize serialize{};
+
+    //! Returns the number of bytes written by `serialize` for an object.
+    //!
+    //! ### Example
+    //! @snippet example/experimental/serialization.cpp serialize
+    struct _serialized_size {
+        template <typename T>
+        detail::std::size_t operator()(T const& x) const
+        { return serializer<T>::size(x); }
+    };
+
+    constexpr _serialized_size serialized_size{};
+
+    //! Exception thrown by `deserialize` when the input is too short or
+    //! does not represent a valid object.
+    struct serialization_error : std::runtime_error {
+        using std::runtime_error::runtime_error;
+    };
+
+    //! Creates an object of type `T` from its binary representation.
+    //!
+    //! `deserialize<T>(first, last)` reads an object of type `T` from the
+    //! beginning of the range of bytes `[first, last)`; the number of bytes
+    //! consumed is the `serialized_size` of the returned object.
+    //! `deserialize<T>(in)` reads an object from a container with `data()`
+    //! and `size()` member functions, and it requires the whole container
+    //! to be consumed. In both cases, a `serialization_error` is thrown if
+    //! the input is too short or invalid.
+    //!
+    //!
+    //! ### Example
+    //! @snippet example/experimental/serialization.cpp deserialize
+    template <typename T>
+    struct _deserialize {
+        T operator()(char const* first, char const* last) const;
+
+        template <typename Buffer>
+        T operator()(Buffer const& in) const;
+    };
+
+    template <typename T>
+    constexpr _deserialize<T> deserialize{};
+
+    namespace serialization_detail {
+        [[noreturn]] inline void fail() {
+            throw serialization_error{
+                "hana::experimental::deserialize: unexpected end of input"
+            };
+        }
+
+        inline char const* check(char const* first, char const* last,
+                                 detail::std::size_t n)
+        {
+            if (static_cast<detail::std::size_t>(last - first) < n)
+                fail();
+            return first;
+        }
+
+        // Whether objects of type `T` are serialized as their bytes. Pointers
+        // are trivially copyable, but their value is meaningless elsewhere.
+        // `bool`s and enumerations are trivially copyable too, but not all
+        // their bytes make valid values, so they are read one by one.
+        template <typename T>
+        struct is_raw : detail::std::integral_constant<bool,
+            detail::std::is_trivially_copyable<T>{}() &&
+            !detail::std::is_pointer<T>{}() &&
+            !detail::std::is_member_pointer<T>{}() &&
+            !detail::std::is_enum<T>{}() &&
+            !detail::std::is_same<T, bool>{}() &&
+            !_models<Struct, T>{}() && !_models<Sequence, T>{}()
+        > { };
+
+        // The smallest number of bytes in the representation of an object
+        // of type `T`. Serializers may provide it with a `min_size()` static
+        // member function; otherwise, it is assumed to be 0.
+        template <typename T, typename = void>
+        struct min_size : detail::std::integral_constant<detail::std::size_t, 0> { };
+
+        template <typename T>
+        struct min_size<T, detail::std::void_t<decltype(serializer<T>::min_size())>>
+            : detail::std::integral_constant<detail::std::size_t,
+                serializer<T>::min_size()
+            >
+        { };
+
+        template <typename ...T>
+        constexpr detail::std::size_t sum_min_sizes() {
+            detail::std::size_t sizes[] = {0, min_size<T>::value...};
+            detail::std::size_t n = 0;
+            for (detail::std::size_t s : sizes)
+                n += s;
+            return n;
+        }
+
+        struct min_size_of_elements {
+            template <typename ...X>
+            constexpr detail::std::integral_constant<detail::std::size_t,
+                sum_min_sizes<typename std::decay<X>::type...>()
+            > operator()(X const& ...) const { return {}; }
+        };
+
+        template <typename S>
+        using layout_of = detail::struct_layout_of<S, is_raw>;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Default serializers
+    //////////////////////////////////////////////////////////////////////////
+    template <typename T, bool condition>
+    struct serializer<T, when<condition>> {
+        static_assert(detail::wrong<serializer<T>>{},
+        "hana::experimental::serialize(x, out) does not know how to serialize "
+        "an object of this type; specialize hana::experimental::serializer");
+    };
+
+    template <typename T>
+    struct serializer<T, when<serialization_detail::is_raw<T>{}()>> {
+        static constexpr detail::std::size_t min_size()
+        { return sizeof(T); }
+
+        static detail::std::size_t size(T const&)
+        { return sizeof(T); }
+
+        static char* write(char* out, T const& x) {
+            std::memcpy(out, &x, sizeof(T));
+            return out + sizeof(T);
+        }
+
+        static char const* read(char const* first, char const* last, T& x) {
+            serialization_detail::check(first, last, sizeof(T));
+            std::memcpy(&x, first, sizeof(T));
+            return first + sizeof(T);
+        }
+    };
+
+    // A `bool` is represented by its bytes, which must be those of either
+    // `false` or `true` when it is read.
+    template <>
+    struct serializer<bool> {
+        static constexpr detail::std::size_t min_size()
+        { return sizeof(bool); }
+
+        static detail::std::size_t size(bool const&)
+        { return sizeof(bool); }
+
+        static char* write(char* out, bool const& x) {
+            std::memcpy(out, &x, sizeof(bool));
+            return out + sizeof(bool);
+        }
+
+        static char const* read(char const* first, char const* last, bool& x) {
+            serialization_detail::check(first, last, sizeof(bool));
+            bool const values[] = {false, true};
+            if (std::memcmp(first, &values[0], sizeof(bool)) == 0)
+                x = false;
+            else if (std::memcmp(first, &values[1], sizeof(bool)) == 0)
+                x = true;
+            else
+                throw serialization_error{
+                    "hana::experimental::deserialize: invalid bool"
+                };
+            return first + sizeof(bool);
+        }
+    };
+
+    // An enumeration is represented by the bytes of its underlying value.
+    // It is read back by converting the underlying value to the
+    // enumeration, which is valid for any value when the enumeration has
+    // a fixed underlying type.
+    template <typename T>
+    struct serializer<T, when<detail::std::is_enum<T>{}()>> {
+        using Underlying = typename std::underlying_type<T>::type;
+
+        static constexpr detail::std::size_t min_size()
+        { return sizeof(Underlying); }
+
+        static detail::std::size_t size(T const&)
+        { return sizeof(Underlying); }
+
+        static char* write(char* out, T const& x) {
+            Underlying const u = static_cast<Underlying>(x);
+            std::memcpy(out, &u, sizeof(u));
+            return out + sizeof(u);
+        }
+
+        static char const* read(char const* first, char const* last, T& x) {
+            Underlying u;
+            serialization_detail::check(first, last, sizeof(u));
+            std::memcpy(&u, first, sizeof(u));
+            x = static_cast<T>(u);
+            return first + sizeof(u);
+        }
+    };
+
+    namespace serialization_detail {
+        // Serializer for the containers with contiguous storage.
+        template <typename Container, typename T>
+        struct contiguous_serializer {
+            static constexpr detail::std::size_t min_size()
+            { return sizeof(std::uint64_t); }
+
+            static detail::std::size_t size(Container const& xs) {
+                if (is_raw<T>{})
+                    return sizeof(std::uint64_t) + xs.size() * sizeof(T);
+                detail::std::size_t n = sizeof(std::uint64_t);
+                for (auto const& x : xs)
+                    n += serializer<T>::size(x);
+                return n;
+            }
+
+            static char* write_elements(char* out, Container const& xs, detail::std::true_type) {
+                std::size_t const n = xs.size() * sizeof(T);
+                if (n != 0)
+                    std::memcpy(out, &xs[0], n);
+                return out + n;
+            }
+
+            static char* write_elements(char* out, Container const& xs, detail::std::false_type) {
+                for (auto const& x : xs)
+                    out = serializer<T>::write(out, x);
+                return out;
+            }
+
+            static char* write(char* out, Container const& xs) {
+                std::uint64_t const n = xs.size();
+                std::memcpy(out, &n, sizeof(n));
+                return write_elements(out + sizeof(n), xs, is_raw<T>{});
+            }
+
+            static char const* read_elements(char const* first, char const* last,
+                                             Container& xs, detail::std::true_type)
+            {
+                std::size_t const n = xs.size() * sizeof(T);
+                check(first, last, n);
+                if (n != 0)
+                    std::memcpy(&xs[0], first, n);
+                return first + n;
+            }
+
+            static char const* read_elements(char const* first, char const* last,
+                                             Container& xs, detail::std::false_type)
+            {
+                for (auto& x : xs)
+                    first = serializer<T>::read(first, last, x);
+                return first;
+            }
+
+            static char const* read(char const* first, char const* last, Container& xs) {
+                std::uint64_t n;
+                check(first, last, sizeof(n));
+                std::memcpy(&n, first, sizeof(n));
+                first += sizeof(n);
+                // Don't trust the length prefix blindly; a corrupted one
+                // would make us allocate an arbitrary amount of memory. When
+                // each element takes at least a byte, no valid input can
+                // hold more elements than fit in the bytes left. Elements
+                // represented by no bytes at all, like empty tuples, can't
+                // be bounded that way.
+                constexpr std::uint64_t element =
+                    serialization_detail::min_size<T>::value;
+                std::uint64_t const available =
+                    static_cast<std::uint64_t>(last - first);
+                if (element != 0 && n > available / element)
+                    fail();
+                xs.resize(static_cast<detail::std::size_t>(n));
+                return read_elements(first, last, xs, is_raw<T>{});
+            }
+        };
+    }
+
+    template <typename T, typename Allocator>
+    struct serializer<std::vector<T, Allocator>>
+        : serialization_detail::contiguous_serializer<std::vector<T, Allocator>, T>
+    { };
+
+    template <typename Char, typename Traits, typename Allocator>
+    struct serializer<std::basic_string<Char, Traits, Allocator>>
+        : serialization_detail::contiguous_serializer<
+            std::basic_string<Char, Traits, Allocator>, Char
+        >
+    { };
+
+    template <typename S>
+    struct serializer<S, when<_models<Sequence, S>{}()>> {
+        static constexpr detail::std::size_t min_size() {
+            return decltype(hana::unpack(
+                std::declval<S const&>(),
+                serialization_detail::min_size_of_elements{}
+            ))::value;
+        }
+
+        template <typename Xs>
+        static detail::std::size_t size(Xs const& xs) {
+            return hana::unpack(xs, [](auto const& ...x) {
+                detail::std::size_t sizes[] = {0, serializer<
+                    typename std::decay<decltype(x)>::type
+                >::size(x)...};
+                detail::std::size_t n = 0;
+                for (detail::std::size_t s : sizes)
+                    n += s;
+                return n;
+            });
+        }
+
+        template <typename Xs>
+        static char* write(char* out, Xs const& xs) {
+            hana::for_each(xs, [&](auto const& x) {
+                out = serializer<typename std::decay<decltype(x)>::type>::write(out, x);
+            });
+            return out;
+        }
+
+        template <typename Xs>
+        static char const* read(char const* first, char const* last, Xs& xs) {
+            hana::for_each(xs, [&](auto& x) {
+                using T = typename std::decay<decltype(x)>::type;
+                first = serializer<T>::read(first, last, x);
+            });
+            return first;
+        }
+    };
+
+    template <typename S>
+    struct serializer<S, when<_models<Struct, S>{}()>> {
+        using Layout = serialization_detail::layout_of<S>;
+        using Indices = detail::std::make_index_sequence<Layout::n>;
+
+        template <detail::std::size_t i>
+        static decltype(auto) member(S const& x) {
+            return hana::second(hana::at_c<i>(
+                hana::accessors<typename datatype<S>::type>()
+            ))(x);
+        }
+
+        template <detail::std::size_t i>
+        static decltype(auto) member(S& x) {
+            return hana::second(hana::at_c<i>(
+                hana::accessors<typename datatype<S>::type>()
+            ))(x);
+        }
+
+        template <detail::std::size_t i>
+        using Member = typename std::decay<
+            decltype(member<i>(std::declval<S const&>()))
+        >::type;
+
+        // The members of a run other than the first one are handled
+        // with the first one, so there is nothing to do for them.
+        template <detail::std::size_t i>
+        static detail::std::size_t size_member(S const&, detail::in_run)
+        { return 0; }
+
+        template <detail::std::size_t i>
+        static detail::std::size_t size_member(S const& x, detail::alone)
+        { return serializer<Member<i>>::size(member<i>(x)); }
+
+        template <detail::std::size_t i>
+        static detail::std::size_t size_member(S const&, detail::run_start)
+        { return Layout::run_bytes(i); }
+
+        template <detail::std::size_t i>
+        static char* write_member(char* out, S const&, detail::in_run)
+        { return out; }
+
+        template <detail::std::size_t i>
+        static char* write_member(char* out, S const& x, detail::alone)
+        { return serializer<Member<i>>::write(out, member<i>(x)); }
+
+        template <detail::std::size_t i>
+        static char* write_member(char* out, S const& x, detail::run_start) {
+            constexpr detail::std::size_t n = Layout::run_bytes(i);
+            std::memcpy(out, &member<i>(x), n);
+            return out + n;
+        }
+
+        template <detail::std::size_t i>
+        static char const*
+        read_member(char const* first, char const*, S&, detail::in_run)
+        { return first; }
+
+        template <detail::std::size_t i>
+        static char const*
+        read_member(char const* first, char const* last, S& x, detail::alone)
+        { return serializer<Member<i>>::read(first, last, member<i>(x)); }
+
+        template <detail::std::size_t i>
+        static char const*
+        read_member(char const* first, char const* last, S& x, detail::run_start) {
+            constexpr detail::std::size_t n = Layout::run_bytes(i);
+            serialization_detail::check(first, last, n);
+            std::memcpy(&member<i>(x), first, n);
+            return first + n;
+        }
+
+        template <detail::std::size_t i>
+        using Kind = detail::run_kind<Layout::run_end(i), i>;
+
+        template <detail::std::size_t ...i>
+        static constexpr detail::std::size_t
+        min_size_impl(detail::std::index_sequence<i...>)
+        { return serialization_detail::sum_min_sizes<Member<i>...>(); }
+
+        template <detail::std::size_t ...i>
+        static detail::std::size_t size_impl(S const& x, detail::std::index_sequence<i...>) {
+            detail::std::size_t sizes[] = {0, size_member<i>(x, Kind<i>{})...};
+            detail::std::size_t n = 0;
+            for (detail::std::size_t s : sizes)
+                n += s;
+            return n;
+        }
+
+        template <detail::std::size_t ...i>
+        static char* write_impl(char* out, S const& x, detail::std::index_sequence<i...>) {
+            using swallow = int[];
+            (void)swallow{0, ((void)(out = write_member<i>(out, x, Kind<i>{})), 0)...};
+            return out;
+        }
+
+        template <detail::std::size_t ...i>
+        static char const* read_impl(char const* first, char const* last, S& x,
+                                     detail::std::index_sequence<i...>)
+        {
+            using swallow = int[];
+            (void)swallow{0,
+                ((void)(first = read_member<i>(first, last, x, Kind<i>{})), 0)...
+            };
+            return first;
+        }
+
+        static constexpr detail::std::size_t min_size()
+        { return min_size_impl(Indices{}); }
+
+        static detail::std::size_t size(S const& x)
+        { return size_impl(x, Indices{}); }
+
+        static char* write(char* out, S const& x)
+        { return write_impl(out, x, Indices{}); }
+
+        static char const* read(char const* first, char const* last, S& x)
+        { return read_impl(first, last, x, Indices{}); }
+    };
+
+    //! @cond
+    template <typename T>
+    char* _serialize::operator()(T const& x, char* out) const {
+        return serializer<T>::write(out, x);
+    }
+
+    template <typename T, typename Buffer, typename>
+    void _serialize::operator()(T const& x, Buffer& out) const {
+        auto const offset = out.size();
+        auto const n = serializer<T>::size(x);
+        if (n == 0)
+            return;
+        out.resize(offset + n);
+        serializer<T>::write(&out[0] + offset, x);
+    }
+
+    template <typename T>
+    T _deserialize<T>::operator()(char const* first, char const* last) const {
+        T x{};
+        serializer<T>::read(first, last, x);
+        return x;
+    }
+
+    template <typename T>
+    template <typename Buffer>
+    T _deserialize<T>::operator()(Buffer const& in) const {
+        T x{};
+        char const* const first = reinterpret_cast<char const*>(in.data());
+        char const* const last = first + in.size();
+        if (serializer<T>::read(first, last, x) != last)
+            throw serialization_error{
+                "hana::experimental::deserialize: unexpected trailing bytes"
+            };
+        return x;
+    }
+    //! @endcond
+}}} // end namespace boost::hana::experimental
+
+#endif // !BOOST_HANA_EXPERIMENTAL_SERIALIZATION_HPP
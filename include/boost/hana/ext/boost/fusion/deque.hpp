@@ -11,16 +11,21 @@ Distributed under the Boost Software License, Version 1.0.
 #define BOOST_HANA_EXT_BOOST_FUSION_DEQUE_HPP
 
 #include <boost/hana/core/datatype.hpp>
+#include <boost/hana/core/make.hpp>
 #include <boost/hana/core/when.hpp>
 #include <boost/hana/detail/std/integral_constant.hpp>
 #include <boost/hana/detail/std/is_same.hpp>
 #include <boost/hana/ext/boost/fusion/detail/common.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/functor.hpp>
 #include <boost/hana/iterable.hpp>
 #include <boost/hana/monad_plus.hpp>
+#include <boost/hana/searchable.hpp>
 
 #include <boost/fusion/algorithm/transformation/join.hpp>
 #include <boost/fusion/algorithm/transformation/pop_front.hpp>
 #include <boost/fusion/algorithm/transformation/push_front.hpp>
+#include <boost/fusion/container/generation/make_deque.hpp>
 #include <boost/fusion/container/deque.hpp>
 #include <boost/fusion/container/deque/convert.hpp>
 #include <boost/fusion/support/tag_of.hpp>
@@ -56,9 +61,59 @@ namespace boost { namespace hana {
         { };
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    // make
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct make_impl<ext::boost::fusion::Deque> {
+        template <typename ...Xs>
+        static constexpr auto apply(Xs&& ...xs) {
+            return ::boost::fusion::make_deque(static_cast<Xs&&>(xs)...);
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct unpack_impl<ext::boost::fusion::Deque>
+        : fusion_detail::unpack
+    { };
+
+    template <>
+    struct length_impl<ext::boost::fusion::Deque>
+        : fusion_detail::length
+    { };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Functor
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct transform_impl<ext::boost::fusion::Deque>
+        : fusion_detail::transform<ext::boost::fusion::Deque>
+    { };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Searchable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct find_if_impl<ext::boost::fusion::Deque>
+        : fusion_detail::find_if
+    { };
+
+    template <>
+    struct any_of_impl<ext::boost::fusion::Deque>
+        : fusion_detail::any_of
+    { };
+
     //////////////////////////////////////////////////////////////////////////
     // Iterable (the rest is in detail/common.hpp)
     //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct at_impl<ext::boost::fusion::Deque>
+        : fusion_detail::at
+    { };
+
     template <>
     struct tail_impl<ext::boost::fusion::Deque> {
         template <typename Xs>
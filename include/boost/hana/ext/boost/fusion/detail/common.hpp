@@ -11,14 +11,28 @@ Distributed under the Boost Software License, Version 1.0.
 #define BOOST_HANA_EXT_BOOST_FUSION_DETAIL_COMMON_HPP
 
 #include <boost/hana/bool.hpp>
+#include <boost/hana/core/make.hpp>
 #include <boost/hana/core/models.hpp>
 #include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/find_index.hpp>
+#include <boost/hana/detail/get_element.hpp>
+#include <boost/hana/detail/std/declval.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
 #include <boost/hana/detail/std/move.hpp>
+#include <boost/hana/detail/std/remove_cv.hpp>
+#include <boost/hana/detail/std/remove_reference.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/iterable.hpp>
+#include <boost/hana/maybe.hpp>
 #include <boost/hana/sequence.hpp>
 
+#include <boost/fusion/sequence/intrinsic/at_c.hpp>
 #include <boost/fusion/sequence/intrinsic/empty.hpp>
 #include <boost/fusion/sequence/intrinsic/front.hpp>
+#include <boost/fusion/sequence/intrinsic/size.hpp>
+#include <boost/fusion/sequence/intrinsic/value_at.hpp>
 
 
 namespace boost { namespace hana {
@@ -63,6 +77,146 @@ namespace boost { namespace hana {
     struct models_impl<Sequence, S, when<detail::is_fusion_sequence<S>{}()>>
         : decltype(true_)
     { };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Methods for random access Fusion sequences
+    //
+    // The methods below access the elements with `fusion::at_c` through
+    // index expansion, instead of recursing on `tail`, which creates a new
+    // Fusion sequence at every step. They must only be used for sequences
+    // where `fusion::at_c` is a constant time operation, by explicitly
+    // specializing the corresponding `xxx_impl` to inherit from them.
+    //////////////////////////////////////////////////////////////////////////
+    namespace fusion_detail {
+        template <typename Xs>
+        using size = ::boost::fusion::result_of::size<
+            typename detail::std::remove_cv<
+                typename detail::std::remove_reference<Xs>::type
+            >::type
+        >;
+
+        template <typename Xs>
+        using indices = detail::std::make_index_sequence<size<Xs>::value>;
+
+        struct access {
+            template <detail::std::size_t n, typename Xs>
+            static constexpr decltype(auto) at(Xs& xs)
+            { return ::boost::fusion::at_c<n>(xs); }
+
+            template <detail::std::size_t n, typename Xs>
+            using element = typename ::boost::fusion::result_of::
+                            value_at_c<Xs, n>::type;
+        };
+
+        // Returns the `n`th element of `xs`, moving it out of `xs` if it is
+        // an rvalue, but never moving from the objects referenced by a
+        // sequence of references like `fusion::vector_tie(x, y)`.
+        template <detail::std::size_t n>
+        using get = detail::get_element<access, n>;
+
+        struct at {
+            template <typename Xs, typename N>
+            static constexpr decltype(auto) apply(Xs&& xs, N const&) {
+                constexpr detail::std::size_t n = hana::value<N>();
+                return get<n>::apply(static_cast<Xs&&>(xs));
+            }
+        };
+
+        struct length {
+            template <typename Xs>
+            static constexpr auto apply(Xs const&)
+            { return size_t<size<Xs>::value>; }
+        };
+
+        struct unpack {
+            template <typename Xs, typename F, detail::std::size_t ...i>
+            static constexpr decltype(auto)
+            unpack_helper(Xs&& xs, F&& f, detail::std::index_sequence<i...>) {
+                return static_cast<F&&>(f)(
+                    get<i>::apply(static_cast<Xs&&>(xs))...
+                );
+            }
+
+            template <typename Xs, typename F>
+            static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+                return unpack_helper(static_cast<Xs&&>(xs),
+                                     static_cast<F&&>(f), indices<Xs>{});
+            }
+        };
+
+        template <typename S>
+        struct transform {
+            template <typename Xs, typename F, detail::std::size_t ...i>
+            static constexpr decltype(auto)
+            transform_helper(Xs&& xs, F& f, detail::std::index_sequence<i...>) {
+                return hana::make<S>(f(get<i>::apply(static_cast<Xs&&>(xs)))...);
+            }
+
+            template <typename Xs, typename F>
+            static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+                return transform_helper(static_cast<Xs&&>(xs), f,
+                                        indices<Xs>{});
+            }
+        };
+
+        struct find_if {
+            template <typename Pred, typename Xs, detail::std::size_t ...i>
+            static constexpr detail::std::size_t
+            find_index(detail::std::index_sequence<i...>) {
+                return detail::first_true<
+                    detail::satisfies<Pred, decltype(
+                        get<i>::apply(detail::std::declval<Xs>())
+                    )>()...
+                >();
+            }
+
+            template <detail::std::size_t, typename Xs>
+            static constexpr auto find_helper(Xs&&, decltype(false_))
+            { return nothing; }
+
+            template <detail::std::size_t index, typename Xs>
+            static constexpr auto find_helper(Xs&& xs, decltype(true_))
+            { return hana::just(get<index>::apply(static_cast<Xs&&>(xs))); }
+
+            template <typename Xs, typename Pred>
+            static constexpr auto apply(Xs&& xs, Pred&&) {
+                constexpr detail::std::size_t index =
+                                    find_index<Pred, Xs>(indices<Xs>{});
+                return find_helper<index>(static_cast<Xs&&>(xs),
+                                          bool_<(index < size<Xs>::value)>);
+            }
+        };
+
+        struct any_of {
+            template <typename Xs, typename Pred, detail::std::size_t ...i>
+            static constexpr auto any_of_helper(Xs&&, Pred&,
+                detail::std::index_sequence<i...> is, decltype(true_))
+            {
+                return bool_<(find_if::find_index<Pred, Xs>(is) <
+                              sizeof...(i))>;
+            }
+
+            template <typename Xs, typename Pred, detail::std::size_t ...i>
+            static constexpr bool any_of_helper(Xs&& xs, Pred& pred,
+                detail::std::index_sequence<i...>, decltype(false_))
+            { return detail::any_satisfies(pred, get<i>::apply(xs)...); }
+
+            template <typename Xs, typename Pred, detail::std::size_t ...i>
+            static constexpr auto compile_time(detail::std::index_sequence<i...>) {
+                return bool_<detail::returns_constants<Pred, decltype(
+                    get<i>::apply(detail::std::declval<Xs>()))...>()>;
+            }
+
+            // Like find_if when the predicate returns compile-time Logicals;
+            // otherwise, the predicate is called on each element until it
+            // returns true.
+            template <typename Xs, typename Pred>
+            static constexpr auto apply(Xs&& xs, Pred&& pred) {
+                return any_of_helper(static_cast<Xs&&>(xs), pred, indices<Xs>{},
+                                     compile_time<Xs, Pred>(indices<Xs>{}));
+            }
+        };
+    }
 }} // end namespace boost::hana
 
 #endif // !BOOST_HANA_EXT_BOOST_FUSION_DETAIL_COMMON_HPP
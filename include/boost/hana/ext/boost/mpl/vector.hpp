@@ -13,19 +13,26 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/comparable.hpp>
 #include <boost/hana/core/convert.hpp>
 #include <boost/hana/core/datatype.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
 #include <boost/hana/detail/std/is_same.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
 #include <boost/hana/ext/boost/mpl/integral_c.hpp>
 #include <boost/hana/foldable.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/iterable.hpp>
 #include <boost/hana/searchable.hpp>
+#include <boost/hana/tuple.hpp>
 #include <boost/hana/type.hpp>
 
+#include <boost/mpl/at.hpp>
 #include <boost/mpl/empty.hpp>
 #include <boost/mpl/front.hpp>
 #include <boost/mpl/pop_front.hpp>
 #include <boost/mpl/push_front.hpp>
 #include <boost/mpl/equal.hpp>
 #include <boost/mpl/sequence_tag.hpp>
+#include <boost/mpl/size.hpp>
 #include <boost/mpl/vector.hpp>
 
 
@@ -106,26 +113,36 @@ namespace boost { namespace hana {
 
     //////////////////////////////////////////////////////////////////////////
     // Foldable
+    //
+    // The whole vector is unpacked at once by accessing its elements with
+    // `mpl::at_c`, which does not create intermediate vectors. The folds
+    // and the other methods of Foldable are implemented with `unpack` by
+    // default.
     //////////////////////////////////////////////////////////////////////////
     template <>
-    struct fold_left_impl<ext::boost::mpl::Vector>
-        : Iterable::fold_left_impl<ext::boost::mpl::Vector>
-    { };
-
-    template <>
-    struct fold_right_impl<ext::boost::mpl::Vector>
-        : Iterable::fold_right_impl<ext::boost::mpl::Vector>
-    { };
+    struct unpack_impl<ext::boost::mpl::Vector> {
+        template <typename Xs, typename F, detail::std::size_t ...i>
+        static constexpr decltype(auto)
+        unpack_helper(F&& f, detail::std::index_sequence<i...>) {
+            return static_cast<F&&>(f)(
+                type<typename ::boost::mpl::at_c<Xs, i>::type>...
+            );
+        }
 
-    template <>
-    struct fold_left_nostate_impl<ext::boost::mpl::Vector>
-        : Iterable::fold_left_nostate_impl<ext::boost::mpl::Vector>
-    { };
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs, F&& f) {
+            constexpr detail::std::size_t size = ::boost::mpl::size<Xs>::value;
+            return unpack_helper<Xs>(static_cast<F&&>(f),
+                            detail::std::make_index_sequence<size>{});
+        }
+    };
 
     template <>
-    struct fold_right_nostate_impl<ext::boost::mpl::Vector>
-        : Iterable::fold_right_nostate_impl<ext::boost::mpl::Vector>
-    { };
+    struct length_impl<ext::boost::mpl::Vector> {
+        template <typename Xs>
+        static constexpr auto apply(Xs)
+        { return size_t< ::boost::mpl::size<Xs>::value>; }
+    };
 
     //////////////////////////////////////////////////////////////////////////
     // Iterable
@@ -151,18 +168,37 @@ namespace boost { namespace hana {
         { return typename ::boost::mpl::empty<xs>::type{}; }
     };
 
+    template <>
+    struct at_impl<ext::boost::mpl::Vector> {
+        template <typename Xs, typename N>
+        static constexpr auto apply(Xs, N const&) {
+            constexpr detail::std::size_t n = hana::value<N>();
+            return type<typename ::boost::mpl::at_c<Xs, n>::type>;
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Searchable
+    //
+    // The vector is searched as the `Tuple` of `Type`s it is unpacked to.
     //////////////////////////////////////////////////////////////////////////
     template <>
-    struct find_if_impl<ext::boost::mpl::Vector>
-        : Iterable::find_if_impl<ext::boost::mpl::Vector>
-    { };
+    struct find_if_impl<ext::boost::mpl::Vector> {
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs xs, Pred&& pred) {
+            return hana::find_if(hana::unpack(xs, hana::make<Tuple>),
+                                 static_cast<Pred&&>(pred));
+        }
+    };
 
     template <>
-    struct any_of_impl<ext::boost::mpl::Vector>
-        : Iterable::any_of_impl<ext::boost::mpl::Vector>
-    { };
+    struct any_of_impl<ext::boost::mpl::Vector> {
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs xs, Pred&& pred) {
+            return hana::any_of(hana::unpack(xs, hana::make<Tuple>),
+                                static_cast<Pred&&>(pred));
+        }
+    };
 
     //////////////////////////////////////////////////////////////////////////
     // Conversion from a Foldable
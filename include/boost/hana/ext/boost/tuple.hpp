@@ -13,7 +13,14 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/bool.hpp>
 #include <boost/hana/core/datatype.hpp>
 #include <boost/hana/core/models.hpp>
+#include <boost/hana/detail/get_element.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
 #include <boost/hana/detail/std/move.hpp>
+#include <boost/hana/detail/std/remove_cv.hpp>
+#include <boost/hana/detail/std/remove_reference.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/iterable.hpp>
 #include <boost/hana/monad_plus.hpp>
 #include <boost/hana/sequence.hpp>
@@ -39,9 +46,74 @@ namespace boost { namespace hana {
         using type = ext::boost::Tuple;
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //
+    // The elements are accessed with `tuples::get` through index expansion,
+    // so that the whole tuple is unpacked in a single step instead of
+    // walking through its `cons` cells with `head` and `tail`.
+    //////////////////////////////////////////////////////////////////////////
+    namespace boost_tuple_detail {
+        template <typename Xs>
+        using size = ::boost::tuples::length<
+            typename detail::std::remove_cv<
+                typename detail::std::remove_reference<Xs>::type
+            >::type
+        >;
+
+        struct access {
+            template <detail::std::size_t n, typename Xs>
+            static constexpr decltype(auto) at(Xs& xs)
+            { return ::boost::tuples::get<n>(xs); }
+
+            template <detail::std::size_t n, typename Xs>
+            using element = typename ::boost::tuples::element<n, Xs>::type;
+        };
+
+        // Returns the `n`th element of `xs`, moving it out of `xs` if it is
+        // an rvalue, but never moving from the objects referenced by a
+        // tuple of references like `boost::tie(x, y)`.
+        template <detail::std::size_t n>
+        using get = detail::get_element<access, n>;
+    }
+
+    template <>
+    struct unpack_impl<ext::boost::Tuple> {
+        template <typename Xs, typename F, detail::std::size_t ...i>
+        static constexpr decltype(auto)
+        unpack_helper(Xs&& xs, F&& f, detail::std::index_sequence<i...>) {
+            return static_cast<F&&>(f)(
+                boost_tuple_detail::get<i>::apply(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            constexpr detail::std::size_t size = boost_tuple_detail::size<Xs>::value;
+            return unpack_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                                 detail::std::make_index_sequence<size>{});
+        }
+    };
+
+    template <>
+    struct length_impl<ext::boost::Tuple> {
+        template <typename Xs>
+        static constexpr auto apply(Xs const&)
+        { return size_t<boost_tuple_detail::size<Xs>::value>; }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Iterable
     //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct at_impl<ext::boost::Tuple> {
+        template <typename Xs, typename N>
+        static constexpr decltype(auto) apply(Xs&& xs, N const&) {
+            constexpr detail::std::size_t n = hana::value<N>();
+            return boost_tuple_detail::get<n>::apply(static_cast<Xs&&>(xs));
+        }
+    };
+
     template <>
     struct head_impl<ext::boost::Tuple> {
         template <typename Xs>
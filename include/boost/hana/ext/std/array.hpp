@@ -13,10 +13,23 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/bool.hpp>
 #include <boost/hana/core/datatype.hpp>
 #include <boost/hana/core/models.hpp>
+#include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/std/conditional.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/declval.hpp>
 #include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
+#include <boost/hana/detail/std/is_lvalue_reference.hpp>
+#include <boost/hana/detail/std/is_move_assignable.hpp>
+#include <boost/hana/detail/std/is_same.hpp>
 #include <boost/hana/detail/std/move.hpp>
 #include <boost/hana/detail/std/remove_reference.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/functor.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/iterable.hpp>
+#include <boost/hana/maybe.hpp>
+#include <boost/hana/searchable.hpp>
 #include <boost/hana/sequence.hpp>
 
 #include <array>
@@ -48,43 +61,317 @@ namespace boost { namespace hana {
 
     //////////////////////////////////////////////////////////////////////////
     // Foldable
+    //
+    // The elements of a `std::array` all have the same type. Folds whose
+    // function also keeps the type of the state are plain loops, and the
+    // other methods are implemented through index expansion. None of them
+    // goes through `head` and `tail`, which would create a new array at
+    // each step.
     //////////////////////////////////////////////////////////////////////////
+    namespace std_array_detail {
+        // The type of an element of the array `Xs`, forwarded with the
+        // value category of `Xs`.
+        template <typename Xs,
+                  typename X = decltype(detail::std::declval<Xs&>()[0])>
+        using element_t = typename detail::std::conditional<
+            detail::std::is_lvalue_reference<Xs>::value,
+            X, typename detail::std::remove_reference<X>::type&&
+        >::type;
+
+        // Whether calling `f` with the given arguments returns an object
+        // of type `State` which can be assigned to the state, which makes
+        // it possible to fold in a loop.
+        template <typename State, typename F, typename ...Args>
+        using keeps_state = detail::std::integral_constant<bool,
+            detail::std::is_same<
+                typename detail::std::decay<decltype(
+                    detail::std::declval<F&>()(detail::std::declval<Args>()...)
+                )>::type,
+                State
+            >{}() && detail::std::is_move_assignable<State>{}()
+        >;
+
+        template <typename Xs>
+        using size = ::std::tuple_size<
+            typename detail::std::remove_reference<Xs>::type
+        >;
+    }
+
     template <>
-    struct fold_left_impl<ext::std::Array>
-        : Iterable::fold_left_impl<ext::std::Array>
-    { };
+    struct unpack_impl<ext::std::Array> {
+        template <typename Xs, typename F, std::size_t ...i>
+        static constexpr decltype(auto)
+        unpack_helper(Xs&& xs, F&& f, detail::std::index_sequence<i...>) {
+            return static_cast<F&&>(f)(
+                ::std::get<i>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            return unpack_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                detail::std::make_index_sequence<std_array_detail::size<Xs>{}>{}
+            );
+        }
+    };
 
     template <>
-    struct fold_right_impl<ext::std::Array>
-        : Iterable::fold_right_impl<ext::std::Array>
-    { };
+    struct length_impl<ext::std::Array> {
+        template <typename T, std::size_t N>
+        static constexpr auto apply(::std::array<T, N> const&)
+        { return size_t<N>; }
+    };
 
     template <>
-    struct fold_left_nostate_impl<ext::std::Array>
-        : Iterable::fold_left_nostate_impl<ext::std::Array>
-    { };
+    struct fold_left_impl<ext::std::Array> {
+        template <typename Xs, typename State, typename F>
+        static constexpr State loop(Xs&& xs, State state, F& f) {
+            using X = std_array_detail::element_t<Xs>;
+            // `f` may return a reference to the state it was given, so its
+            // result is moved into a temporary before replacing the state.
+            for (std::size_t i = 0; i < xs.size(); ++i) {
+                State next = f(static_cast<State&&>(state), static_cast<X>(xs[i]));
+                state = static_cast<State&&>(next);
+            }
+            return state;
+        }
+
+        template <typename Xs, typename S, typename F>
+        static constexpr decltype(auto)
+        apply_impl(Xs&& xs, S&& s, F&& f, detail::std::true_type) {
+            return loop(static_cast<Xs&&>(xs),
+                        typename detail::std::decay<S>::type(static_cast<S&&>(s)),
+                        f);
+        }
+
+        template <typename Xs, typename S, typename F>
+        static constexpr decltype(auto)
+        apply_impl(Xs&& xs, S&& s, F&& f, detail::std::false_type) {
+            return fold_left_impl<ext::std::Array, when<true>>::apply(
+                static_cast<Xs&&>(xs), static_cast<S&&>(s), static_cast<F&&>(f));
+        }
+
+        template <typename Xs, typename S, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, S&& s, F&& f) {
+            using State = typename detail::std::decay<S>::type;
+            using Keeps = std_array_detail::keeps_state<State, F,
+                State&&, std_array_detail::element_t<Xs>
+            >;
+            return apply_impl(static_cast<Xs&&>(xs), static_cast<S&&>(s),
+                              static_cast<F&&>(f), Keeps{});
+        }
+    };
 
     template <>
-    struct fold_right_nostate_impl<ext::std::Array>
-        : Iterable::fold_right_nostate_impl<ext::std::Array>
-    { };
+    struct fold_right_impl<ext::std::Array> {
+        template <typename Xs, typename State, typename F>
+        static constexpr State loop(Xs&& xs, State state, F& f) {
+            using X = std_array_detail::element_t<Xs>;
+            for (std::size_t i = xs.size(); i != 0; --i) {
+                State next = f(static_cast<X>(xs[i - 1]), static_cast<State&&>(state));
+                state = static_cast<State&&>(next);
+            }
+            return state;
+        }
+
+        template <typename Xs, typename S, typename F>
+        static constexpr decltype(auto)
+        apply_impl(Xs&& xs, S&& s, F&& f, detail::std::true_type) {
+            return loop(static_cast<Xs&&>(xs),
+                        typename detail::std::decay<S>::type(static_cast<S&&>(s)),
+                        f);
+        }
+
+        template <typename Xs, typename S, typename F>
+        static constexpr decltype(auto)
+        apply_impl(Xs&& xs, S&& s, F&& f, detail::std::false_type) {
+            return fold_right_impl<ext::std::Array, when<true>>::apply(
+                static_cast<Xs&&>(xs), static_cast<S&&>(s), static_cast<F&&>(f));
+        }
+
+        template <typename Xs, typename S, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, S&& s, F&& f) {
+            using State = typename detail::std::decay<S>::type;
+            using Keeps = std_array_detail::keeps_state<State, F,
+                std_array_detail::element_t<Xs>, State&&
+            >;
+            return apply_impl(static_cast<Xs&&>(xs), static_cast<S&&>(s),
+                              static_cast<F&&>(f), Keeps{});
+        }
+    };
+
+    template <>
+    struct fold_left_nostate_impl<ext::std::Array> {
+        template <typename Xs, typename F>
+        static constexpr decltype(auto)
+        apply_impl(Xs&& xs, F&& f, detail::std::true_type) {
+            using X = std_array_detail::element_t<Xs>;
+            using State = typename detail::std::decay<X>::type;
+            State state(static_cast<X>(xs[0]));
+            for (std::size_t i = 1; i < xs.size(); ++i) {
+                State next = f(static_cast<State&&>(state), static_cast<X>(xs[i]));
+                state = static_cast<State&&>(next);
+            }
+            return state;
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto)
+        apply_impl(Xs&& xs, F&& f, detail::std::false_type) {
+            return fold_left_nostate_impl<ext::std::Array, when<true>>::apply(
+                static_cast<Xs&&>(xs), static_cast<F&&>(f));
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            static_assert(std_array_detail::size<Xs>{} != 0,
+            "hana::fold.left(xs, f) requires xs to be non-empty");
+            using X = std_array_detail::element_t<Xs>;
+            using State = typename detail::std::decay<X>::type;
+            using Keeps = std_array_detail::keeps_state<State, F, State&&, X>;
+            return apply_impl(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                              Keeps{});
+        }
+    };
+
+    template <>
+    struct fold_right_nostate_impl<ext::std::Array> {
+        template <typename Xs, typename F>
+        static constexpr decltype(auto)
+        apply_impl(Xs&& xs, F&& f, detail::std::true_type) {
+            using X = std_array_detail::element_t<Xs>;
+            using State = typename detail::std::decay<X>::type;
+            State state(static_cast<X>(xs[xs.size() - 1]));
+            for (std::size_t i = xs.size() - 1; i != 0; --i) {
+                State next = f(static_cast<X>(xs[i - 1]), static_cast<State&&>(state));
+                state = static_cast<State&&>(next);
+            }
+            return state;
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto)
+        apply_impl(Xs&& xs, F&& f, detail::std::false_type) {
+            return fold_right_nostate_impl<ext::std::Array, when<true>>::apply(
+                static_cast<Xs&&>(xs), static_cast<F&&>(f));
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            static_assert(std_array_detail::size<Xs>{} != 0,
+            "hana::fold.right(xs, f) requires xs to be non-empty");
+            using X = std_array_detail::element_t<Xs>;
+            using State = typename detail::std::decay<X>::type;
+            using Keeps = std_array_detail::keeps_state<State, F, X, State&&>;
+            return apply_impl(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                              Keeps{});
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Functor
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct transform_impl<ext::std::Array> {
+        template <typename Xs, typename F, std::size_t ...i>
+        static constexpr auto
+        transform_helper(Xs&& xs, F& f, detail::std::index_sequence<i...>) {
+            using U = typename detail::std::decay<decltype(
+                f(detail::std::declval<std_array_detail::element_t<Xs>>())
+            )>::type;
+            return ::std::array<U, sizeof...(i)>{{
+                f(::std::get<i>(static_cast<Xs&&>(xs)))...
+            }};
+        }
+
+        template <typename Xs, typename F>
+        static constexpr auto apply(Xs&& xs, F&& f) {
+            return transform_helper(static_cast<Xs&&>(xs), f,
+                detail::std::make_index_sequence<std_array_detail::size<Xs>{}>{}
+            );
+        }
+    };
 
     //////////////////////////////////////////////////////////////////////////
     // Searchable
+    //
+    // Since all the elements have the same type, a predicate returning a
+    // compile-time Logical returns the same value for all of them, and
+    // only the first element has to be looked at. `any_of` also accepts
+    // predicates returning runtime Logicals, in which case it is a loop
+    // that stops at the first element satisfying the predicate.
     //////////////////////////////////////////////////////////////////////////
+    namespace std_array_detail {
+        template <typename Xs, typename Pred,
+            bool = size<Xs>::value != 0,
+            bool = _models<Constant, decltype(detail::std::declval<Pred&>()(
+                detail::std::declval<element_t<Xs>>()
+            ))>{}()
+        >
+        struct any_of_helper {
+            static constexpr auto apply(Xs&& xs, Pred& pred) {
+                for (std::size_t i = 0; i < xs.size(); ++i)
+                    if (pred(static_cast<element_t<Xs>>(xs[i])))
+                        return true;
+                return false;
+            }
+        };
+
+        template <typename Xs, typename Pred, bool is_constant>
+        struct any_of_helper<Xs, Pred, false, is_constant> {
+            static constexpr auto apply(Xs&&, Pred&)
+            { return false_; }
+        };
+
+        template <typename Xs, typename Pred>
+        struct any_of_helper<Xs, Pred, true, true> {
+            static constexpr auto apply(Xs&&, Pred&) {
+                return bool_<hana::if_(hana::value<decltype(
+                    detail::std::declval<Pred&>()(
+                        detail::std::declval<element_t<Xs>>())
+                )>(), true, false)>;
+            }
+        };
+    }
+
     template <>
-    struct find_if_impl<ext::std::Array>
-        : Iterable::find_if_impl<ext::std::Array>
-    { };
+    struct any_of_impl<ext::std::Array> {
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs&& xs, Pred&& pred) {
+            return std_array_detail::any_of_helper<Xs, Pred>::apply(
+                static_cast<Xs&&>(xs), pred);
+        }
+    };
 
     template <>
-    struct any_of_impl<ext::std::Array>
-        : Iterable::any_of_impl<ext::std::Array>
-    { };
+    struct find_if_impl<ext::std::Array> {
+        template <typename Xs>
+        static constexpr auto find_helper(Xs&&, decltype(false_))
+        { return nothing; }
+
+        template <typename Xs>
+        static constexpr auto find_helper(Xs&& xs, decltype(true_))
+        { return hana::just(::std::get<0>(static_cast<Xs&&>(xs))); }
+
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs&& xs, Pred&& pred) {
+            return find_helper(static_cast<Xs&&>(xs),
+                               hana::any_of(xs, static_cast<Pred&&>(pred)));
+        }
+    };
 
     //////////////////////////////////////////////////////////////////////////
     // Iterable
     //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct at_impl<ext::std::Array> {
+        template <typename Xs, typename N>
+        static constexpr decltype(auto) apply(Xs&& xs, N const&) {
+            constexpr std::size_t n = hana::value<N>();
+            return ::std::get<n>(static_cast<Xs&&>(xs));
+        }
+    };
+
     template <>
     struct head_impl<ext::std::Array> {
         template <typename T, std::size_t n>
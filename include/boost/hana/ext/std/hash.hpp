@@ -0,0 +1,107 @@
+/*!
+@file
+Bridges `boost::hana::Hashable` and `std::hash`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_EXT_STD_HASH_HPP
+#define BOOST_HANA_EXT_STD_HASH_HPP
+
+#include <boost/hana/constant.hpp>
+#include <boost/hana/core/datatype.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/core/when.hpp>
+#include <boost/hana/fwd/pair.hpp>
+#include <boost/hana/fwd/tuple.hpp>
+#include <boost/hana/hashable.hpp>
+#include <boost/hana/product.hpp>
+#include <boost/hana/sequence.hpp>
+#include <boost/hana/struct.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+
+namespace boost { namespace hana {
+    namespace std_hash_detail {
+        template <typename T, typename = void>
+        struct has_std_hash { static constexpr bool value = false; };
+
+        template <typename T>
+        struct has_std_hash<T, decltype((void)
+            ::std::hash<T>{}(::std::declval<T const&>())
+        )> {
+            static constexpr bool value = true;
+        };
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Hashable
+    //
+    // Any data type for which `std::hash` works and which is not already
+    // `Hashable` through one of Hana's own models is made `Hashable`. This
+    // covers, for example, pointers and `std::string`.
+    //
+    // Floating point values are compared with integers by value, so a
+    // floating point value holding an integer hashes like that integer,
+    // and other values are hashed as a `long double`, so that equal
+    // `float`s and `double`s hash equally.
+    //////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    struct hash_impl<T, when< ::std::is_floating_point<T>{}()>> {
+        static ::std::size_t apply(T x) {
+            long double v = x;
+            if (v == ::std::trunc(v)) {
+                if (v >= -9223372036854775808.0L && v < 9223372036854775808.0L)
+                    return hana::hash(static_cast<long long>(v));
+                if (v >= 0 && v < 18446744073709551616.0L)
+                    return hana::hash(static_cast<unsigned long long>(v));
+            }
+            return ::std::hash<long double>{}(v);
+        }
+    };
+
+    template <typename T>
+    struct hash_impl<T, when<
+        std_hash_detail::has_std_hash<T>::value &&
+        !::std::is_floating_point<T>{}() &&
+        !hash_detail::is_bytewise<T>{}() &&
+        !_models<Constant, T>{}() &&
+        !_models<Product, T>{}() &&
+        !_models<Sequence, T>{}() &&
+        !_models<Struct, T>{}()
+    >> {
+        template <typename X>
+        static ::std::size_t apply(X const& x)
+        { return ::std::hash<X>{}(x); }
+    };
+}} // end namespace boost::hana
+
+namespace std {
+    //! Makes `boost::hana::_tuple` usable with `std::unordered_map` and
+    //! friends, as long as all its elements are `Hashable`. To use a
+    //! `Struct` as a key, use `decltype(boost::hana::hash)` as the `Hash`
+    //! parameter of the container instead.
+    template <typename ...Xs>
+    struct hash< ::boost::hana::_tuple<Xs...>> {
+        std::size_t operator()(::boost::hana::_tuple<Xs...> const& xs) const
+        { return ::boost::hana::hash(xs); }
+    };
+
+    //! Makes `boost::hana::_pair` usable with `std::unordered_map` and
+    //! friends, as long as both its elements are `Hashable`.
+    template <typename First, typename Second>
+    struct hash< ::boost::hana::_pair<First, Second>> {
+        std::size_t
+        operator()(::boost::hana::_pair<First, Second> const& p) const
+        { return ::boost::hana::hash(p); }
+    };
+}
+
+#endif // !BOOST_HANA_EXT_STD_HASH_HPP
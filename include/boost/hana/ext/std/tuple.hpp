@@ -16,13 +16,19 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/datatype.hpp>
 #include <boost/hana/core/make.hpp>
 #include <boost/hana/core/models.hpp>
+#include <boost/hana/detail/find_index.hpp>
+#include <boost/hana/detail/std/declval.hpp>
 #include <boost/hana/detail/std/integer_sequence.hpp>
 #include <boost/hana/detail/std/remove_reference.hpp>
 #include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/foldable.hpp>
 #include <boost/hana/functor.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/iterable.hpp>
+#include <boost/hana/maybe.hpp>
 #include <boost/hana/monad.hpp>
 #include <boost/hana/monad_plus.hpp>
+#include <boost/hana/searchable.hpp>
 #include <boost/hana/sequence.hpp>
 
 #include <tuple>
@@ -42,6 +48,16 @@ namespace boost { namespace hana {
         using type = ext::std::Tuple;
     };
 
+    namespace std_tuple_detail {
+        template <typename Xs>
+        using size = ::std::tuple_size<
+            typename detail::std::remove_reference<Xs>::type
+        >;
+
+        template <typename Xs>
+        using indices = detail::std::make_index_sequence<size<Xs>::value>;
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // make
     //////////////////////////////////////////////////////////////////////////
@@ -68,13 +84,8 @@ namespace boost { namespace hana {
 
         template <typename Xs, typename F>
         static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
-            using Raw = typename detail::std::remove_reference<Xs>::type;
-            constexpr auto N = ::std::tuple_size<Raw>::value;
-            return transform_helper(
-                static_cast<Xs&&>(xs),
-                static_cast<F&&>(f),
-                detail::std::make_index_sequence<N>{}
-            );
+            return transform_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                                    std_tuple_detail::indices<Xs>{});
         }
     };
 
@@ -138,6 +149,106 @@ namespace boost { namespace hana {
         { return ::std::tuple<>{}; }
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //
+    // All the methods below access the elements with `std::get` through
+    // index expansion, instead of recursing on `tail`, which would create
+    // a new tuple at every step. The folds are the default ones, which
+    // unpack the tuple.
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct unpack_impl<ext::std::Tuple> {
+        template <typename Xs, typename F, detail::std::size_t ...i>
+        static constexpr decltype(auto)
+        unpack_helper(Xs&& xs, F&& f, detail::std::index_sequence<i...>) {
+            return static_cast<F&&>(f)(
+                ::std::get<i>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            return unpack_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                                 std_tuple_detail::indices<Xs>{});
+        }
+    };
+
+    template <>
+    struct length_impl<ext::std::Tuple> {
+        template <typename ...Xs>
+        static constexpr auto apply(::std::tuple<Xs...> const&)
+        { return size_t<sizeof...(Xs)>; }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Searchable
+    //////////////////////////////////////////////////////////////////////////
+    namespace std_tuple_detail {
+        template <typename Xs, typename Pred,
+                  typename = indices<Xs>>
+        struct find_index;
+
+        template <typename Xs, typename Pred, detail::std::size_t ...i>
+        struct find_index<Xs, Pred, detail::std::index_sequence<i...>> {
+            static constexpr detail::std::size_t value = detail::first_true<
+                detail::satisfies<Pred, decltype(
+                    ::std::get<i>(detail::std::declval<Xs>()))>()...
+            >();
+        };
+    }
+
+    template <>
+    struct find_if_impl<ext::std::Tuple> {
+        template <detail::std::size_t, typename Xs>
+        static constexpr auto find_helper(Xs&&, decltype(false_))
+        { return nothing; }
+
+        template <detail::std::size_t index, typename Xs>
+        static constexpr auto find_helper(Xs&& xs, decltype(true_))
+        { return hana::just(::std::get<index>(static_cast<Xs&&>(xs))); }
+
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs&& xs, Pred&&) {
+            constexpr detail::std::size_t index =
+                            std_tuple_detail::find_index<Xs, Pred>::value;
+            return find_helper<index>(static_cast<Xs&&>(xs),
+                bool_<(index < std_tuple_detail::size<Xs>::value)>);
+        }
+    };
+
+    template <>
+    struct any_of_impl<ext::std::Tuple> {
+        template <typename Xs, typename Pred, detail::std::size_t ...i>
+        static constexpr auto any_of_helper(Xs&&, Pred&,
+            detail::std::index_sequence<i...>, decltype(true_))
+        {
+            return bool_<(std_tuple_detail::find_index<Xs, Pred>::value <
+                          sizeof...(i))>;
+        }
+
+        template <typename Xs, typename Pred, detail::std::size_t ...i>
+        static constexpr bool any_of_helper(Xs&& xs, Pred& pred,
+            detail::std::index_sequence<i...>, decltype(false_))
+        { return detail::any_satisfies(pred, ::std::get<i>(xs)...); }
+
+        template <typename Xs, typename Pred, detail::std::size_t ...i>
+        static constexpr auto compile_time(detail::std::index_sequence<i...>) {
+            return bool_<detail::returns_constants<Pred, decltype(
+                ::std::get<i>(detail::std::declval<Xs>()))...>()>;
+        }
+
+        // When the predicate returns compile-time Logicals, the result is
+        // known from the index of the first satisfying element. Otherwise,
+        // the predicate is called on each element until it returns true.
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs&& xs, Pred&& pred) {
+            using Indices = std_tuple_detail::indices<Xs>;
+            return any_of_helper(static_cast<Xs&&>(xs), pred, Indices{},
+                                 compile_time<Xs, Pred>(Indices{}));
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Iterable
     //////////////////////////////////////////////////////////////////////////
@@ -161,8 +272,7 @@ namespace boost { namespace hana {
 
         template <typename Xs>
         static constexpr decltype(auto) apply(Xs&& xs) {
-            using Raw = typename detail::std::remove_reference<Xs>::type;
-            constexpr auto N = ::std::tuple_size<Raw>::value;
+            constexpr auto N = std_tuple_detail::size<Xs>::value;
             return tail_helper(
                 static_cast<Xs&&>(xs),
                 detail::std::make_index_sequence<N - 1>{}
@@ -186,6 +296,35 @@ namespace boost { namespace hana {
         }
     };
 
+    template <>
+    struct last_impl<ext::std::Tuple> {
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            constexpr detail::std::size_t size = std_tuple_detail::size<Xs>::value;
+            return ::std::get<size - 1>(static_cast<Xs&&>(xs));
+        }
+    };
+
+    template <>
+    struct drop_at_most_impl<ext::std::Tuple> {
+        using Size = detail::std::size_t;
+
+        template <Size n, typename Xs, Size ...i>
+        static constexpr decltype(auto)
+        drop_helper(Xs&& xs, detail::std::index_sequence<i...>) {
+            return ::std::make_tuple(::std::get<n + i>(static_cast<Xs&&>(xs))...);
+        }
+
+        template <typename Xs, typename N>
+        static constexpr decltype(auto) apply(Xs&& xs, N const&) {
+            constexpr Size n = hana::value<N>();
+            constexpr Size size = std_tuple_detail::size<Xs>::value;
+            constexpr Size drop_size = n > size ? size : n;
+            return drop_helper<drop_size>(static_cast<Xs&&>(xs),
+                detail::std::make_index_sequence<size - drop_size>{});
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Sequence
     //////////////////////////////////////////////////////////////////////////
@@ -193,6 +332,41 @@ namespace boost { namespace hana {
     struct models_impl<Sequence, ext::std::Tuple>
         : decltype(true_)
     { };
+
+    template <>
+    struct slice_impl<ext::std::Tuple> {
+        template <detail::std::size_t from, typename Xs, detail::std::size_t ...i>
+        static constexpr decltype(auto)
+        slice_helper(Xs&& xs, detail::std::index_sequence<i...>) {
+            return ::std::make_tuple(::std::get<from + i>(
+                                        static_cast<Xs&&>(xs))...);
+        }
+
+        template <typename Xs, typename From, typename To>
+        static constexpr decltype(auto) apply(Xs&& xs, From const&, To const&) {
+            constexpr detail::std::size_t from = hana::value<From>();
+            constexpr detail::std::size_t to = hana::value<To>();
+            return slice_helper<from>(static_cast<Xs&&>(xs),
+                                detail::std::make_index_sequence<to - from>{});
+        }
+    };
+
+    template <>
+    struct take_at_most_impl<ext::std::Tuple> {
+        template <typename Xs, detail::std::size_t ...n>
+        static constexpr decltype(auto)
+        take_helper(Xs&& xs, detail::std::index_sequence<n...>) {
+            return ::std::make_tuple(::std::get<n>(static_cast<Xs&&>(xs))...);
+        }
+
+        template <typename Xs, typename N>
+        static constexpr decltype(auto) apply(Xs&& xs, N const&) {
+            constexpr detail::std::size_t n = hana::value<N>();
+            constexpr detail::std::size_t size = std_tuple_detail::size<Xs>::value;
+            return take_helper(static_cast<Xs&&>(xs),
+                detail::std::make_index_sequence<(n < size ? n : size)>{});
+        }
+    };
 }} // end namespace boost::hana
 
 #endif // !BOOST_HANA_EXT_STD_TUPLE_HPP
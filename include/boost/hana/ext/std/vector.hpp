@@ -13,12 +13,16 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/comparable.hpp>
 #include <boost/hana/core/datatype.hpp>
+#include <boost/hana/foldable.hpp>
 #include <boost/hana/functor.hpp>
 #include <boost/hana/orderable.hpp>
 
 #include <algorithm>
+#include <cassert>
+#include <cstddef>
 #include <iterator>
 #include <memory>
+#include <new>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -62,7 +66,79 @@ namespace boost { namespace hana {
         }
     };
 
-#if 0
+    namespace std_vector_detail {
+        // Forwards an element of a vector of type `V`, with the value
+        // category of that vector.
+        template <typename V, typename X>
+        constexpr decltype(auto) forward_element(X& x) {
+            return static_cast<std::conditional_t<
+                std::is_lvalue_reference<V>{}, X&, X&&
+            >>(x);
+        }
+
+        template <typename V>
+        using element_t = decltype(std_vector_detail::forward_element<V>(
+            *std::declval<V&>().begin()
+        ));
+
+        template <typename State, typename Result>
+        constexpr void check_state() {
+            static_assert(std::is_same<std::decay_t<Result>, State>{},
+            "hana::fold on a std::vector requires the function to return "
+            "an object of the same type as the state, because the number of "
+            "elements is only known at runtime");
+        }
+
+        // Holds the state of a fold. `update(g)` replaces the state by
+        // `g(std::move(state))`. When the state can't be move-assigned,
+        // the new state is constructed next to the old one, which is then
+        // destroyed.
+        template <typename State, bool = std::is_move_assignable<State>{}>
+        struct fold_state {
+            template <typename S>
+            explicit fold_state(S&& s) : state_(static_cast<S&&>(s)) { }
+
+            template <typename G>
+            void update(G&& g)
+            { state_ = static_cast<G&&>(g)(std::move(state_)); }
+
+            State get() { return std::move(state_); }
+
+        private:
+            State state_;
+        };
+
+        template <typename State>
+        struct fold_state<State, false> {
+            template <typename S>
+            explicit fold_state(S&& s)
+            { new (&storage_[0]) State(static_cast<S&&>(s)); }
+
+            fold_state(fold_state const&) = delete;
+            fold_state& operator=(fold_state const&) = delete;
+
+            template <typename G>
+            void update(G&& g) {
+                State& old = current();
+                new (&storage_[!which_]) State(
+                    static_cast<G&&>(g)(std::move(old)));
+                old.~State();
+                which_ = !which_;
+            }
+
+            State get() { return std::move(current()); }
+
+            ~fold_state() { current().~State(); }
+
+        private:
+            State& current()
+            { return *reinterpret_cast<State*>(&storage_[which_]); }
+
+            std::aligned_storage_t<sizeof(State), alignof(State)> storage_[2];
+            bool which_ = false;
+        };
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // Functor
     //////////////////////////////////////////////////////////////////////////
@@ -71,15 +147,15 @@ namespace boost { namespace hana {
         template <typename V, typename F>
         static auto apply(V&& v, F&& f) {
             using U = std::remove_cv_t<std::remove_reference_t<
-                decltype(f(*v.begin()))
+                decltype(f(std::declval<std_vector_detail::element_t<V>>()))
             >>;
             using Alloc = typename std::remove_reference_t<V>::allocator_type;
             using NewAlloc = typename std::allocator_traits<Alloc>::
                              template rebind_alloc<U>;
-            std::vector<U, NewAlloc> result; result.reserve(v.size());
-
-            std::transform(begin(v), end(v),
-                           std::back_inserter(result), std::forward<F>(f));
+            std::vector<U, NewAlloc> result(v.get_allocator());
+            result.reserve(v.size());
+            for (auto& x : v)
+                result.push_back(f(std_vector_detail::forward_element<V>(x)));
             return result;
         }
 
@@ -89,7 +165,7 @@ namespace boost { namespace hana {
                 std::is_same<
                     T,
                     std::remove_cv_t<std::remove_reference_t<
-                        decltype(f(*v.begin()))
+                        decltype(f(std::move(*v.begin())))
                     >>
                 >{}
                 , std::vector<T, Alloc>
@@ -98,13 +174,215 @@ namespace boost { namespace hana {
             // If we receive a rvalue and the function returns elements of
             // the same type, we modify the vector in-place instead of
             // returning a new one.
-            std::transform(std::make_move_iterator(begin(v)),
-                           std::make_move_iterator(end(v)),
-                           begin(v), std::forward<F>(f));
+            for (auto& x : v)
+                x = f(std::move(x));
             return std::move(v);
         }
     };
-#endif
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //
+    // Since the number of elements of a `std::vector` is only known at
+    // runtime, the folds are loops and the function must always return
+    // an object of the same type as the state. For the same reason,
+    // `length` returns a `std::size_t`, and folding an empty vector without
+    // an initial state is an error, which is caught by an assertion.
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct fold_left_impl<ext::std::Vector> {
+        template <typename V, typename S, typename F>
+        static std::decay_t<S> apply(V&& v, S&& s, F&& f) {
+            using State = std::decay_t<S>;
+            std_vector_detail::check_state<State, decltype(f(
+                std::declval<State>(),
+                std::declval<std_vector_detail::element_t<V>>()
+            ))>();
+
+            std_vector_detail::fold_state<State> state(static_cast<S&&>(s));
+            for (auto& x : v)
+                state.update([&](State&& st) -> State {
+                    return f(std::move(st),
+                             std_vector_detail::forward_element<V>(x));
+                });
+            return state.get();
+        }
+    };
+
+    template <>
+    struct fold_left_nostate_impl<ext::std::Vector> {
+        template <typename V, typename F>
+        static auto apply(V&& v, F&& f) {
+            using State = std::decay_t<std_vector_detail::element_t<V>>;
+            std_vector_detail::check_state<State, decltype(f(
+                std::declval<State>(),
+                std::declval<std_vector_detail::element_t<V>>()
+            ))>();
+
+            assert(!v.empty() &&
+                "hana::fold.left(xs, f) requires 'xs' to be non-empty");
+            auto first = v.begin(), last = v.end();
+            std_vector_detail::fold_state<State> state(
+                std_vector_detail::forward_element<V>(*first));
+            for (++first; first != last; ++first)
+                state.update([&](State&& st) -> State {
+                    return f(std::move(st),
+                             std_vector_detail::forward_element<V>(*first));
+                });
+            return state.get();
+        }
+    };
+
+    template <>
+    struct fold_right_impl<ext::std::Vector> {
+        template <typename V, typename S, typename F>
+        static std::decay_t<S> apply(V&& v, S&& s, F&& f) {
+            using State = std::decay_t<S>;
+            std_vector_detail::check_state<State, decltype(f(
+                std::declval<std_vector_detail::element_t<V>>(),
+                std::declval<State>()
+            ))>();
+
+            std_vector_detail::fold_state<State> state(static_cast<S&&>(s));
+            for (auto it = v.rbegin(); it != v.rend(); ++it)
+                state.update([&](State&& st) -> State {
+                    return f(std_vector_detail::forward_element<V>(*it),
+                             std::move(st));
+                });
+            return state.get();
+        }
+    };
+
+    template <>
+    struct fold_right_nostate_impl<ext::std::Vector> {
+        template <typename V, typename F>
+        static auto apply(V&& v, F&& f) {
+            using State = std::decay_t<std_vector_detail::element_t<V>>;
+            std_vector_detail::check_state<State, decltype(f(
+                std::declval<std_vector_detail::element_t<V>>(),
+                std::declval<State>()
+            ))>();
+
+            assert(!v.empty() &&
+                "hana::fold.right(xs, f) requires 'xs' to be non-empty");
+            auto first = v.rbegin(), last = v.rend();
+            std_vector_detail::fold_state<State> state(
+                std_vector_detail::forward_element<V>(*first));
+            for (++first; first != last; ++first)
+                state.update([&](State&& st) -> State {
+                    return f(std_vector_detail::forward_element<V>(*first),
+                             std::move(st));
+                });
+            return state.get();
+        }
+    };
+
+    template <>
+    struct for_each_impl<ext::std::Vector> {
+        template <typename V, typename F>
+        static void apply(V&& v, F&& f) {
+            for (auto& x : v)
+                f(std_vector_detail::forward_element<V>(x));
+        }
+    };
+
+    template <>
+    struct length_impl<ext::std::Vector> {
+        template <typename T, typename Alloc>
+        static std::size_t apply(std::vector<T, Alloc> const& v)
+        { return v.size(); }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Searching and filtering
+    //
+    // `std::vector` is not a `Searchable`, because `find_if` would have to
+    // know at compile-time whether an element was found, and it is not a
+    // `MonadPlus`, because `empty` can't know the type of the elements.
+    // Hence, `hana::any_of`, `hana::concat`, `hana::filter` and
+    // `hana::remove_if` can't be used with a `std::vector`. Instead, the
+    // functions below are provided in the `ext::std` namespace, with the
+    // same semantics. `find_if` is not provided; use `std::find_if`.
+    //
+    // `any_of` stops at the first element satisfying the predicate. When
+    // `concat`, `filter` and `remove_if` receive rvalue vectors, they reuse
+    // them instead of allocating new ones.
+    //////////////////////////////////////////////////////////////////////////
+    namespace std_vector_detail {
+        struct _any_of {
+            template <typename T, typename Alloc, typename Pred>
+            bool operator()(std::vector<T, Alloc> const& v, Pred&& pred) const {
+                for (auto const& x : v)
+                    if (pred(x))
+                        return true;
+                return false;
+            }
+        };
+
+        struct _concat {
+            template <typename T, typename Alloc, typename Ys>
+            std::vector<T, Alloc>
+            operator()(std::vector<T, Alloc> const& xs, Ys&& ys) const {
+                std::vector<T, Alloc> result(xs.get_allocator());
+                result.reserve(xs.size() + ys.size());
+                result.insert(result.end(), xs.begin(), xs.end());
+                append(result, static_cast<Ys&&>(ys));
+                return result;
+            }
+
+            template <typename T, typename Alloc, typename Ys>
+            std::vector<T, Alloc>
+            operator()(std::vector<T, Alloc>&& xs, Ys&& ys) const {
+                xs.reserve(xs.size() + ys.size());
+                append(xs, static_cast<Ys&&>(ys));
+                return std::move(xs);
+            }
+
+        private:
+            template <typename T, typename Alloc, typename Ys>
+            static void append(std::vector<T, Alloc>& result, Ys&& ys) {
+                for (auto& y : ys)
+                    result.push_back(std_vector_detail::forward_element<Ys>(y));
+            }
+        };
+
+        struct _remove_if {
+            template <typename T, typename Alloc, typename Pred>
+            std::vector<T, Alloc>
+            operator()(std::vector<T, Alloc> const& v, Pred&& pred) const {
+                std::vector<T, Alloc> result(v.get_allocator());
+                for (auto const& x : v)
+                    if (!pred(x))
+                        result.push_back(x);
+                return result;
+            }
+
+            template <typename T, typename Alloc, typename Pred>
+            std::vector<T, Alloc>
+            operator()(std::vector<T, Alloc>&& v, Pred&& pred) const {
+                v.erase(std::remove_if(v.begin(), v.end(), [&](T const& x) {
+                    return static_cast<bool>(pred(x));
+                }), v.end());
+                return std::move(v);
+            }
+        };
+
+        struct _filter {
+            template <typename V, typename Pred>
+            auto operator()(V&& v, Pred&& pred) const {
+                return _remove_if{}(static_cast<V&&>(v), [&](auto const& x) {
+                    return !static_cast<bool>(pred(x));
+                });
+            }
+        };
+    }
+
+    namespace ext { namespace std {
+        constexpr std_vector_detail::_any_of any_of{};
+        constexpr std_vector_detail::_concat concat{};
+        constexpr std_vector_detail::_filter filter{};
+        constexpr std_vector_detail::_remove_if remove_if{};
+    }}
 }} // end namespace boost::hana
 
 #endif // !BOOST_HANA_EXT_STD_VECTOR_HPP
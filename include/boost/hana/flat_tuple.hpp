@@ -0,0 +1,373 @@
+/*!
+@file
+Defines `boost::hana::FlatTuple`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FLAT_TUPLE_HPP
+#define BOOST_HANA_FLAT_TUPLE_HPP
+
+#include <boost/hana/fwd/flat_tuple.hpp>
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/comparable.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/detail/flat_storage.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/declval.hpp>
+#include <boost/hana/detail/std/enable_if.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/remove_reference.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/functor.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/iterable.hpp>
+#include <boost/hana/monad_plus.hpp>
+#include <boost/hana/orderable.hpp>
+#include <boost/hana/sequence.hpp>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // _flat_tuple
+    //////////////////////////////////////////////////////////////////////////
+    template <typename ...Xs>
+    struct _flat_tuple {
+        detail::flat_storage<Xs...> storage;
+
+        _flat_tuple() = default;
+        _flat_tuple(_flat_tuple&&) = default;
+        _flat_tuple(_flat_tuple const&) = default;
+        _flat_tuple(_flat_tuple&) = default;
+        _flat_tuple& operator=(_flat_tuple&&) = default;
+        _flat_tuple& operator=(_flat_tuple const&) = default;
+
+        // Make sure the constructor is SFINAE-friendly.
+        template <typename ...Ys, typename = detail::std::enable_if_t<
+            sizeof...(Ys) == sizeof...(Xs) && sizeof...(Ys) != 0
+        >, typename = decltype(detail::flat_storage<Xs...>{
+            detail::std::declval<Ys>()...
+        })>
+        constexpr _flat_tuple(Ys&& ...ys)
+            : storage{static_cast<Ys&&>(ys)...}
+        { }
+
+        using hana = _flat_tuple;
+        using datatype = FlatTuple;
+
+        static constexpr detail::std::size_t size = sizeof...(Xs);
+
+        template <typename I>
+        constexpr decltype(auto) operator[](I&& i) const&
+        { return ::boost::hana::at(*this, static_cast<I&&>(i)); }
+
+#ifndef BOOST_HANA_CONFIG_CONSTEXPR_MEMBER_FUNCTION_IS_CONST
+        template <typename I>
+        constexpr decltype(auto) operator[](I&& i) &
+        { return ::boost::hana::at(*this, static_cast<I&&>(i)); }
+#endif
+
+        template <typename I>
+        constexpr decltype(auto) operator[](I&& i) && {
+            return ::boost::hana::at(static_cast<_flat_tuple&&>(*this),
+                                     static_cast<I&&>(i));
+        }
+
+        #define BOOST_HANA_PP_FLAT_TUPLE_OPERATOR(OP, METHOD)                   \
+            template <typename ...Ys>                                           \
+            friend constexpr decltype(auto)                                     \
+            operator OP(_flat_tuple const& xs, _flat_tuple<Ys...> const& ys)    \
+            { return ::boost::hana::METHOD(xs, ys); }                           \
+        /**/
+        BOOST_HANA_PP_FLAT_TUPLE_OPERATOR(==, equal)
+        BOOST_HANA_PP_FLAT_TUPLE_OPERATOR(!=, not_equal)
+        BOOST_HANA_PP_FLAT_TUPLE_OPERATOR(<, less)
+        BOOST_HANA_PP_FLAT_TUPLE_OPERATOR(<=, less_equal)
+        BOOST_HANA_PP_FLAT_TUPLE_OPERATOR(>, greater)
+        BOOST_HANA_PP_FLAT_TUPLE_OPERATOR(>=, greater_equal)
+        #undef BOOST_HANA_PP_FLAT_TUPLE_OPERATOR
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // make
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct make_impl<FlatTuple> {
+        static constexpr _flat_tuple<> apply()
+        { return {}; }
+
+        template <typename X, typename ...Xs>
+        static constexpr _flat_tuple<
+            typename detail::std::decay<X>::type,
+            typename detail::std::decay<Xs>::type...
+        > apply(X&& x, Xs&& ...xs)
+        { return {static_cast<X&&>(x), static_cast<Xs&&>(xs)...}; }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // utilities
+    //////////////////////////////////////////////////////////////////////////
+    namespace flat_tuple_detail {
+        template <typename Xs>
+        using size = _integral_constant<detail::std::size_t,
+            detail::std::remove_reference<Xs>::type::size
+        >;
+
+        template <detail::std::size_t n, typename Xs>
+        constexpr decltype(auto) get(Xs&& xs) {
+            return detail::flat_get<n>::apply(
+                static_cast<Xs&&>(xs).storage
+            );
+        }
+
+        template <detail::std::size_t from, typename Xs, detail::std::size_t ...i>
+        constexpr auto
+        subsequence(Xs&& xs, detail::std::index_sequence<i...>) {
+            return hana::make<FlatTuple>(
+                flat_tuple_detail::get<from + i>(static_cast<Xs&&>(xs))...
+            );
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct unpack_impl<FlatTuple> {
+        template <typename Xs, typename F, detail::std::size_t ...i>
+        static constexpr decltype(auto)
+        unpack_helper(Xs&& xs, F&& f, detail::std::index_sequence<i...>) {
+            return static_cast<F&&>(f)(
+                flat_tuple_detail::get<i>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            constexpr detail::std::size_t size = flat_tuple_detail::size<Xs>{}();
+            return unpack_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                                 detail::std::make_index_sequence<size>{});
+        }
+    };
+
+    template <>
+    struct length_impl<FlatTuple> {
+        template <typename Xs>
+        static constexpr _size_t<Xs::size> apply(Xs const&)
+        { return {}; }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Iterable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct head_impl<FlatTuple> {
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs)
+        { return flat_tuple_detail::get<0>(static_cast<Xs&&>(xs)); }
+    };
+
+    template <>
+    struct at_impl<FlatTuple> {
+        template <typename Xs, typename N>
+        static constexpr decltype(auto) apply(Xs&& xs, N const&) {
+            constexpr detail::std::size_t index = hana::value<N>();
+            return flat_tuple_detail::get<index>(static_cast<Xs&&>(xs));
+        }
+    };
+
+    template <>
+    struct tail_impl<FlatTuple> {
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            constexpr detail::std::size_t size = flat_tuple_detail::size<Xs>{}();
+            return flat_tuple_detail::subsequence<1>(static_cast<Xs&&>(xs),
+                detail::std::make_index_sequence<size - 1>{});
+        }
+    };
+
+    template <>
+    struct is_empty_impl<FlatTuple> {
+        template <typename Xs>
+        static constexpr auto apply(Xs const&)
+        { return bool_<Xs::size == 0>; }
+    };
+
+    template <>
+    struct last_impl<FlatTuple> {
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            constexpr detail::std::size_t size = flat_tuple_detail::size<Xs>{}();
+            return flat_tuple_detail::get<size - 1>(static_cast<Xs&&>(xs));
+        }
+    };
+
+    template <>
+    struct drop_at_most_impl<FlatTuple> {
+        template <typename Xs, typename N>
+        static constexpr decltype(auto) apply(Xs&& xs, N const&) {
+            constexpr detail::std::size_t n = hana::value<N>();
+            constexpr detail::std::size_t size = flat_tuple_detail::size<Xs>{}();
+            constexpr detail::std::size_t drop_size = n > size ? size : n;
+            return flat_tuple_detail::subsequence<drop_size>(
+                static_cast<Xs&&>(xs),
+                detail::std::make_index_sequence<size - drop_size>{});
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Functor
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct transform_impl<FlatTuple> {
+        template <typename Xs, typename F, detail::std::size_t ...i>
+        static constexpr decltype(auto)
+        transform_helper(Xs&& xs, F&& f, detail::std::index_sequence<i...>) {
+            return hana::make<FlatTuple>(
+                f(flat_tuple_detail::get<i>(static_cast<Xs&&>(xs)))...
+            );
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            constexpr detail::std::size_t size = flat_tuple_detail::size<Xs>{}();
+            return transform_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                                    detail::std::make_index_sequence<size>{});
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // MonadPlus
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct concat_impl<FlatTuple> {
+        template <typename Xs, typename Ys,
+                  detail::std::size_t ...i, detail::std::size_t ...j>
+        static constexpr decltype(auto)
+        concat_helper(Xs&& xs, Ys&& ys, detail::std::index_sequence<i...>,
+                                        detail::std::index_sequence<j...>)
+        {
+            return hana::make<FlatTuple>(
+                flat_tuple_detail::get<i>(static_cast<Xs&&>(xs))...,
+                flat_tuple_detail::get<j>(static_cast<Ys&&>(ys))...
+            );
+        }
+
+        template <typename Xs, typename Ys>
+        static constexpr decltype(auto) apply(Xs&& xs, Ys&& ys) {
+            return concat_helper(static_cast<Xs&&>(xs), static_cast<Ys&&>(ys),
+                detail::std::make_index_sequence<flat_tuple_detail::size<Xs>{}()>{},
+                detail::std::make_index_sequence<flat_tuple_detail::size<Ys>{}()>{});
+        }
+    };
+
+    template <>
+    struct empty_impl<FlatTuple> {
+        static constexpr _flat_tuple<> apply()
+        { return {}; }
+    };
+
+    template <>
+    struct prepend_impl<FlatTuple> {
+        template <typename X, typename Xs, detail::std::size_t ...i>
+        static constexpr decltype(auto)
+        prepend_helper(X&& x, Xs&& xs, detail::std::index_sequence<i...>) {
+            return hana::make<FlatTuple>(
+                static_cast<X&&>(x),
+                flat_tuple_detail::get<i>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename X, typename Xs>
+        static constexpr decltype(auto) apply(X&& x, Xs&& xs) {
+            constexpr detail::std::size_t size = flat_tuple_detail::size<Xs>{}();
+            return prepend_helper(static_cast<X&&>(x), static_cast<Xs&&>(xs),
+                                  detail::std::make_index_sequence<size>{});
+        }
+    };
+
+    template <>
+    struct append_impl<FlatTuple> {
+        template <typename Xs, typename X, detail::std::size_t ...i>
+        static constexpr decltype(auto)
+        append_helper(Xs&& xs, X&& x, detail::std::index_sequence<i...>) {
+            return hana::make<FlatTuple>(
+                flat_tuple_detail::get<i>(static_cast<Xs&&>(xs))...,
+                static_cast<X&&>(x)
+            );
+        }
+
+        template <typename Xs, typename X>
+        static constexpr decltype(auto) apply(Xs&& xs, X&& x) {
+            constexpr detail::std::size_t size = flat_tuple_detail::size<Xs>{}();
+            return append_helper(static_cast<Xs&&>(xs), static_cast<X&&>(x),
+                                 detail::std::make_index_sequence<size>{});
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Sequence
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct models_impl<Sequence, FlatTuple>
+        : decltype(true_)
+    { };
+
+    template <>
+    struct init_impl<FlatTuple> {
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            constexpr detail::std::size_t size = flat_tuple_detail::size<Xs>{}();
+            return flat_tuple_detail::subsequence<0>(static_cast<Xs&&>(xs),
+                detail::std::make_index_sequence<size - 1>{});
+        }
+    };
+
+    template <>
+    struct reverse_impl<FlatTuple> {
+        template <typename Xs, detail::std::size_t ...i>
+        static constexpr decltype(auto)
+        reverse_helper(Xs&& xs, detail::std::index_sequence<i...>) {
+            return hana::make<FlatTuple>(
+                flat_tuple_detail::get<sizeof...(i) - i - 1>(
+                    static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            constexpr detail::std::size_t size = flat_tuple_detail::size<Xs>{}();
+            return reverse_helper(static_cast<Xs&&>(xs),
+                                  detail::std::make_index_sequence<size>{});
+        }
+    };
+
+    template <>
+    struct slice_impl<FlatTuple> {
+        template <typename Xs, typename From, typename To>
+        static constexpr decltype(auto) apply(Xs&& xs, From const&, To const&) {
+            constexpr detail::std::size_t from = hana::value<From>();
+            constexpr detail::std::size_t to = hana::value<To>();
+            return flat_tuple_detail::subsequence<from>(static_cast<Xs&&>(xs),
+                detail::std::make_index_sequence<to - from>{});
+        }
+    };
+
+    template <>
+    struct take_at_most_impl<FlatTuple> {
+        template <typename Xs, typename N>
+        static constexpr decltype(auto) apply(Xs&& xs, N const&) {
+            constexpr detail::std::size_t n = hana::value<N>();
+            constexpr detail::std::size_t size = flat_tuple_detail::size<Xs>{}();
+            return flat_tuple_detail::subsequence<0>(static_cast<Xs&&>(xs),
+                detail::std::make_index_sequence<(n < size ? n : size)>{});
+        }
+    };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_FLAT_TUPLE_HPP
@@ -32,6 +32,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/functional/curry.hpp>
 #include <boost/hana/functional/partial.hpp>
 #include <boost/hana/fwd/sequence.hpp>
+#include <boost/hana/fwd/struct.hpp>
 #include <boost/hana/integral_constant.hpp>
 #include <boost/hana/logical.hpp>
 #include <boost/hana/monad.hpp>
@@ -692,7 +693,8 @@ namespace boost { namespace hana {
     //////////////////////////////////////////////////////////////////////////
     template <typename S, typename F>
     struct to_impl<S, F, when<_models<Sequence, S>{}() &&
-                              _models<Foldable, F>{}()>>
+                              _models<Foldable, F>{}() &&
+                              !_models<Struct, F>{}()>>
         : embedding<_models<Sequence, F>{}()>
     {
         template <typename Xs>
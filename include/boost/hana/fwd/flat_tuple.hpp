@@ -0,0 +1,88 @@
+/*!
+@file
+Forward declares `boost::hana::FlatTuple`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_FLAT_TUPLE_HPP
+#define BOOST_HANA_FWD_FLAT_TUPLE_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/fwd/core/make.hpp>
+
+
+namespace boost { namespace hana {
+    //! @ingroup group-datatypes
+    //! Index-based heterogeneous sequence with a guaranteed memory layout.
+    //!
+    //! `FlatTuple` is a `Tuple` whose elements are stored as the data
+    //! members of a single aggregate, in the order in which they are
+    //! declared. Unlike `_tuple`, which inherits from one base class per
+    //! element, `_flat_tuple` has no base classes at all. This gives the
+    //! following guarantees:
+    //! - `_flat_tuple<X0, ..., Xn>` is standard-layout when all the `Xi`s
+    //!   are standard-layout, and it is trivially copyable when all the
+    //!   `Xi`s are trivially copyable.
+    //! - Up to 16 elements, it is laid out like the `struct` with members
+    //!   `X0 m0; ...; Xn mn;`, which makes it suitable for `std::memcpy`,
+    //!   for shared memory and for exchanging records with code compiled
+    //!   by other compilers. Past 16 elements, the remaining elements are
+    //!   grouped in a nested aggregate which is the last member.
+    //! - Its default constructor leaves trivially default constructible
+    //!   elements uninitialized, like a `struct` would.
+    //!
+    //! Apart from that, a `_flat_tuple` is used exactly like a `_tuple`;
+    //! all the operations of `Sequence` are supported, and the ones that
+    //! `_tuple` implements directly are implemented directly too.
+    //!
+    //!
+    //! Modeled concepts
+    //! ----------------
+    //! `Sequence`, and all its superclasses
+    //!
+    //!
+    //! Provided operators
+    //! ------------------
+    //! For convenience, `_flat_tuple`s can be compared with `==`, `!=`,
+    //! `<`, `<=`, `>` and `>=`, and they can be indexed with `[]`. These
+    //! operators are provided by `_flat_tuple` itself instead of the usual
+    //! `operators::adl` base class, which would make `_flat_tuple`s nested
+    //! in other `_flat_tuple`s lose their standard-layoutness.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/flat_tuple.cpp main
+    struct FlatTuple { };
+
+    template <typename ...Xs>
+    struct _flat_tuple;
+
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    //! Create a `FlatTuple` containing the given objects.
+    //! @relates FlatTuple
+    //!
+    //! The elements are held by value inside the resulting tuple, and hence
+    //! they are copied or moved in.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/flat_tuple.cpp make<FlatTuple>
+    template <>
+    constexpr auto make<FlatTuple> = [](auto&& ...xs)
+        -> _flat_tuple<std::decay_t(decltype(xs))...>
+    {
+        return {forwarded(xs)...};
+    };
+#endif
+
+    //! Alias to `make<FlatTuple>`; provided for convenience.
+    //! @relates FlatTuple
+    constexpr auto make_flat_tuple = make<FlatTuple>;
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_FWD_FLAT_TUPLE_HPP
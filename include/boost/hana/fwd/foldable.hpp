@@ -20,6 +20,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/integral_constant.hpp>
 #include <boost/hana/fwd/monad.hpp>
 #include <boost/hana/fwd/monoid.hpp>
+#include <boost/hana/fwd/par.hpp>
 #include <boost/hana/fwd/ring.hpp>
 
 
@@ -726,6 +727,13 @@ namespace boost { namespace hana {
 
             return ForEach::apply(static_cast<Xs&&>(xs), static_cast<F&&>(f));
         }
+
+        template <typename Xs, typename F>
+        decltype(auto) operator()(_par const& policy, Xs&& xs, F&& f) const {
+            using S = typename datatype<Xs>::type;
+            return par_impl<S>::for_each(policy, static_cast<Xs&&>(xs),
+                                         static_cast<F&&>(f));
+        }
     };
 
     constexpr _for_each for_each{};
@@ -1101,6 +1109,12 @@ namespace boost { namespace hana {
 
             return Sum::template apply<M>(static_cast<Xs&&>(xs));
         }
+
+        template <typename Xs>
+        decltype(auto) operator()(_par const& policy, Xs&& xs) const {
+            using S = typename datatype<Xs>::type;
+            return par_impl<S>::template sum<M>(policy, static_cast<Xs&&>(xs));
+        }
     };
 
     template <typename M = IntegralConstant<int>>
@@ -1181,6 +1195,12 @@ namespace boost { namespace hana {
 
             return Product::template apply<R>(static_cast<Xs&&>(xs));
         }
+
+        template <typename Xs>
+        decltype(auto) operator()(_par const& policy, Xs&& xs) const {
+            using S = typename datatype<Xs>::type;
+            return par_impl<S>::template product<R>(policy, static_cast<Xs&&>(xs));
+        }
     };
 
     template <typename R = IntegralConstant<int>>
@@ -1239,6 +1259,13 @@ namespace boost { namespace hana {
             return CountIf::apply(static_cast<Xs&&>(xs),
                                   static_cast<Pred&&>(pred));
         }
+
+        template <typename Xs, typename Pred>
+        decltype(auto) operator()(_par const& policy, Xs&& xs, Pred&& pred) const {
+            using S = typename datatype<Xs>::type;
+            return par_impl<S>::count_if(policy, static_cast<Xs&&>(xs),
+                                         static_cast<Pred&&>(pred));
+        }
     };
 
     constexpr _count_if count_if{};
@@ -14,6 +14,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/detail/dispatch_if.hpp>
 #include <boost/hana/fwd/core/datatype.hpp>
 #include <boost/hana/fwd/core/models.hpp>
+#include <boost/hana/fwd/par.hpp>
 
 
 namespace boost { namespace hana {
@@ -183,6 +184,13 @@ namespace boost { namespace hana {
 
             return Transform::apply(static_cast<Xs&&>(xs), static_cast<F&&>(f));
         }
+
+        template <typename Xs, typename F>
+        decltype(auto) operator()(_par const& policy, Xs&& xs, F&& f) const {
+            using S = typename datatype<Xs>::type;
+            return par_impl<S>::transform(policy, static_cast<Xs&&>(xs),
+                                          static_cast<F&&>(f));
+        }
     };
 
     constexpr _transform transform{};
@@ -0,0 +1,127 @@
+/*!
+@file
+Forward declares `boost::hana::Hashable`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_HASHABLE_HPP
+#define BOOST_HANA_FWD_HASHABLE_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/dispatch_if.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/fwd/core/datatype.hpp>
+#include <boost/hana/fwd/core/models.hpp>
+
+
+namespace boost { namespace hana {
+    //! @ingroup group-concepts
+    //! The `Hashable` concept represents objects that can be reduced to a
+    //! hash value.
+    //!
+    //! `Hashable` provides the `hash` method, which returns a
+    //! `std::size_t` summarizing an object. The main purpose of `Hashable`
+    //! is to make it possible to use heterogeneous objects like `Tuple`s
+    //! and `Struct`s as keys of hash-based containers without having to
+    //! write a hash function by hand for each of them. To this end,
+    //! `decltype(hana::hash)` can be used as the `Hash` parameter of
+    //! `std::unordered_map` and friends.
+    //!
+    //! When an object is known at compile-time, like a `Type`, a `String`
+    //! or an `IntegralConstant`, its hash is computed at compile-time too.
+    //! Hashing a `Sequence` or a `Struct` of such objects hence only costs
+    //! something for the elements whose value is known at runtime.
+    //!
+    //!
+    //! Laws
+    //! ----
+    //! `hash` must be compatible with the equality of the objects. For all
+    //! objects `x` and `y` of `Hashable` data types,
+    //! @code
+    //!     x == y  implies  hash(x) == hash(y)
+    //! @endcode
+    //!
+    //! Note that this law spans data types; since `int_<3> == 3`, it must
+    //! also be the case that `hash(int_<3>) == hash(3)`. Hash values are
+    //! only meaningful within a single execution of a program; they should
+    //! not be stored or sent to another program.
+    //!
+    //!
+    //! Minimal complete definition
+    //! ---------------------------
+    //! `hash` satisfying the above law
+    //!
+    //!
+    //! Free model for integral and enumeration types
+    //! ---------------------------------------------
+    //! Integral and enumeration types are `Hashable`. Their hash is computed
+    //! by mixing the bits of their value, so that integers of different types
+    //! comparing equal have the same hash. For example, since integers are
+    //! compared after conversion to their common type, `-1 == 0xFFFFFFFFu`
+    //! and hence `hash(-1) == hash(0xFFFFFFFFu)`.
+    //!
+    //!
+    //! Free model for `Constant`s
+    //! --------------------------
+    //! A `Constant` whose underlying value is `Hashable` is `Hashable`, and
+    //! its hash is the hash of its value, computed at compile-time.
+    //!
+    //!
+    //! Concrete models
+    //! ---------------
+    //! `IntegralConstant`, `Pair`, `String`, `Tuple`, `Type`, and any
+    //! `Sequence` or `Struct` whose elements are all `Hashable`. Also see
+    //! `boost/hana/ext/std/hash.hpp`, which makes the types supported by
+    //! `std::hash` `Hashable`. Floating point values are hashed there in
+    //! a way that satisfies the above law when they are compared with
+    //! integers, e.g. `hash(3.0) == hash(3)`.
+    struct Hashable { };
+
+    //! Returns a hash value for the given object.
+    //! @relates Hashable
+    //!
+    //! The hash of a `Sequence` or a `Product` is computed by combining
+    //! the hashes of its elements, in order. The hash of a `Struct` is
+    //! computed by combining the hashes of its members, except that runs
+    //! of adjacent integral or enumeration members with no padding between
+    //! them are hashed as a single block of memory whenever the offsets of
+    //! the members are known, which is the case for `Struct`s defined with
+    //! `BOOST_HANA_DEFINE_STRUCT` or `BOOST_HANA_ADAPT_STRUCT`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/hashable.cpp hash
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto hash = [](auto const& x) -> std::size_t {
+        return tag-dispatched;
+    };
+#else
+    template <typename T, typename = void>
+    struct hash_impl;
+
+    struct _hash {
+        template <typename X>
+        constexpr detail::std::size_t operator()(X const& x) const {
+            using T = typename datatype<X>::type;
+            using Hash = BOOST_HANA_DISPATCH_IF(hash_impl<T>,
+                _models<Hashable, T>{}()
+            );
+
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            static_assert(_models<Hashable, T>{},
+            "hana::hash(x) requires x to be Hashable");
+        #endif
+
+            return Hash::apply(x);
+        }
+    };
+
+    constexpr _hash hash{};
+#endif
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_FWD_HASHABLE_HPP
@@ -131,6 +131,45 @@ namespace boost { namespace hana {
 
     constexpr _lazy lazy{};
 #endif
+
+    //! Creates a lazy value referring to an existing object.
+    //! @relates Lazy
+    //!
+    //! `lazy_ref(x)` is equivalent to `lazy(x)`, except it holds a reference
+    //! to `x` instead of a copy of it. Similarly, `lazy_ref(f)(x1, ..., xN)`
+    //! holds references to `f` and to the `x1, ..., xN`, and evaluating it
+    //! calls `f` with the `x1, ..., xN`, forwarded with the value category
+    //! they were given with. This makes it possible to lazily branch on an
+    //! existing object, for example with `eval_if`, without copying it:
+    //! @code
+    //!     eval_if(cond, lazy_ref(xs), lazy_ref(f)(std::move(xs)))
+    //! @endcode
+    //! Here, `xs` is only moved from if the second branch is taken.
+    //!
+    //! Since they hold references, such lazy values must be evaluated
+    //! before the end of the full-expression in which they are created.
+    //! Unlike lazy values created with `lazy`, they are not meant to be
+    //! stored or combined using the `Functor` and `Monad` interfaces.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/lazy.cpp lazy_ref
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto lazy_ref = [](auto&& x) {
+        return unspecified-type;
+    };
+#else
+    template <typename X>
+    struct _lazy_ref_value;
+
+    struct _lazy_ref {
+        template <typename X>
+        constexpr auto operator()(X&& x) const;
+    };
+
+    constexpr _lazy_ref lazy_ref{};
+#endif
 }} // end namespace boost::hana
 
 #endif // !BOOST_HANA_FWD_LAZY_HPP
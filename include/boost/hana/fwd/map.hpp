@@ -13,7 +13,10 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/detail/erase_key_fwd.hpp>
 #include <boost/hana/detail/insert_fwd.hpp>
 #include <boost/hana/detail/keys_fwd.hpp>
+#include <boost/hana/detail/union_fwd.hpp>
+#include <boost/hana/fwd/core/datatype.hpp>
 #include <boost/hana/fwd/core/make.hpp>
+#include <boost/hana/fwd/core/when.hpp>
 
 
 namespace boost { namespace hana {
@@ -29,7 +32,11 @@ namespace boost { namespace hana {
     //! ----------------
     //! 1. `Comparable` (operators provided)\n
     //! Two maps are equal iff all their keys are equal and are associated
-    //! to equal values.
+    //! to equal values. The keys of both maps are matched at compile-time,
+    //! and only the values are compared at runtime. When all the keys are
+    //! `Type`s, `IntegralConstant`s or `String`s, matching them requires a
+    //! linear number of instantiations, just like looking up a key with
+    //! `find` or `contains` requires a constant number of them.
     //! @snippet example/map.cpp Comparable
     //!
     //! 2. `Searchable` (operators provided)\n
@@ -87,6 +94,10 @@ namespace boost { namespace hana {
     //! Returns a Sequence of the keys of the map, in unspecified order.
     //! @relates Map
     //!
+    //! The keys are copied into the returned `Tuple`, or moved if the map
+    //! is an rvalue. Use `keys_view` to refer to the keys without copying
+    //! them.
+    //!
     //!
     //! Example
     //! -------
@@ -100,6 +111,11 @@ namespace boost { namespace hana {
     //! Returns a Sequence of the values of the map, in unspecified order.
     //! @relates Map
     //!
+    //! The values are in the same order as the keys returned by `keys`.
+    //! They are copied into the returned `Tuple`, or moved if the map is
+    //! an rvalue. Use `values_view` to refer to the values without copying
+    //! them.
+    //!
     //!
     //! Example
     //! -------
@@ -117,6 +133,58 @@ namespace boost { namespace hana {
     constexpr _values values{};
 #endif
 
+    //! Returns a `Tuple` referring to the keys of the map, in the same order
+    //! as `keys`.
+    //! @relates Map
+    //!
+    //! When the map is an lvalue, the keys are not copied; the returned
+    //! `Tuple` holds references to the keys stored in the map, which must
+    //! hence outlive it. When the map is an rvalue, the keys are moved into
+    //! the returned `Tuple` instead, so that it never dangles.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/map.cpp keys_view
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto keys_view = [](auto&& map) -> decltype(auto) {
+        return unspecified-type;
+    };
+#else
+    struct _keys_view {
+        template <typename Map>
+        constexpr decltype(auto) operator()(Map&& map) const;
+    };
+
+    constexpr _keys_view keys_view{};
+#endif
+
+    //! Returns a `Tuple` referring to the values of the map, in the same
+    //! order as `keys`.
+    //! @relates Map
+    //!
+    //! When the map is an lvalue, the values are not copied; the returned
+    //! `Tuple` holds references to the values stored in the map, which must
+    //! hence outlive it, and which can be modified through it. When the map
+    //! is an rvalue, the values are moved into the returned `Tuple` instead.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/map.cpp values_view
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto values_view = [](auto&& map) -> decltype(auto) {
+        return unspecified-type;
+    };
+#else
+    struct _values_view {
+        template <typename Map>
+        constexpr decltype(auto) operator()(Map&& map) const;
+    };
+
+    constexpr _values_view values_view{};
+#endif
+
     //! Inserts a new key/value pair in a `Map`.
     //! @relates Map
     //!
@@ -166,6 +234,80 @@ namespace boost { namespace hana {
         return tag-dispatched;
     };
 #endif
+
+    //! Removes several keys from a `Map` at once.
+    //! @relates Map
+    //!
+    //! Returns a new `Map` containing all the `(key, value)` pairs of the
+    //! original, except those whose key is contained in the given
+    //! `Searchable`. This is equivalent to calling `erase_key` for each
+    //! of the keys, except the new map is built in a single step.
+    //!
+    //!
+    //! @param map
+    //! The map in which to erase keys.
+    //!
+    //! @param keys
+    //! A `Searchable` holding the keys to remove from the `Map`, like a
+    //! `Tuple` or a `Set`. Whether it contains a key of the map must be
+    //! known at compile-time.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/map.cpp erase_keys
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto erase_keys = [](auto&& map, auto&& keys) -> decltype(auto) {
+        return tag-dispatched;
+    };
+#else
+    template <typename M, typename = void>
+    struct erase_keys_impl;
+
+    template <typename M, typename>
+    struct erase_keys_impl : erase_keys_impl<M, when<true>> { };
+
+    struct _erase_keys {
+        template <typename Map, typename Keys>
+        constexpr decltype(auto) operator()(Map&& map, Keys&& keys) const {
+            return erase_keys_impl<typename datatype<Map>::type>::apply(
+                static_cast<Map&&>(map),
+                static_cast<Keys&&>(keys)
+            );
+        }
+    };
+
+    constexpr _erase_keys erase_keys{};
+#endif
+
+    //! Merges two `Map`s.
+    //! @relates Map
+    //!
+    //! Given two maps `m1` and `m2`, `union_(m1, m2)` is a new map containing
+    //! the `(key, value)` pairs of `m1`, followed by those of `m2` whose key
+    //! is not in `m1`. When a key is in both maps, the value associated to
+    //! it in `m2` is kept by default. Another policy can be provided with
+    //! a binary function `f`, in which case the key is associated to
+    //! `f(v1, v2)`, where `v1` and `v2` are the values associated to the
+    //! key in `m1` and `m2`, respectively.
+    //!
+    //!
+    //! @param m1, m2
+    //! The maps to merge.
+    //!
+    //! @param f
+    //! An optional binary function resolving conflicts between the values
+    //! associated to a key present in both maps.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/map.cpp union_
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto union_ = [](auto&& m1, auto&& m2[, auto&& f]) -> decltype(auto) {
+        return tag-dispatched;
+    };
+#endif
 }} // end namespace boost::hana
 
 #endif // !BOOST_HANA_FWD_MAP_HPP
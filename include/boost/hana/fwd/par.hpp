@@ -0,0 +1,197 @@
+/*!
+@file
+Forward declares `boost::hana::par`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_PAR_HPP
+#define BOOST_HANA_FWD_PAR_HPP
+
+#include <boost/hana/detail/std/size_t.hpp>
+
+
+namespace boost { namespace hana {
+    //! Execution policy requesting that an algorithm runs in parallel.
+    //!
+    //! Some algorithms accept `par` as an additional first argument, in
+    //! which case the elements of the structure are split into contiguous
+    //! chunks that are processed concurrently by a small pool of threads
+    //! shared by the whole program. These overloads are only available for
+    //! structures whose elements are known at runtime and all have the same
+    //! type, i.e. `std::vector`, `std::array` and homogeneous `Tuple`s.
+    //! The algorithms supporting `par` are
+    //! @code
+    //!     transform(par, xs, f)
+    //!     for_each(par, xs, f)
+    //!     sum<M>(par, xs)
+    //!     product<R>(par, xs)
+    //!     count_if(par, xs, pred)
+    //!     any_of(par, xs, pred)
+    //! @endcode
+    //!
+    //! The result of `transform` is a structure of the same kind as `xs`.
+    //! `sum` and `product` reduce each chunk and then combine the partial
+    //! results in order with the Monoid's `plus` and the Ring's `mult`
+    //! respectively, so only associativity is required of these operations.
+    //! `count_if` returns a `std::size_t` and `any_of` returns a `bool`;
+    //! `any_of` stops looking at new elements as soon as one of them is
+    //! found to satisfy the predicate.
+    //!
+    //! A chunk always contains at least `par.threshold` elements, which
+    //! means that structures with no more than that many elements are
+    //! processed serially in the calling thread, without any overhead.
+    //! The threshold can be changed by calling `par(threshold)`, which is
+    //! useful when processing each element is very expensive. If the
+    //! function throws for some element, no new chunk is started and the
+    //! first exception is rethrown in the calling thread once the chunks
+    //! that were already running have completed.
+    //!
+    //! @note
+    //! The function passed to the algorithm is called concurrently from
+    //! several threads, and in no particular order. It is the user's
+    //! responsibility to make sure this does not introduce data races.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/par.cpp main
+    struct _par {
+        constexpr explicit _par(detail::std::size_t threshold)
+            : threshold{threshold}
+        { }
+
+        constexpr _par operator()(detail::std::size_t threshold) const
+        { return _par{threshold}; }
+
+        detail::std::size_t threshold;
+    };
+
+    constexpr _par par{1024};
+
+    //! Extension point for the algorithms taking the `par` execution policy.
+    //!
+    //! A specialization of `par_impl` for a data type `S` must provide the
+    //! static functions `transform`, `for_each`, `sum`, `product`, `count_if`
+    //! and `any_of`, which are called with the `_par` object followed by the
+    //! arguments given to the corresponding algorithm. `sum` and `product`
+    //! are templates taking the Monoid or the Ring as their first template
+    //! parameter.
+    template <typename S, typename = void>
+    struct par_impl;
+
+    //! Call a function on each element of a structure, concurrently.
+    //!
+    //! Whereas `par` splits a homogeneous sequence into chunks of elements,
+    //! `for_each_parallel(xs, f)` runs a separate task for each element of
+    //! the `Foldable` structure `xs`, whose elements may all have different
+    //! types. This is meant for structures holding a few independent and
+    //! expensive pieces of work, like a tuple of initialization stages. The
+    //! tasks run on the pool of threads used by `par`; the calling thread
+    //! takes part in the work and returns once `f` was called on every
+    //! element.
+    //!
+    //! Each element is processed regardless of whether `f` throws for other
+    //! elements. Once all the tasks have completed, a `parallel_error`
+    //! holding the exceptions of all the failing tasks is thrown if any
+    //! task threw, even if a single one did. Hence, callers only need to
+    //! handle `parallel_error`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/par.cpp for_each_parallel
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto for_each_parallel = [](auto&& xs, auto&& f) {
+        return unspecified-type;
+    };
+#else
+    struct _for_each_parallel {
+        template <typename Xs, typename F>
+        void operator()(Xs&& xs, F&& f) const;
+    };
+
+    constexpr _for_each_parallel for_each_parallel{};
+#endif
+
+    //! Exception thrown when one or more of the tasks started by
+    //! `for_each_parallel`, `transform_parallel` or `eval_parallel` throw.
+    //!
+    //! `exceptions()` returns a `std::vector<std::exception_ptr>` with one
+    //! entry per element of the structure, in the same order. The entry of
+    //! an element whose task did not throw is null.
+    struct parallel_error;
+
+    //! Apply a function to each element of a structure, concurrently, and
+    //! return a `Tuple` of the results.
+    //!
+    //! `transform_parallel(xs, f)` runs `f(x)` in a separate task for each
+    //! element `x` of the `Foldable` structure `xs`, in the same way as
+    //! `for_each_parallel`, and returns a `Tuple` holding the results in the
+    //! order of the elements they were computed from. The results may all
+    //! have different types, but they must be move-constructible. Exceptions
+    //! are handled like in `for_each_parallel`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/par.cpp transform_parallel
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto transform_parallel = [](auto&& xs, auto&& f) {
+        return unspecified-type;
+    };
+#else
+    struct _transform_parallel {
+        template <typename Xs, typename F>
+        auto operator()(Xs&& xs, F&& f) const;
+    };
+
+    constexpr _transform_parallel transform_parallel{};
+#endif
+
+    //! Evaluate lazy computations concurrently.
+    //!
+    //! `eval_parallel(xs)` evaluates every lazy value of the `Foldable`
+    //! structure `xs` in its own task and returns a `Tuple` of the results,
+    //! in order. It is equivalent to `transform_parallel(xs, eval)`.
+    //!
+    //! `eval_parallel(stages, dependencies)` evaluates a static graph of
+    //! tasks. `stages` is a `Map` from compile-time keys to lazy values, and
+    //! `dependencies` is a `Map` from some of these keys to a `Foldable` of
+    //! the keys of the stages that must complete before that stage starts.
+    //! The result is a `Map` from each key to the result of its stage. The
+    //! graph is checked at compile-time: every prerequisite must be a key of
+    //! `stages` and the dependencies may not contain cycles.
+    //!
+    //! The stages are started in an order compatible with the dependencies,
+    //! and each stage starts as soon as all its prerequisites completed, on
+    //! the pool of threads used by `par`. If a stage throws, the stages that
+    //! depend on it, directly or not, are not evaluated; the other stages
+    //! still run to completion. Once all of them are done, exceptions are
+    //! reported like in `for_each_parallel`, with the stages in the order
+    //! of `stages`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/par.cpp eval_parallel
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto eval_parallel = [](auto&& xs[, auto&& dependencies]) {
+        return unspecified-type;
+    };
+#else
+    struct _eval_parallel {
+        template <typename Xs>
+        auto operator()(Xs&& xs) const;
+
+        template <typename Stages, typename Dependencies>
+        auto operator()(Stages&& stages, Dependencies const& dependencies) const;
+    };
+
+    constexpr _eval_parallel eval_parallel{};
+#endif
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_FWD_PAR_HPP
@@ -18,6 +18,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/core/default.hpp>
 #include <boost/hana/fwd/core/models.hpp>
 #include <boost/hana/fwd/core/operators.hpp>
+#include <boost/hana/fwd/par.hpp>
 
 
 namespace boost { namespace hana {
@@ -188,6 +189,13 @@ namespace boost { namespace hana {
 
             return AnyOf::apply(static_cast<Xs&&>(xs), static_cast<Pred&&>(pred));
         }
+
+        template <typename Xs, typename Pred>
+        decltype(auto) operator()(_par const& policy, Xs&& xs, Pred&& pred) const {
+            using S = typename datatype<Xs>::type;
+            return par_impl<S>::any_of(policy, static_cast<Xs&&>(xs),
+                                       static_cast<Pred&&>(pred));
+        }
     };
 
     constexpr _any_of any_of{};
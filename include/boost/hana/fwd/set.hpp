@@ -11,7 +11,10 @@ Distributed under the Boost Software License, Version 1.0.
 #define BOOST_HANA_FWD_SET_HPP
 
 #include <boost/hana/detail/erase_key_fwd.hpp>
+#include <boost/hana/detail/union_fwd.hpp>
+#include <boost/hana/fwd/core/datatype.hpp>
 #include <boost/hana/fwd/core/make.hpp>
+#include <boost/hana/fwd/core/when.hpp>
 
 
 namespace boost { namespace hana {
@@ -40,6 +43,19 @@ namespace boost { namespace hana {
     //! @snippet example/set.cpp Searchable
     //!
     //!
+    //! Constant-time lookup
+    //! --------------------
+    //! When all the elements of a set are `Type`s, `IntegralConstant`s or
+    //! `String`s, looking for one such object in the set is done without
+    //! comparing it with each element of the set. Instead, the set is seen
+    //! as a class inheriting from one empty base per element, and lookup
+    //! is a check for a base class, which the compiler performs in constant
+    //! time. Hence, `contains`, `find` and `insert` require a constant number
+    //! of instantiations, and comparing two such sets with `equal` or
+    //! `is_subset` requires a linear number of them. Otherwise, these
+    //! operations fall back to comparing the elements with `equal`.
+    //!
+    //!
     //! Conversion from any `Foldable`
     //! ------------------------------
     //! Any `Foldable` structure can be converted into a `Set` by using
@@ -137,6 +153,129 @@ namespace boost { namespace hana {
         return tag-dispatched;
     };
 #endif
+
+    //! Returns the union of two sets.
+    //! @relates Set
+    //!
+    //! Given two sets `xs` and `ys`, `union_(xs, ys)` is a new set containing
+    //! all the elements of `xs`, followed by the elements of `ys` that are
+    //! not in `xs`. The new set is built in a single step, without inserting
+    //! the elements of `ys` one at a time.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/set.cpp union_
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto union_ = [](auto&& xs, auto&& ys) -> decltype(auto) {
+        return tag-dispatched;
+    };
+#endif
+
+    //! Returns the intersection of two sets.
+    //! @relates Set
+    //!
+    //! Given two sets `xs` and `ys`, `intersection(xs, ys)` is a new set
+    //! containing the elements of `xs` that are also in `ys`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/set.cpp intersection
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto intersection = [](auto&& xs, auto&& ys) -> decltype(auto) {
+        return tag-dispatched;
+    };
+#else
+    template <typename S, typename = void>
+    struct intersection_impl;
+
+    template <typename S, typename>
+    struct intersection_impl : intersection_impl<S, when<true>> { };
+
+    struct _intersection {
+        template <typename Xs, typename Ys>
+        constexpr decltype(auto) operator()(Xs&& xs, Ys&& ys) const {
+            return intersection_impl<typename datatype<Xs>::type>::apply(
+                static_cast<Xs&&>(xs),
+                static_cast<Ys&&>(ys)
+            );
+        }
+    };
+
+    constexpr _intersection intersection{};
+#endif
+
+    //! Returns the difference of two sets.
+    //! @relates Set
+    //!
+    //! Given two sets `xs` and `ys`, `difference(xs, ys)` is a new set
+    //! containing the elements of `xs` that are not in `ys`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/set.cpp difference
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto difference = [](auto&& xs, auto&& ys) -> decltype(auto) {
+        return tag-dispatched;
+    };
+#else
+    template <typename S, typename = void>
+    struct difference_impl;
+
+    template <typename S, typename>
+    struct difference_impl : difference_impl<S, when<true>> { };
+
+    struct _difference {
+        template <typename Xs, typename Ys>
+        constexpr decltype(auto) operator()(Xs&& xs, Ys&& ys) const {
+            return difference_impl<typename datatype<Xs>::type>::apply(
+                static_cast<Xs&&>(xs),
+                static_cast<Ys&&>(ys)
+            );
+        }
+    };
+
+    constexpr _difference difference{};
+#endif
+
+    //! Returns the symmetric difference of two sets.
+    //! @relates Set
+    //!
+    //! Given two sets `xs` and `ys`, `symmetric_difference(xs, ys)` is a new
+    //! set containing the elements of `xs` that are not in `ys`, followed by
+    //! the elements of `ys` that are not in `xs`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/set.cpp symmetric_difference
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto symmetric_difference = [](auto&& xs, auto&& ys) -> decltype(auto) {
+        return tag-dispatched;
+    };
+#else
+    template <typename S, typename = void>
+    struct symmetric_difference_impl;
+
+    template <typename S, typename>
+    struct symmetric_difference_impl
+        : symmetric_difference_impl<S, when<true>>
+    { };
+
+    struct _symmetric_difference {
+        template <typename Xs, typename Ys>
+        constexpr decltype(auto) operator()(Xs&& xs, Ys&& ys) const {
+            return symmetric_difference_impl<typename datatype<Xs>::type>::apply(
+                static_cast<Xs&&>(xs),
+                static_cast<Ys&&>(ys)
+            );
+        }
+    };
+
+    constexpr _symmetric_difference symmetric_difference{};
+#endif
 }} // end namespace boost::hana
 
 #endif // !BOOST_HANA_FWD_SET_HPP
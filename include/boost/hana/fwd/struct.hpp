@@ -13,6 +13,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/detail/dispatch_if.hpp>
 #include <boost/hana/detail/keys_fwd.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
 #include <boost/hana/fwd/core/datatype.hpp>
 #include <boost/hana/fwd/core/models.hpp>
 
@@ -134,6 +135,14 @@ namespace boost { namespace hana {
     //! provided for models of the `Struct` concept.
     //! @snippet example/struct.cpp Foldable
     //!
+    //! When an lvalue `Struct` is folded, the second element of each pair
+    //! is a reference to the corresponding member, so that no member is
+    //! ever copied by `unpack`, `for_each` or `fold`. When an rvalue
+    //! `Struct` is folded, its members are moved into the pairs instead.
+    //! Conversions are different: `to<Map>` and `to<Tuple>`, or any other
+    //! `Sequence`, always create a structure holding copies of the members
+    //! of an lvalue `Struct`, so that the result never refers to it.
+    //!
     //! Being a model of `Foldable` makes it possible to turn a `Struct`
     //! into basically any `Sequence`, but also into a `Map` by simply
     //! using the `to<...>` function!
@@ -214,7 +223,9 @@ namespace boost { namespace hana {
     //!
     //! Given a `Struct` object, `members` returns a `Sequence` containing
     //! all the members of the `Struct`, in the same order as their respective
-    //! accessor appears in the `accessors` sequence.
+    //! accessor appears in the `accessors` sequence. The members are copied
+    //! into the resulting sequence, or moved if the object is an rvalue;
+    //! use `members_ref` to get references to the members instead.
     //!
     //!
     //! Example
@@ -248,6 +259,263 @@ namespace boost { namespace hana {
     constexpr _members members{};
 #endif
 
+    //! Returns a `Tuple` of references to the members of a `Struct`.
+    //! @relates Struct
+    //!
+    //! Given a `Struct` object, `members_ref` returns a `Tuple` holding
+    //! whatever the accessors of the `Struct` return when they are applied
+    //! to the object, without copying it. Hence, for `Struct`s whose
+    //! accessors return references to the members, which is the case of
+    //! `Struct`s defined with the `BOOST_HANA_DEFINE_STRUCT` and the
+    //! `BOOST_HANA_ADAPT_STRUCT` macros, the result holds lvalue references
+    //! to the members of an lvalue object and rvalue references to the
+    //! members of an rvalue object. Of course, the result must not be used
+    //! after the object has been destroyed.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/struct.cpp members_ref
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto members_ref = [](auto&& struct_) {
+        return unspecified-type;
+    };
+#else
+    struct _members_ref {
+        template <typename Object>
+        constexpr decltype(auto) operator()(Object&& object) const;
+    };
+
+    constexpr _members_ref members_ref{};
+#endif
+
+    //! Returns a `Tuple` of lvalue references to the members of a `Struct`.
+    //! @relates Struct
+    //!
+    //! This is equivalent to `members_ref`, except it only accepts lvalue
+    //! objects, which guarantees that the result does not contain rvalue
+    //! references. This is mostly useful to compare or hash `Struct`s
+    //! lexicographically without copying their members.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/struct.cpp tie_members
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto tie_members = [](auto& struct_) {
+        return unspecified-type;
+    };
+#else
+    struct _tie_members {
+        template <typename Object>
+        constexpr decltype(auto) operator()(Object&& object) const;
+    };
+
+    constexpr _tie_members tie_members{};
+#endif
+
+    //! Calls a function on the member of a `Struct` whose name is only
+    //! known at runtime.
+    //! @relates Struct
+    //!
+    //! Given a `Struct` object, a runtime name and a function `f`,
+    //! `visit_member` calls `f` with the member of the object whose name
+    //! is equal to the given runtime name and returns `true`. If the
+    //! `Struct` has no such member, `f` is not called and `false` is
+    //! returned. This is useful for filling a `Struct` with data whose
+    //! layout is only known at runtime, for example when deserializing
+    //! a record whose fields can appear in any order.
+    //!
+    //! The names of the members must be compile-time `String`s, which is
+    //! the case for `Struct`s defined with the `BOOST_HANA_DEFINE_STRUCT`
+    //! and the `BOOST_HANA_ADAPT_STRUCT` macros. The table used to map
+    //! names to members is generated at compile-time from the `accessors`
+    //! of the `Struct`; a lookup only hashes the runtime name and performs
+    //! a constant number of string comparisons on average, regardless of
+    //! the number of members.
+    //!
+    //!
+    //! @param object
+    //! The `Struct` object whose member should be visited. The member is
+    //! retrieved by applying the corresponding accessor to the object,
+    //! which means that the object is perfect-forwarded to the accessor.
+    //!
+    //! @param name
+    //! The name of the member to visit. This can either be a null-terminated
+    //! `char const*` or any object with `data()` and `size()` methods, like
+    //! `std::string`.
+    //!
+    //! @param f
+    //! A function called as `f(member)` if a member with the given name
+    //! exists. Since the member to visit is selected at runtime, `f` must
+    //! be callable with any member of the `Struct`. The result of `f`, if
+    //! any, is ignored.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/struct.cpp visit_member
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto visit_member = [](auto&& object, auto const& name, auto&& f) -> bool {
+        return unspecified;
+    };
+#else
+    struct _visit_member {
+        template <typename Object, typename Name, typename F>
+        bool operator()(Object&& object, Name const& name, F&& f) const;
+    };
+
+    constexpr _visit_member visit_member{};
+#endif
+
+    //! Describes how a member of a `Struct` is laid out in memory.
+    //! @relates Struct
+    //!
+    //! `member_layout` is the element type of the table returned by
+    //! `layout`. `offset`, `size` and `alignment` are respectively the
+    //! offset of the member from the beginning of its object, its `sizeof`
+    //! and its `alignof`, and `trivially_copyable` tells whether the member
+    //! can be copied with `std::memcpy`.
+    struct member_layout {
+        detail::std::size_t offset;
+        detail::std::size_t size;
+        detail::std::size_t alignment;
+        bool trivially_copyable;
+    };
+
+    //! Describes a run of adjacent members of a `Struct` that can be
+    //! copied as a single block of memory.
+    //! @relates Struct
+    //!
+    //! `member_run` is the element type of the table returned by
+    //! `contiguous_trivial_runs`. The run is made of the members at indices
+    //! `[first, last)` in the `accessors` sequence; it starts at `offset`
+    //! bytes from the beginning of its object and spans `size` bytes.
+    struct member_run {
+        detail::std::size_t first;
+        detail::std::size_t last;
+        detail::std::size_t offset;
+        detail::std::size_t size;
+    };
+
+    //! Returns a compile-time table describing the memory layout of the
+    //! members of a `Struct`.
+    //! @relates Struct
+    //!
+    //! Given a `Struct` `S`, `layout<S>()` is a `constexpr` array of
+    //! `member_layout`s with one element per accessor of `S`, in the same
+    //! order as the `accessors` sequence. The array can be indexed with
+    //! `operator[]` and iterated with `begin()` and `end()`, and its
+    //! `size()` is the number of members.
+    //!
+    //! The offsets of the members can only be known when `S` is a
+    //! standard-layout type defined with the `BOOST_HANA_DEFINE_STRUCT` or
+    //! the `BOOST_HANA_ADAPT_STRUCT` macro, or when `S` provides a
+    //! `member_offsets` function in its accessors, like the macros do.
+    //! Using `layout` with any other `Struct` is an error.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/struct.cpp layout
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    template <typename S>
+    constexpr auto layout = []() {
+        return unspecified-array-of-member_layout;
+    };
+#else
+    template <typename S>
+    struct _layout {
+        constexpr decltype(auto) operator()() const;
+    };
+
+    template <typename S>
+    constexpr _layout<S> layout{};
+#endif
+
+    //! Returns the number of bytes of a `Struct` which are not occupied by
+    //! any of its members, as an `IntegralConstant`.
+    //! @relates Struct
+    //!
+    //! This includes the padding between members, the padding at the end
+    //! of the `Struct`, and the bytes of any member which is not part of
+    //! the `accessors` sequence.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/struct.cpp layout
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    template <typename S>
+    constexpr auto padding_bytes = []() {
+        return size_t<sizeof(S) - sum of sizeof(members)>;
+    };
+#else
+    template <typename S>
+    struct _padding_bytes {
+        constexpr auto operator()() const;
+    };
+
+    template <typename S>
+    constexpr _padding_bytes<S> padding_bytes{};
+#endif
+
+    //! Returns whether a `Struct` is made of its members only, without
+    //! any padding, as a boolean `IntegralConstant`.
+    //! @relates Struct
+    //!
+    //! This is equivalent to `padding_bytes<S>() == size_t<0>`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/struct.cpp layout
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    template <typename S>
+    constexpr auto is_tightly_packed = []() {
+        return bool_<padding_bytes<S>() == 0>;
+    };
+#else
+    template <typename S>
+    struct _is_tightly_packed {
+        constexpr auto operator()() const;
+    };
+
+    template <typename S>
+    constexpr _is_tightly_packed<S> is_tightly_packed{};
+#endif
+
+    //! Returns a compile-time table of the runs of adjacent trivially
+    //! copyable members of a `Struct` with no padding between them.
+    //! @relates Struct
+    //!
+    //! Given a `Struct` `S`, `contiguous_trivial_runs<S>()` is a `constexpr`
+    //! array of `member_run`s, in the order of the `accessors` sequence.
+    //! Each trivially copyable member of `S` belongs to exactly one run,
+    //! and members which are not trivially copyable belong to none. A run
+    //! can be copied with a single `std::memcpy`, which lets serializers,
+    //! hashers and loaders avoid handling each member separately. Like for
+    //! `layout`, the offsets of the members of `S` must be known.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/struct.cpp layout
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    template <typename S>
+    constexpr auto contiguous_trivial_runs = []() {
+        return unspecified-array-of-member_run;
+    };
+#else
+    template <typename S>
+    struct _contiguous_trivial_runs {
+        constexpr decltype(auto) operator()() const;
+    };
+
+    template <typename S>
+    constexpr _contiguous_trivial_runs<S> contiguous_trivial_runs{};
+#endif
+
     // Note:
     // For the two macros below, their weird definition as variables seems to
     // exploit a glitch in Doxygen, which makes the macros appear in the
@@ -0,0 +1,153 @@
+/*!
+@file
+Defines `boost::hana::Hashable`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_HASHABLE_HPP
+#define BOOST_HANA_HASHABLE_HPP
+
+#include <boost/hana/fwd/hashable.hpp>
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/constant.hpp>
+#include <boost/hana/core/datatype.hpp>
+#include <boost/hana/core/default.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
+#include <boost/hana/detail/std/is_enum.hpp>
+#include <boost/hana/detail/std/is_integral.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // hash
+    //////////////////////////////////////////////////////////////////////////
+    template <typename T, typename>
+    struct hash_impl : hash_impl<T, when<true>> { };
+
+    template <typename T, bool condition>
+    struct hash_impl<T, when<condition>> : default_ {
+        static void apply(...) { }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // models
+    //////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    struct models_impl<Hashable, T>
+        : _integral_constant<bool, !is_default<hash_impl<T>>{}()>
+    { };
+
+    namespace hash_detail {
+        // Scrambles the bits of an integer; this is the finalizer of the
+        // SplitMix64 generator.
+        constexpr detail::std::size_t mix(unsigned long long z) {
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+            return static_cast<detail::std::size_t>(z ^ (z >> 31));
+        }
+
+        // Combines the hash `h` of an element into the hash `seed` of the
+        // elements that precede it.
+        constexpr detail::std::size_t
+        combine(detail::std::size_t seed, detail::std::size_t h) {
+            return seed ^ (h + static_cast<detail::std::size_t>(0x9e3779b97f4a7c15ull)
+                             + (seed << 6) + (seed >> 2));
+        }
+
+        // Hashes `n` bytes of memory, by blocks of 8 bytes.
+        template <typename Byte>
+        constexpr detail::std::size_t
+        bytes(Byte const* p, detail::std::size_t n) {
+            detail::std::size_t seed = mix(n);
+            detail::std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                unsigned long long word = 0;
+                for (detail::std::size_t j = 0; j < 8; ++j)
+                    word |= static_cast<unsigned long long>(
+                        static_cast<unsigned char>(p[i + j])) << (8 * j);
+                seed = combine(seed, mix(word));
+            }
+            if (i < n) {
+                unsigned long long word = 0;
+                for (detail::std::size_t j = 0; i + j < n; ++j)
+                    word |= static_cast<unsigned long long>(
+                        static_cast<unsigned char>(p[i + j])) << (8 * j);
+                seed = combine(seed, mix(word));
+            }
+            return seed;
+        }
+
+        // Whether objects of type `T` can be hashed through their bytes.
+        // This is the case when equal objects have the same bytes.
+        template <typename T>
+        struct is_bytewise : detail::std::integral_constant<bool,
+            detail::std::is_integral<T>{}() || detail::std::is_enum<T>{}()
+        > { };
+
+        // Returns the value of an integer in a form that is the same for all
+        // the integers comparing equal to it. Integers are compared after
+        // being converted to their common type, which is at least `int`, so
+        // `-1 == 0xFFFFFFFFu` and `-1 == 0xFFFFFFFFFFFFFFFFull`. Hence, the
+        // negative values of an `int` are represented like the `unsigned int`
+        // they compare equal to, and other values are represented modulo the
+        // range of `unsigned long long`, which is what they compare equal to
+        // as an `unsigned long long`.
+        template <typename T>
+        constexpr unsigned long long integral_value(T x) {
+            unsigned long long const u = static_cast<unsigned long long>(x);
+            unsigned long long const int_min = static_cast<unsigned long long>(
+                -static_cast<long long>(static_cast<unsigned int>(-1) / 2) - 1
+            );
+            return u >= int_min ? static_cast<unsigned int>(u) : u;
+        }
+
+        // Combines the hashes of several objects, in order.
+        struct hash_elements {
+            template <typename ...X>
+            constexpr detail::std::size_t operator()(X const& ...x) const {
+                detail::std::size_t hashes[] = {hana::hash(x)..., 0};
+                detail::std::size_t seed = mix(sizeof...(X));
+                for (detail::std::size_t i = 0; i < sizeof...(X); ++i)
+                    seed = combine(seed, hashes[i]);
+                return seed;
+            }
+        };
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Model for integral and enumeration types
+    //////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    struct hash_impl<T, when<hash_detail::is_bytewise<T>{}()>> {
+        static constexpr detail::std::size_t apply(T x)
+        { return hash_detail::mix(hash_detail::integral_value(x)); }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Model for Constants over a Hashable data type
+    //////////////////////////////////////////////////////////////////////////
+    template <typename C>
+    struct hash_impl<C, when<
+        _models<Constant, C>{}() &&
+        _models<Hashable, typename C::value_type>{}()
+    >> {
+        template <typename X>
+        struct _hash_value {
+            static constexpr detail::std::size_t value =
+                hana::hash(hana::value<X>());
+        };
+
+        template <typename X>
+        static constexpr detail::std::size_t apply(X const&)
+        { return _hash_value<X>::value; }
+    };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_HASHABLE_HPP
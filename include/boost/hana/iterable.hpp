@@ -125,8 +125,8 @@ namespace boost { namespace hana {
         static constexpr decltype(auto) apply(Xs&& xs, Index&& n) {
             using I = typename datatype<Index>::type;
             return hana::eval_if(hana::equal(n, zero<I>()),
-                hana::lazy(head)(xs),
-                hana::lazy(next{})(xs, n)
+                hana::lazy_ref(head)(static_cast<Xs&&>(xs)),
+                hana::lazy_ref(next{})(static_cast<Xs&&>(xs), n)
             );
         }
     };
@@ -153,7 +153,7 @@ namespace boost { namespace hana {
         static constexpr auto apply(Xs xs) {
             return hana::eval_if(hana::is_empty(hana::tail(xs)),
                 hana::always(hana::head(xs)),
-                hana::lazy(hana::compose(last, tail))(xs)
+                hana::lazy_ref(hana::compose(last, tail))(xs)
             );
         }
     };
@@ -172,7 +172,7 @@ namespace boost { namespace hana {
             return hana::eval_if(
                 hana::or_(hana::equal(n, zero<I>()), hana::is_empty(xs)),
                 hana::always(xs),
-                hana::lazy(hana::lockstep(drop.at_most)(tail, pred))(xs, n)
+                hana::lazy_ref(hana::lockstep(drop.at_most)(tail, pred))(xs, n)
             );
         }
     };
@@ -220,8 +220,8 @@ namespace boost { namespace hana {
             template <typename Xs, typename Pred>
             constexpr decltype(auto) operator()(Xs&& xs, Pred&& pred) const {
                 return hana::eval_if(pred(hana::head(xs)),
-                    hana::lazy(next{})(xs, pred),
-                    hana::lazy(xs)
+                    hana::lazy_ref(next{})(static_cast<Xs&&>(xs), pred),
+                    hana::lazy_ref(static_cast<Xs&&>(xs))
                 );
             }
         };
@@ -235,9 +235,9 @@ namespace boost { namespace hana {
         template <typename Xs, typename Pred>
         static constexpr auto apply(Xs&& xs, Pred&& pred) {
             return hana::eval_if(hana::is_empty(xs),
-                hana::lazy(xs),
-                hana::lazy(iterable_detail::drop_while_helper{})(
-                                            xs, static_cast<Pred&&>(pred))
+                hana::lazy_ref(static_cast<Xs&&>(xs)),
+                hana::lazy_ref(iterable_detail::drop_while_helper{})(
+                    static_cast<Xs&&>(xs), static_cast<Pred&&>(pred))
             );
         }
     };
@@ -327,8 +327,8 @@ namespace boost { namespace hana {
         template <typename Xs, typename State, typename F>
         static constexpr auto apply(Xs xs, State s, F f) {
             return hana::eval_if(hana::is_empty(xs),
-                hana::lazy(s),
-                hana::lazy(iterable_detail::foldr_helper{})(xs, s, f)
+                hana::lazy_ref(s),
+                hana::lazy_ref(iterable_detail::foldr_helper{})(xs, s, f)
             );
         }
     };
@@ -338,8 +338,8 @@ namespace boost { namespace hana {
         template <typename Xs, typename F>
         static constexpr auto apply(Xs xs, F f) {
             return hana::eval_if(hana::is_empty(hana::tail(xs)),
-                hana::lazy(hana::head)(xs),
-                hana::lazy(iterable_detail::foldr1_helper{})(xs, f)
+                hana::lazy_ref(hana::head)(xs),
+                hana::lazy_ref(iterable_detail::foldr1_helper{})(xs, f)
             );
         }
     };
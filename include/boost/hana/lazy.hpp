@@ -134,6 +134,54 @@ namespace boost { namespace hana {
     }
     //! @endcond
 
+    //////////////////////////////////////////////////////////////////////////
+    // lazy_ref
+    //////////////////////////////////////////////////////////////////////////
+    template <typename F, typename Args>
+    struct _lazy_ref_apply;
+
+    template <typename F, typename ...Args>
+    struct _lazy_ref_apply<F, detail::closure_impl<Args...>> : operators::adl {
+        F&& function;
+        detail::closure_impl<Args...> args;
+
+        template <typename ...Args_>
+        explicit constexpr _lazy_ref_apply(F&& f, Args_&& ...x)
+            : function(static_cast<F&&>(f))
+            , args(static_cast<Args_&&>(x)...)
+        { }
+
+        using hana = _lazy_ref_apply;
+        using datatype = Lazy;
+    };
+
+    template <typename X>
+    struct _lazy_ref_value : operators::adl {
+        X&& value;
+
+        explicit constexpr _lazy_ref_value(X&& x)
+            : value(static_cast<X&&>(x))
+        { }
+
+        // If this is called, we assume that `value` is in fact a function.
+        template <typename ...Args>
+        constexpr auto operator()(Args&& ...args) const {
+            return _lazy_ref_apply<X, detail::closure<Args&&...>>{
+                static_cast<X&&>(value), static_cast<Args&&>(args)...
+            };
+        }
+
+        using hana = _lazy_ref_value;
+        using datatype = Lazy;
+    };
+
+    //! @cond
+    template <typename X>
+    constexpr auto _lazy_ref::operator()(X&& x) const {
+        return _lazy_ref_value<X>{static_cast<X&&>(x)};
+    }
+    //! @endcond
+
     //////////////////////////////////////////////////////////////////////////
     // Operators
     //////////////////////////////////////////////////////////////////////////
@@ -179,6 +227,22 @@ namespace boost { namespace hana {
         template <typename X>
         static constexpr X apply(_lazy_value<X>&& expr)
         { return detail::std::move(expr.value); }
+
+        // _lazy_ref_apply
+        template <typename F, typename ...Args>
+        static constexpr decltype(auto)
+        apply(_lazy_ref_apply<F, detail::closure_impl<Args...>> const& expr) {
+            return static_cast<F&&>(expr.function)(
+                static_cast<typename Args::get_type&&>(
+                    static_cast<Args const&>(expr.args).get
+                )...
+            );
+        }
+
+        // _lazy_ref_value
+        template <typename X>
+        static constexpr X&& apply(_lazy_ref_value<X> const& expr)
+        { return static_cast<X&&>(expr.value); }
     };
 
     //////////////////////////////////////////////////////////////////////////
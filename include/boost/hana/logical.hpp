@@ -13,6 +13,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/logical.hpp>
 
 #include <boost/hana/bool.hpp>
+#include <boost/hana/config.hpp>
 #include <boost/hana/constant.hpp>
 #include <boost/hana/core/convert.hpp>
 #include <boost/hana/core/datatype.hpp>
@@ -274,6 +275,7 @@ namespace boost { namespace hana {
         _models<Constant, C>{}() &&
         _models<Logical, typename C::value_type>{}()
     >> {
+#ifndef BOOST_HANA_CONFIG_HAS_CXX1Z_IF_CONSTEXPR
         template <typename Then, typename Else>
         static constexpr decltype(auto)
         eval_if_helper(decltype(true_), Then&& t, Else&&)
@@ -283,14 +285,22 @@ namespace boost { namespace hana {
         static constexpr decltype(auto)
         eval_if_helper(decltype(false_), Then&&, Else&& e)
         { return hana::eval(static_cast<Else&&>(e)); }
+#endif
 
         template <typename Cond, typename Then, typename Else>
         static constexpr decltype(auto) apply(Cond const&, Then&& t, Else&& e) {
             constexpr auto cond = hana::value<Cond>();
             constexpr bool truth_value = hana::if_(cond, true, false);
+#ifdef BOOST_HANA_CONFIG_HAS_CXX1Z_IF_CONSTEXPR
+            if constexpr (truth_value)
+                return hana::eval(static_cast<Then&&>(t));
+            else
+                return hana::eval(static_cast<Else&&>(e));
+#else
             return eval_if_helper(bool_<truth_value>,
                                             static_cast<Then&&>(t),
                                             static_cast<Else&&>(e));
+#endif
         }
     };
 
@@ -12,25 +12,40 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/fwd/map.hpp>
 
+#include <boost/hana/bool.hpp>
 #include <boost/hana/comparable.hpp>
+#include <boost/hana/constant.hpp>
 #include <boost/hana/core/convert.hpp>
 #include <boost/hana/core/datatype.hpp>
 #include <boost/hana/core/make.hpp>
 #include <boost/hana/core/models.hpp>
 #include <boost/hana/core/operators.hpp>
 #include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/closure.hpp>
+#include <boost/hana/detail/constexpr/array.hpp>
 #include <boost/hana/detail/erase_key_fwd.hpp>
+#include <boost/hana/detail/find_index.hpp>
 #include <boost/hana/detail/insert_fwd.hpp>
+#include <boost/hana/detail/key_index.hpp>
 #include <boost/hana/detail/keys_fwd.hpp>
+#include <boost/hana/detail/std/conditional.hpp>
 #include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/declval.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
+#include <boost/hana/detail/std/is_lvalue_reference.hpp>
 #include <boost/hana/detail/std/move.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/detail/union_fwd.hpp>
 #include <boost/hana/foldable.hpp>
+#include <boost/hana/functional/arg.hpp>
 #include <boost/hana/functional/compose.hpp>
-#include <boost/hana/functional/demux.hpp>
-#include <boost/hana/functional/partial.hpp>
 #include <boost/hana/functor.hpp>
+#include <boost/hana/fwd/struct.hpp>
 #include <boost/hana/lazy.hpp>
 #include <boost/hana/logical.hpp>
+#include <boost/hana/maybe.hpp>
+#include <boost/hana/pair.hpp>
 #include <boost/hana/product.hpp>
 #include <boost/hana/searchable.hpp>
 #include <boost/hana/tuple.hpp>
@@ -63,6 +78,254 @@ namespace boost { namespace hana {
         { };
     }
 
+    namespace map_detail {
+        template <typename P>
+        using key_t = typename detail::std::decay<
+            decltype(hana::first(detail::std::declval<P>()))
+        >::type;
+
+        template <typename M>
+        struct index_of;
+
+        template <typename ...Pairs>
+        struct index_of<_map<Pairs...>> {
+            using type = detail::key_index<key_t<Pairs>...>;
+        };
+
+        template <typename M>
+        using index_t = typename index_of<
+            typename detail::std::decay<M>::type
+        >::type;
+
+        template <typename M>
+        using size = detail::std::integral_constant<detail::std::size_t,
+            decltype(hana::length(detail::std::declval<M>().storage))::value
+        >;
+
+        // For each key of the map `M1`, the index of the equal key in the
+        // map `M2`, or the size of `M2` if there is none. When the keys of
+        // both maps can be looked up in constant time, this requires a
+        // linear number of instantiations. Otherwise, the keys are compared
+        // with `equal`, which requires a quadratic number of them.
+        template <typename M1, typename M2,
+                  bool = index_t<M1>::available && index_t<M2>::available>
+        struct matches;
+
+        template <typename ...P1, typename ...P2>
+        struct matches<_map<P1...>, _map<P2...>, true> {
+            static constexpr detail::std::size_t get(detail::std::size_t i) {
+                using Index = detail::key_index<key_t<P2>...>;
+                constexpr detail::std::size_t indices[] = {
+                    Index::template find<key_t<P1>>()..., sizeof...(P2)
+                };
+                return indices[i];
+            }
+        };
+
+        template <typename ...P1, typename ...P2>
+        struct matches<_map<P1...>, _map<P2...>, false> {
+            static constexpr detail::std::size_t get(detail::std::size_t i) {
+                constexpr detail::std::size_t indices[] = {
+                    detail::find_equal<key_t<P1>, key_t<P2>...>()..., sizeof...(P2)
+                };
+                return indices[i];
+            }
+        };
+
+        template <typename M1, typename M2>
+        using matches_t = matches<
+            typename detail::std::decay<M1>::type,
+            typename detail::std::decay<M2>::type
+        >;
+
+        template <typename M1, typename M2>
+        constexpr bool all_matched() {
+            for (detail::std::size_t i = 0; i < size<M1>::value; ++i)
+                if (matches_t<M1, M2>::get(i) == size<M2>::value)
+                    return false;
+            return true;
+        }
+
+        // Indices of the pairs of `M2` whose key is not in `M1`.
+        template <typename M1, typename M2>
+        struct unmatched {
+            static constexpr auto apply() {
+                using detail::constexpr_::array;
+                using detail::std::size_t;
+
+                constexpr size_t N1 = size<M1>::value;
+                constexpr size_t N2 = size<M2>::value;
+                array<bool, N2 + 1> matched{};
+                for (size_t i = 0; i < N1; ++i)
+                    matched[matches_t<M1, M2>::get(i)] = true;
+
+                size_t keptN = 0;
+                for (size_t j = 0; j < N2; ++j)
+                    keptN += !matched[j];
+                return keptN;
+            }
+        };
+
+        template <typename M1, typename M2>
+        struct unmatched_indices {
+            static constexpr auto apply() {
+                using detail::constexpr_::array;
+                using detail::std::size_t;
+
+                constexpr size_t N1 = size<M1>::value;
+                constexpr size_t N2 = size<M2>::value;
+                array<bool, N2 + 1> matched{};
+                for (size_t i = 0; i < N1; ++i)
+                    matched[matches_t<M1, M2>::get(i)] = true;
+
+                array<size_t, unmatched<M1, M2>::apply()> kept_indices{};
+                size_t* kept = &kept_indices[0];
+                for (size_t j = 0; j < N2; ++j)
+                    if (!matched[j])
+                        *kept++ = j;
+                return kept_indices;
+            }
+        };
+
+        // Indices of the pairs of `M` whose key is not in the `Searchable`
+        // `Keys`.
+        template <typename M, typename Keys>
+        struct not_in;
+
+        template <typename ...Pairs, typename Keys>
+        struct not_in<_map<Pairs...>, Keys> {
+            static constexpr auto apply() {
+                using detail::constexpr_::count;
+                using detail::constexpr_::array;
+                using detail::std::size_t;
+                using detail::std::declval;
+
+                constexpr size_t N = sizeof...(Pairs);
+                constexpr array<bool, N> results = {{
+                    !hana::value<decltype(hana::contains(
+                        declval<Keys const&>(), declval<key_t<Pairs> const&>()
+                    ))>()...
+                }};
+                constexpr size_t keptN = count(&results[0], &results[N], true);
+                array<size_t, keptN> kept_indices{};
+                size_t* kept = &kept_indices[0];
+                for (size_t index = 0; index < N; ++index)
+                    if (results[index])
+                        *kept++ = index;
+                return kept_indices;
+            }
+        };
+
+        // Access the key or the value of a pair without copying it when
+        // it is a `hana::pair`; other `Product`s go through `first` and
+        // `second`.
+        struct first_ref {
+            template <typename First, typename Second>
+            constexpr First& operator()(_pair<First, Second>& p) const
+            { return p.first; }
+
+            template <typename First, typename Second>
+            constexpr First const& operator()(_pair<First, Second> const& p) const
+            { return p.first; }
+
+            template <typename First, typename Second>
+            constexpr First&& operator()(_pair<First, Second>&& p) const
+            { return static_cast<First&&>(p.first); }
+
+            template <typename P>
+            constexpr decltype(auto) operator()(P&& p) const
+            { return hana::first(static_cast<P&&>(p)); }
+        };
+
+        struct second_ref {
+            template <typename First, typename Second>
+            constexpr Second& operator()(_pair<First, Second>& p) const
+            { return p.second; }
+
+            template <typename First, typename Second>
+            constexpr Second const& operator()(_pair<First, Second> const& p) const
+            { return p.second; }
+
+            template <typename First, typename Second>
+            constexpr Second&& operator()(_pair<First, Second>&& p) const
+            { return static_cast<Second&&>(p.second); }
+
+            template <typename P>
+            constexpr decltype(auto) operator()(P&& p) const
+            { return hana::second(static_cast<P&&>(p)); }
+        };
+
+        // A `Tuple` holding copies of the keys or the values of a map, or
+        // the keys or values moved out of it when the map is an rvalue.
+        template <typename M, typename Get, detail::std::size_t ...i>
+        constexpr auto copy(M&& map, Get get, detail::std::index_sequence<i...>) {
+            (void)map; (void)get; // remove GCC warnings about unused parameters
+            return _tuple<typename detail::std::decay<
+                decltype(get(detail::get<i>(static_cast<M&&>(map).storage)))
+            >::type...>{get(detail::get<i>(static_cast<M&&>(map).storage))...};
+        }
+
+        // A `Tuple` referring to the keys or the values of a map. When the
+        // map is an rvalue, the tuple holds the keys or values moved out of
+        // it instead, so that it does not outlive them.
+        template <typename M, typename T>
+        using view_element = typename detail::std::conditional<
+            detail::std::is_lvalue_reference<M>::value,
+            T, typename detail::std::decay<T>::type
+        >::type;
+
+        template <typename M, typename Get, detail::std::size_t ...i>
+        constexpr auto view(M&& map, Get get, detail::std::index_sequence<i...>) {
+            (void)map; (void)get; // remove GCC warnings about unused parameters
+            return _tuple<view_element<M,
+                decltype(get(detail::get<i>(static_cast<M&&>(map).storage)))
+            >...>{get(detail::get<i>(static_cast<M&&>(map).storage))...};
+        }
+
+        template <typename M1, typename M2, typename F, detail::std::size_t i>
+        constexpr decltype(auto) merge_pair(M1&& m1, M2&&, F&&,
+            detail::std::integral_constant<detail::std::size_t, i>,
+            detail::std::false_type)
+        { return detail::get<i>(static_cast<M1&&>(m1).storage); }
+
+        template <typename M1, typename M2, typename F, detail::std::size_t i>
+        constexpr auto merge_pair(M1&& m1, M2&& m2, F&& f,
+            detail::std::integral_constant<detail::std::size_t, i>,
+            detail::std::true_type)
+        {
+            using P = typename detail::std::decay<
+                decltype(detail::get<i>(m1.storage))
+            >::type;
+            constexpr detail::std::size_t j = matches_t<M1, M2>::get(i);
+            return hana::make<typename datatype<P>::type>(
+                first_ref{}(detail::get<i>(static_cast<M1&&>(m1).storage)),
+                static_cast<F&&>(f)(
+                    second_ref{}(detail::get<i>(static_cast<M1&&>(m1).storage)),
+                    second_ref{}(detail::get<j>(static_cast<M2&&>(m2).storage))
+                )
+            );
+        }
+
+        template <typename M1, typename M2, typename F,
+                  detail::std::size_t ...i, detail::std::size_t ...j>
+        constexpr auto union_(M1&& m1, M2&& m2, F&& f,
+                              detail::std::index_sequence<i...>,
+                              detail::std::index_sequence<j...>)
+        {
+            (void)m1; (void)m2; (void)f; // remove GCC warnings about unused parameters
+            return hana::make<Map>(
+                map_detail::merge_pair(
+                    static_cast<M1&&>(m1), static_cast<M2&&>(m2), f,
+                    detail::std::integral_constant<detail::std::size_t, i>{},
+                    detail::std::integral_constant<bool,
+                        matches_t<M1, M2>::get(i) != size<M2>::value
+                    >{}
+                )...,
+                detail::get<j>(static_cast<M2&&>(m2).storage)...
+            );
+        }
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // make<Map>
     //////////////////////////////////////////////////////////////////////////
@@ -81,9 +344,10 @@ namespace boost { namespace hana {
     //////////////////////////////////////////////////////////////////////////
     template <>
     struct keys_impl<Map> {
-        template <typename Map>
-        static constexpr decltype(auto) apply(Map&& map) {
-            return hana::transform(static_cast<Map&&>(map).storage, first);
+        template <typename M>
+        static constexpr auto apply(M&& map) {
+            return map_detail::copy(static_cast<M&&>(map), map_detail::first_ref{},
+                detail::std::make_index_sequence<map_detail::size<M>::value>{});
         }
     };
 
@@ -91,9 +355,27 @@ namespace boost { namespace hana {
     // values
     //////////////////////////////////////////////////////////////////////////
     //! @cond
-    template <typename Map>
-    constexpr decltype(auto) _values::operator()(Map&& map) const {
-        return hana::transform(static_cast<Map&&>(map).storage, second);
+    template <typename M>
+    constexpr decltype(auto) _values::operator()(M&& map) const {
+        return map_detail::copy(static_cast<M&&>(map), map_detail::second_ref{},
+            detail::std::make_index_sequence<map_detail::size<M>::value>{});
+    }
+    //! @endcond
+
+    //////////////////////////////////////////////////////////////////////////
+    // keys_view and values_view
+    //////////////////////////////////////////////////////////////////////////
+    //! @cond
+    template <typename M>
+    constexpr decltype(auto) _keys_view::operator()(M&& map) const {
+        return map_detail::view(static_cast<M&&>(map), map_detail::first_ref{},
+            detail::std::make_index_sequence<map_detail::size<M>::value>{});
+    }
+
+    template <typename M>
+    constexpr decltype(auto) _values_view::operator()(M&& map) const {
+        return map_detail::view(static_cast<M&&>(map), map_detail::second_ref{},
+            detail::std::make_index_sequence<map_detail::size<M>::value>{});
     }
     //! @endcond
 
@@ -114,10 +396,11 @@ namespace boost { namespace hana {
         };
 
         template <typename M, typename P>
-        static constexpr decltype(auto) apply(M&& map, P&& pair) {
+        static constexpr auto apply(M&& map, P&& pair) {
             return hana::eval_if(hana::contains(map, hana::first(pair)),
-                hana::lazy(map),
-                hana::lazy(insert_helper{})(map, pair)
+                hana::lazy_ref(static_cast<M&&>(map)),
+                hana::lazy_ref(insert_helper{})(static_cast<M&&>(map),
+                                                static_cast<P&&>(pair))
             );
         }
     };
@@ -142,20 +425,87 @@ namespace boost { namespace hana {
         }
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // erase_keys
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct erase_keys_impl<Map> {
+        template <typename M, detail::std::size_t ...i>
+        static constexpr auto erase(M&& map, detail::std::index_sequence<i...>) {
+            (void)map; // remove GCC warning about unused parameter
+            return hana::make<Map>(detail::get<i>(static_cast<M&&>(map).storage)...);
+        }
+
+        template <typename M, typename Keys>
+        static constexpr auto apply(M&& map, Keys&&) {
+            return erase_keys_impl::erase(static_cast<M&&>(map),
+                tuple_detail::generate_index_sequence<map_detail::not_in<
+                    typename detail::std::decay<M>::type,
+                    typename detail::std::decay<Keys>::type
+                >>());
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // union_
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct union_impl<Map> {
+        template <typename M1, typename M2, typename F>
+        static constexpr auto apply(M1&& m1, M2&& m2, F&& f) {
+            return map_detail::union_(
+                static_cast<M1&&>(m1), static_cast<M2&&>(m2),
+                static_cast<F&&>(f),
+                detail::std::make_index_sequence<map_detail::size<M1>::value>{},
+                tuple_detail::generate_index_sequence<
+                    map_detail::unmatched_indices<M1, M2>
+                >()
+            );
+        }
+
+        template <typename M1, typename M2>
+        static constexpr auto apply(M1&& m1, M2&& m2) {
+            return union_impl::apply(static_cast<M1&&>(m1),
+                                     static_cast<M2&&>(m2),
+                                     hana::arg<2>);
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Comparable
     //////////////////////////////////////////////////////////////////////////
     template <>
     struct equal_impl<Map, Map> {
+        template <typename M1, typename M2, detail::std::size_t ...i>
+        static constexpr auto
+        equal_values(M1 const&, M2 const&, detail::std::false_type,
+                     detail::std::index_sequence<i...>)
+        { return hana::false_; }
+
+        template <typename M1, typename M2, detail::std::size_t ...i>
+        static constexpr auto
+        equal_values(M1 const& m1, M2 const& m2, detail::std::true_type,
+                     detail::std::index_sequence<i...>)
+        {
+            (void)m1; (void)m2; // remove GCC warnings about unused parameters
+            return hana::and_(hana::true_, hana::equal(
+                map_detail::second_ref{}(detail::get<i>(m1.storage)),
+                map_detail::second_ref{}(detail::get<
+                    map_detail::matches_t<M1, M2>::get(i)
+                >(m2.storage))
+            )...);
+        }
+
         template <typename M1, typename M2>
         static constexpr auto apply(M1 const& m1, M2 const& m2) {
-            return hana::and_(
-                hana::equal(hana::length(m1.storage), hana::length(m2.storage)),
-                hana::all_of(hana::keys(m1), hana::demux(equal)(
-                    hana::partial(find, m1),
-                    hana::partial(find, m2)
-                ))
-            );
+            constexpr bool same_keys =
+                map_detail::size<M1>::value == map_detail::size<M2>::value &&
+                map_detail::all_matched<M1, M2>();
+            return equal_impl::equal_values(m1, m2,
+                detail::std::integral_constant<bool, same_keys>{},
+                detail::std::make_index_sequence<
+                    same_keys ? map_detail::size<M1>::value : 0
+                >{});
         }
     };
 
@@ -178,7 +528,76 @@ namespace boost { namespace hana {
     struct any_of_impl<Map> {
         template <typename M, typename Pred>
         static constexpr auto apply(M map, Pred pred)
-        { return hana::any_of(hana::keys(map), pred); }
+        { return hana::any_of(hana::keys_view(map), pred); }
+    };
+
+    template <>
+    struct contains_impl<Map> {
+        template <typename M, typename Key>
+        static constexpr auto apply(M&&, Key&&, detail::std::true_type) {
+            using Index = map_detail::index_t<M>;
+            return hana::bool_<
+                Index::template find<Key>() != map_detail::size<M>::value
+            >;
+        }
+
+        template <typename M, typename Key>
+        static constexpr decltype(auto) apply(M&& map, Key&& key, detail::std::false_type) {
+            return contains_impl<Map, when<true>>::apply(
+                static_cast<M&&>(map), static_cast<Key&&>(key)
+            );
+        }
+
+        template <typename M, typename Key>
+        static constexpr decltype(auto) apply(M&& map, Key&& key) {
+            using Index = map_detail::index_t<M>;
+            return contains_impl::apply(static_cast<M&&>(map),
+                                        static_cast<Key&&>(key),
+                detail::std::integral_constant<bool,
+                    Index::available && Index::template can_find<Key>()
+                >{});
+        }
+    };
+
+    template <>
+    struct find_impl<Map> {
+        template <detail::std::size_t i, typename M>
+        static constexpr auto found(M&&, detail::std::false_type)
+        { return hana::nothing; }
+
+        template <detail::std::size_t i, typename M>
+        static constexpr auto found(M&& map, detail::std::true_type) {
+            return hana::just(map_detail::second_ref{}(
+                detail::get<i>(static_cast<M&&>(map).storage)
+            ));
+        }
+
+        template <typename M, typename Key>
+        static constexpr auto apply(M&& map, Key&&, detail::std::true_type) {
+            constexpr detail::std::size_t i =
+                map_detail::index_t<M>::template find<Key>();
+            return find_impl::found<i>(static_cast<M&&>(map),
+                detail::std::integral_constant<bool,
+                    i != map_detail::size<M>::value
+                >{});
+        }
+
+        template <typename M, typename Key>
+        static constexpr decltype(auto) apply(M&& map, Key&& key, detail::std::false_type) {
+            return find_impl<Map, when<true>>::apply(
+                static_cast<M&&>(map), static_cast<Key&&>(key)
+            );
+        }
+
+        template <typename M, typename Key>
+        static constexpr decltype(auto) apply(M&& map, Key&& key) {
+            using Index = map_detail::index_t<M>;
+            return find_impl::apply(static_cast<M&&>(map),
+                                    static_cast<Key&&>(key),
+                detail::std::integral_constant<bool,
+                    Index::available && Index::template can_find<Key>()
+                >{});
+        }
     };
 
     //////////////////////////////////////////////////////////////////////////
@@ -197,7 +616,8 @@ namespace boost { namespace hana {
     // Construction from a Foldable
     //////////////////////////////////////////////////////////////////////////
     template <typename F>
-    struct to_impl<Map, F, when<_models<Foldable, F>{}()>> {
+    struct to_impl<Map, F, when<_models<Foldable, F>{}() &&
+                                !_models<Struct, F>{}()>> {
         template <typename Xs>
         static constexpr decltype(auto) apply(Xs&& xs) {
             return hana::fold.left(
@@ -0,0 +1,818 @@
+/*!
+@file
+Defines `boost::hana::par`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_PAR_HPP
+#define BOOST_HANA_PAR_HPP
+
+#include <boost/hana/fwd/par.hpp>
+
+#include <boost/hana/comparable.hpp>
+#include <boost/hana/constant.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/detail/closure.hpp>
+#include <boost/hana/detail/find_index.hpp>
+#include <boost/hana/detail/thread_pool.hpp>
+#include <boost/hana/ext/std/array.hpp>
+#include <boost/hana/ext/std/vector.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/functor.hpp>
+#include <boost/hana/lazy.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/maybe.hpp>
+#include <boost/hana/monoid.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/product.hpp>
+#include <boost/hana/ring.hpp>
+#include <boost/hana/searchable.hpp>
+#include <boost/hana/sequence.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // parallel_error
+    //////////////////////////////////////////////////////////////////////////
+    struct parallel_error : std::exception {
+        explicit parallel_error(std::vector<std::exception_ptr> exceptions)
+            : exceptions_{std::make_shared<std::vector<std::exception_ptr>>(
+                std::move(exceptions)
+            )}
+        { }
+
+        std::vector<std::exception_ptr> const& exceptions() const noexcept
+        { return *exceptions_; }
+
+        char const* what() const noexcept override
+        { return "boost::hana::parallel_error: some tasks threw an exception"; }
+
+    private:
+        // Shared so that copying the exception can't throw.
+        std::shared_ptr<std::vector<std::exception_ptr> const> exceptions_;
+    };
+
+    namespace par_detail {
+        //////////////////////////////////////////////////////////////////////
+        // Splitting a sequence of `n` elements into chunks
+        //////////////////////////////////////////////////////////////////////
+        struct chunks {
+            chunks(_par const& policy, std::size_t n) : n{n} {
+                std::size_t threshold = policy.threshold ? policy.threshold : 1;
+                if (n <= threshold) {
+                    size = n;
+                } else {
+                    // A few chunks per thread helps balancing the load
+                    // when the elements do not all take the same time.
+                    std::size_t wanted = 4 * detail::default_thread_pool().concurrency();
+                    size = (n + wanted - 1) / wanted;
+                    if (size < threshold)
+                        size = threshold;
+                }
+                count = size == 0 ? 0 : (n + size - 1) / size;
+            }
+
+            // Calls `f(c, first, last)` for each chunk `c`, where `[first, last)`
+            // are the indices of the elements in the chunk.
+            template <typename F>
+            void run(F const& f) const {
+                if (count == 1)
+                    f(0, 0, n);
+                else if (count > 1) {
+                    detail::default_thread_pool().parallel_for(count, [this, &f](std::size_t c) {
+                        std::size_t first = c * size;
+                        f(c, first, n - first < size ? n : first + size);
+                    });
+                }
+            }
+
+            std::size_t n;
+            std::size_t size;
+            std::size_t count;
+        };
+
+        //////////////////////////////////////////////////////////////////////
+        // Uninitialized storage for results computed out of order
+        //////////////////////////////////////////////////////////////////////
+        template <typename T>
+        struct buffer {
+            explicit buffer(std::size_t n)
+                : storage_{new storage[n]}, constructed_{new bool[n]()}, n_{n}
+            { }
+
+            buffer(buffer const&) = delete;
+            buffer& operator=(buffer const&) = delete;
+
+            ~buffer() {
+                for (std::size_t i = 0; i < n_; ++i)
+                    if (constructed_[i])
+                        (*this)[i].~T();
+            }
+
+            template <typename X>
+            void construct(std::size_t i, X&& x) {
+                ::new (static_cast<void*>(&storage_[i])) T(static_cast<X&&>(x));
+                constructed_[i] = true;
+            }
+
+            T& operator[](std::size_t i)
+            { return *reinterpret_cast<T*>(&storage_[i]); }
+
+        private:
+            using storage = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+            std::unique_ptr<storage[]> storage_;
+            std::unique_ptr<bool[]> constructed_;
+            std::size_t n_;
+        };
+
+        //////////////////////////////////////////////////////////////////////
+        // Random access views over the elements of a sequence
+        //
+        // `Ref` is the type of reference through which elements are accessed;
+        // it is an rvalue reference when the sequence is a temporary, so
+        // that each element is moved at most once.
+        //////////////////////////////////////////////////////////////////////
+        template <typename Ref>
+        struct contiguous_range {
+            using reference = Ref;
+            typename std::remove_reference<Ref>::type* data;
+            std::size_t n;
+
+            std::size_t size() const { return n; }
+            Ref operator[](std::size_t i) const
+            { return static_cast<Ref>(data[i]); }
+        };
+
+        template <typename Xs>
+        auto make_contiguous_range(Xs&& xs) {
+            using T = typename std::remove_pointer<decltype(xs.data())>::type;
+            using Ref = typename std::conditional<
+                std::is_lvalue_reference<Xs>::value, T&, T&&
+            >::type;
+            return contiguous_range<Ref>{xs.data(), xs.size()};
+        }
+
+        template <typename Ref, std::size_t N>
+        struct indirect_range {
+            using reference = Ref;
+            std::array<typename std::remove_reference<Ref>::type*, N> pointers;
+
+            std::size_t size() const { return N; }
+            Ref operator[](std::size_t i) const
+            { return static_cast<Ref>(*pointers[i]); }
+        };
+
+        struct empty_range {
+            std::size_t size() const { return 0; }
+        };
+
+        template <bool ...b>
+        struct all_true : std::is_same<
+            std::integer_sequence<bool, true, b...>,
+            std::integer_sequence<bool, b..., true>
+        > { };
+
+        template <bool rvalue, typename T, typename ...Xs, typename Closure>
+        auto make_indirect_range(Closure& xs) {
+            static_assert(all_true<std::is_same<
+                typename Xs::get_type, typename T::get_type
+            >::value...>{},
+            "hana::par requires all the elements of a Tuple to have the same type");
+
+            using U = typename std::conditional<std::is_const<Closure>::value,
+                typename T::get_type const, typename T::get_type
+            >::type;
+            using Ref = typename std::conditional<rvalue, U&&, U&>::type;
+            return indirect_range<Ref, sizeof...(Xs) + 1>{{{
+                &static_cast<T&>(xs).get, &static_cast<Xs&>(xs).get...
+            }}};
+        }
+
+        template <bool rvalue, typename T, typename ...Xs>
+        auto closure_range(detail::closure_impl<T, Xs...>& xs)
+        { return make_indirect_range<rvalue, T, Xs...>(xs); }
+
+        template <bool rvalue, typename T, typename ...Xs>
+        auto closure_range(detail::closure_impl<T, Xs...> const& xs)
+        { return make_indirect_range<rvalue, T const, Xs const...>(xs); }
+
+        template <bool rvalue>
+        empty_range closure_range(detail::closure_impl<> const&)
+        { return {}; }
+
+        template <typename Xs>
+        auto make_tuple_range(Xs&& xs) {
+            constexpr bool rvalue = !std::is_lvalue_reference<Xs>::value;
+            return closure_range<rvalue>(xs);
+        }
+
+        //////////////////////////////////////////////////////////////////////
+        // Algorithms
+        //////////////////////////////////////////////////////////////////////
+        template <typename Range, typename F>
+        using result_of_t = typename std::decay<decltype(
+            std::declval<F&>()(std::declval<typename Range::reference>())
+        )>::type;
+
+        template <typename Range, typename F>
+        void for_each(_par const& policy, Range const& r, F& f) {
+            chunks{policy, r.size()}.run([&](std::size_t, std::size_t first, std::size_t last) {
+                for (; first != last; ++first)
+                    f(r[first]);
+            });
+        }
+
+        template <typename F>
+        void for_each(_par const&, empty_range const&, F&) { }
+
+        template <typename Range, typename F, typename Out>
+        void transform_assign(_par const& policy, Range const& r, F& f, Out& out) {
+            chunks{policy, r.size()}.run([&](std::size_t, std::size_t first, std::size_t last) {
+                for (; first != last; ++first)
+                    out[first] = f(r[first]);
+            });
+        }
+
+        template <typename Range, typename F, typename T>
+        void transform_construct(_par const& policy, Range const& r, F& f, buffer<T>& out) {
+            chunks{policy, r.size()}.run([&](std::size_t, std::size_t first, std::size_t last) {
+                for (; first != last; ++first)
+                    out.construct(first, f(r[first]));
+            });
+        }
+
+        // Reduces each chunk starting from `init()`, and then combines the
+        // partial results from left to right. Only the associativity of
+        // `op` is required, which is what Monoids and Rings guarantee.
+        template <typename Range, typename Init, typename Op>
+        auto reduce(_par const& policy, Range const& r, Init init, Op op) {
+            using Acc = typename std::decay<decltype(
+                op(init(), std::declval<typename Range::reference>())
+            )>::type;
+            chunks split{policy, r.size()};
+            buffer<Acc> partials{split.count};
+            split.run([&](std::size_t c, std::size_t first, std::size_t last) {
+                Acc acc = op(init(), r[first]);
+                while (++first != last)
+                    acc = op(static_cast<Acc&&>(acc), r[first]);
+                partials.construct(c, static_cast<Acc&&>(acc));
+            });
+
+            if (split.count == 0)
+                return static_cast<Acc>(init());
+            Acc result = static_cast<Acc&&>(partials[0]);
+            for (std::size_t c = 1; c < split.count; ++c)
+                result = op(static_cast<Acc&&>(result), static_cast<Acc&&>(partials[c]));
+            return result;
+        }
+
+        template <typename Init, typename Op>
+        auto reduce(_par const&, empty_range const&, Init init, Op)
+        { return init(); }
+
+        template <typename M>
+        struct zero_ {
+            constexpr decltype(auto) operator()() const
+            { return hana::zero<M>(); }
+        };
+
+        template <typename R>
+        struct one_ {
+            constexpr decltype(auto) operator()() const
+            { return hana::one<R>(); }
+        };
+
+        template <typename Range, typename Pred>
+        std::size_t count_if(_par const& policy, Range const& r, Pred& pred) {
+            std::atomic<std::size_t> count{0};
+            chunks{policy, r.size()}.run([&](std::size_t, std::size_t first, std::size_t last) {
+                std::size_t local = 0;
+                for (; first != last; ++first)
+                    if (pred(r[first]))
+                        ++local;
+                count += local;
+            });
+            return count;
+        }
+
+        template <typename Pred>
+        std::size_t count_if(_par const&, empty_range const&, Pred&)
+        { return 0; }
+
+        template <typename Range, typename Pred>
+        bool any_of(_par const& policy, Range const& r, Pred& pred) {
+            std::atomic<bool> found{false};
+            chunks{policy, r.size()}.run([&](std::size_t, std::size_t first, std::size_t last) {
+                for (; first != last && !found.load(std::memory_order_relaxed); ++first)
+                    if (pred(r[first]))
+                        found.store(true, std::memory_order_relaxed);
+            });
+            return found;
+        }
+
+        template <typename Pred>
+        bool any_of(_par const&, empty_range const&, Pred&)
+        { return false; }
+
+        // Provides all the algorithms except `transform` in terms of
+        // `Self::range(xs)`.
+        template <typename Self>
+        struct algorithms {
+            template <typename Xs, typename F>
+            static void for_each(_par const& policy, Xs&& xs, F&& f)
+            { par_detail::for_each(policy, Self::range(static_cast<Xs&&>(xs)), f); }
+
+            template <typename M, typename Xs>
+            static auto sum(_par const& policy, Xs&& xs) {
+                return par_detail::reduce(policy, Self::range(static_cast<Xs&&>(xs)),
+                                          zero_<M>{}, hana::plus);
+            }
+
+            template <typename R, typename Xs>
+            static auto product(_par const& policy, Xs&& xs) {
+                return par_detail::reduce(policy, Self::range(static_cast<Xs&&>(xs)),
+                                          one_<R>{}, hana::mult);
+            }
+
+            template <typename Xs, typename Pred>
+            static std::size_t count_if(_par const& policy, Xs&& xs, Pred&& pred)
+            { return par_detail::count_if(policy, Self::range(static_cast<Xs&&>(xs)), pred); }
+
+            template <typename Xs, typename Pred>
+            static bool any_of(_par const& policy, Xs&& xs, Pred&& pred)
+            { return par_detail::any_of(policy, Self::range(static_cast<Xs&&>(xs)), pred); }
+        };
+
+        template <typename T, std::size_t ...i>
+        auto move_into_array(buffer<T>& xs, std::index_sequence<i...>)
+        { return std::array<T, sizeof...(i)>{{static_cast<T&&>(xs[i])...}}; }
+
+        template <typename T, std::size_t ...i>
+        auto move_into_tuple(buffer<T>& xs, std::index_sequence<i...>)
+        { return hana::make<Tuple>(static_cast<T&&>(xs[i])...); }
+
+        //////////////////////////////////////////////////////////////////////
+        // One task per element, for heterogeneous structures
+        //
+        // A context holds references to the elements and knows how to run
+        // the task for the i-th element through `run<i>()`. The tasks are
+        // dispatched to the pool through a table of function pointers, and
+        // the exception thrown by each task is kept until everything has
+        // completed. If any task threw, all the exceptions are then reported
+        // together by a `parallel_error`, even when there is a single one.
+        //////////////////////////////////////////////////////////////////////
+        template <std::size_t N>
+        void rethrow_errors(std::array<std::exception_ptr, N> const& errors) {
+            for (std::exception_ptr const& error : errors) {
+                if (error)
+                    throw parallel_error{std::vector<std::exception_ptr>(
+                        errors.begin(), errors.end())};
+            }
+        }
+
+        template <typename Context, std::size_t i>
+        void run_task(Context& ctx) {
+            try { ctx.template run<i>(); }
+            catch (...) { ctx.errors[i] = std::current_exception(); }
+        }
+
+        template <typename Context, std::size_t ...i>
+        void run_tasks(Context& ctx, std::index_sequence<i...>) {
+            static constexpr void (*tasks[])(Context&) = {&run_task<Context, i>...};
+            detail::default_thread_pool().parallel_for(sizeof...(i), [&](std::size_t n) {
+                tasks[n](ctx);
+            });
+            par_detail::rethrow_errors(ctx.errors);
+        }
+
+        template <typename Context>
+        void run_tasks(Context&, std::index_sequence<>) { }
+
+        template <typename F, typename ...X>
+        struct for_each_context {
+            for_each_context(F& f, X&& ...x)
+                : f(f), xs{static_cast<X&&>(x)...}
+            { }
+
+            template <std::size_t i>
+            void run()
+            { f(sequence_detail::forward_at<i>(xs)); }
+
+            F& f;
+            sequence_detail::elements<X...> xs;
+            std::array<std::exception_ptr, sizeof...(X)> errors;
+        };
+
+        // Storage for a result that is not computed yet.
+        template <typename T>
+        struct slot {
+            slot() = default;
+            slot(slot const&) = delete;
+            slot& operator=(slot const&) = delete;
+
+            ~slot() {
+                if (constructed)
+                    get().~T();
+            }
+
+            template <typename X>
+            void construct(X&& x) {
+                ::new (static_cast<void*>(&storage)) T(static_cast<X&&>(x));
+                constructed = true;
+            }
+
+            T& get()
+            { return *reinterpret_cast<T*>(&storage); }
+
+            typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+            bool constructed = false;
+        };
+
+        template <std::size_t n, typename T>
+        slot<T>& slot_at(detail::element<n, slot<T>>& x)
+        { return x.get; }
+
+        template <typename F, typename ...X>
+        struct transform_context : for_each_context<F, X...> {
+            using for_each_context<F, X...>::for_each_context;
+
+            template <std::size_t i>
+            void run() {
+                slot_at<i>(results).construct(
+                    this->f(sequence_detail::forward_at<i>(this->xs))
+                );
+            }
+
+            template <std::size_t ...i>
+            auto move_results(std::index_sequence<i...>) {
+                return hana::make<Tuple>(
+                    static_cast<decltype(slot_at<i>(results).get())&&>(
+                        slot_at<i>(results).get()
+                    )...
+                );
+            }
+
+            detail::closure<slot<typename std::decay<decltype(
+                std::declval<F&>()(std::declval<X>())
+            )>::type>...> results;
+        };
+
+        template <typename F>
+        struct for_each_parallel {
+            F& f;
+
+            template <typename ...X>
+            void operator()(X&& ...x) const {
+                for_each_context<F, X...> ctx{f, static_cast<X&&>(x)...};
+                par_detail::run_tasks(ctx, std::index_sequence_for<X...>{});
+            }
+        };
+
+        template <typename F>
+        struct transform_parallel {
+            F& f;
+
+            template <typename ...X>
+            auto operator()(X&& ...x) const {
+                transform_context<F, X...> ctx{f, static_cast<X&&>(x)...};
+                par_detail::run_tasks(ctx, std::index_sequence_for<X...>{});
+                return ctx.move_results(std::index_sequence_for<X...>{});
+            }
+        };
+
+        //////////////////////////////////////////////////////////////////////
+        // Static graphs of lazy computations
+        //////////////////////////////////////////////////////////////////////
+        template <typename ...K>
+        struct key_list { };
+
+        struct to_key_list {
+            template <typename ...D>
+            constexpr key_list<typename std::decay<D>::type...>
+            operator()(D&& ...) const { return {}; }
+        };
+
+        template <std::size_t N>
+        struct dag {
+            bool needs[N][N]; // whether the i-th stage needs the j-th
+            std::size_t order[N];
+            bool complete;
+            bool acyclic;
+        };
+
+        template <std::size_t N, typename ...K, typename ...D>
+        constexpr void add_prerequisites(dag<N>& g, std::size_t i,
+                                         key_list<K...>, key_list<D...>)
+        {
+            std::size_t const prerequisites[] = {detail::find_equal<D, K...>()..., N};
+            for (std::size_t n = 0; n < sizeof...(D); ++n) {
+                if (prerequisites[n] == N)
+                    g.complete = false;
+                else
+                    g.needs[i][prerequisites[n]] = true;
+            }
+        }
+
+        // Orders the stages level by level: the stages with no prerequisites
+        // first, then those whose prerequisites are all in the first level,
+        // and so on. Starting the stages in that order means that a stage
+        // never waits for a stage that was not started yet.
+        template <std::size_t N>
+        constexpr void sort_topologically(dag<N>& g) {
+            bool placed[N] = {};
+            std::size_t count = 0;
+            while (count < N) {
+                std::size_t level = count;
+                bool ready[N] = {};
+                for (std::size_t i = 0; i < N; ++i) {
+                    ready[i] = !placed[i];
+                    for (std::size_t j = 0; j < N; ++j)
+                        if (g.needs[i][j] && !placed[j])
+                            ready[i] = false;
+                }
+                for (std::size_t i = 0; i < N; ++i)
+                    if (ready[i]) {
+                        placed[i] = true;
+                        g.order[count++] = i;
+                    }
+                if (count == level) {
+                    g.acyclic = false;
+                    return;
+                }
+            }
+        }
+
+        template <typename Keys, typename ...Prerequisites>
+        constexpr auto make_dag(Keys keys, Prerequisites ...prerequisites) {
+            constexpr std::size_t N = sizeof...(Prerequisites);
+            dag<N> g{};
+            g.complete = true;
+            g.acyclic = true;
+            std::size_t i = 0;
+            bool expand[] = {(add_prerequisites(g, i++, keys, prerequisites), true)...};
+            (void)expand;
+            sort_topologically(g);
+            return g;
+        }
+
+        template <typename Stage>
+        using stage_result_t = typename std::decay<decltype(
+            hana::eval(hana::second(std::declval<Stage>()))
+        )>::type;
+
+        template <typename Dependencies, typename ...Stage>
+        struct graph_context {
+            static constexpr std::size_t N = sizeof...(Stage);
+
+            explicit graph_context(Stage&& ...stage)
+                : stages{static_cast<Stage&&>(stage)...}
+            { }
+
+            template <std::size_t i>
+            void run() {
+                slot_at<i>(results).construct(hana::eval(hana::second(
+                    sequence_detail::forward_at<i>(stages)
+                )));
+            }
+
+            template <std::size_t ...i>
+            auto move_results(std::index_sequence<i...>) {
+                return hana::make<Map>(hana::make<Pair>(
+                    hana::first(sequence_detail::forward_at<i>(stages)),
+                    static_cast<stage_result_t<Stage>&&>(slot_at<i>(results).get())
+                )...);
+            }
+
+            using keys = key_list<typename std::decay<decltype(
+                hana::first(std::declval<Stage>())
+            )>::type...>;
+
+            static constexpr dag<N> graph = par_detail::make_dag(keys{},
+                decltype(hana::unpack(
+                    hana::from_maybe(hana::make<Tuple>(), hana::find(
+                        std::declval<Dependencies const&>(),
+                        hana::first(std::declval<Stage>())
+                    )),
+                    to_key_list{}
+                )){}...
+            );
+
+            static_assert(graph.complete,
+            "hana::eval_parallel(stages, dependencies) requires every "
+            "prerequisite to be a key of the stages");
+
+            static_assert(graph.acyclic,
+            "hana::eval_parallel(stages, dependencies) requires the "
+            "dependencies to be free of cycles");
+
+            sequence_detail::elements<Stage...> stages;
+            detail::closure<slot<stage_result_t<Stage>>...> results;
+            std::array<std::exception_ptr, N> errors;
+
+            // 0: not done yet, 1: completed, 2: failed or skipped
+            std::array<int, N> state{};
+            std::mutex mutex;
+            std::condition_variable completed;
+        };
+
+        template <typename Dependencies, typename ...Stage>
+        constexpr dag<graph_context<Dependencies, Stage...>::N>
+        graph_context<Dependencies, Stage...>::graph;
+
+        template <typename Context, std::size_t ...i>
+        void run_graph(Context& ctx, std::index_sequence<i...>) {
+            static constexpr void (*tasks[])(Context&) = {&run_task<Context, i>...};
+            constexpr std::size_t N = sizeof...(i);
+            detail::default_thread_pool().parallel_for(N, [&](std::size_t n) {
+                std::size_t const stage = Context::graph.order[n];
+                bool runnable = true;
+                {
+                    std::unique_lock<std::mutex> lock{ctx.mutex};
+                    ctx.completed.wait(lock, [&] {
+                        for (std::size_t j = 0; j < N; ++j)
+                            if (Context::graph.needs[stage][j] && ctx.state[j] == 0)
+                                return false;
+                        return true;
+                    });
+                    for (std::size_t j = 0; j < N; ++j)
+                        if (Context::graph.needs[stage][j] && ctx.state[j] == 2)
+                            runnable = false;
+                }
+
+                if (runnable)
+                    tasks[stage](ctx);
+
+                {
+                    std::lock_guard<std::mutex> lock{ctx.mutex};
+                    ctx.state[stage] = runnable && !ctx.errors[stage] ? 1 : 2;
+                }
+                ctx.completed.notify_all();
+            });
+            par_detail::rethrow_errors(ctx.errors);
+        }
+
+        template <typename Dependencies>
+        struct eval_graph {
+            template <typename ...Stage>
+            auto operator()(Stage&& ...stage) const {
+                graph_context<Dependencies, Stage...> ctx{static_cast<Stage&&>(stage)...};
+                par_detail::run_graph(ctx, std::index_sequence_for<Stage...>{});
+                return ctx.move_results(std::index_sequence_for<Stage...>{});
+            }
+
+            auto operator()() const
+            { return hana::make<Map>(); }
+        };
+    } // end namespace par_detail
+
+    //////////////////////////////////////////////////////////////////////////
+    // std::vector
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct par_impl<ext::std::Vector>
+        : par_detail::algorithms<par_impl<ext::std::Vector>>
+    {
+        template <typename Xs>
+        static auto range(Xs&& xs)
+        { return par_detail::make_contiguous_range(static_cast<Xs&&>(xs)); }
+
+        // Results that can be default-constructed are assigned directly into
+        // the new vector; other results are first stored in uninitialized
+        // memory and then moved into the vector.
+        template <typename R, typename Alloc, typename Range, typename F>
+        static auto transform_(_par const& policy, Alloc const& alloc,
+                               Range const& r, F& f, std::true_type)
+        {
+            std::vector<R, Alloc> result(r.size(), alloc);
+            par_detail::transform_assign(policy, r, f, result);
+            return result;
+        }
+
+        template <typename R, typename Alloc, typename Range, typename F>
+        static auto transform_(_par const& policy, Alloc const& alloc,
+                               Range const& r, F& f, std::false_type)
+        {
+            par_detail::buffer<R> buffer{r.size()};
+            par_detail::transform_construct(policy, r, f, buffer);
+            std::vector<R, Alloc> result(alloc);
+            result.reserve(r.size());
+            for (std::size_t i = 0; i < r.size(); ++i)
+                result.push_back(static_cast<R&&>(buffer[i]));
+            return result;
+        }
+
+        template <typename Xs, typename F>
+        static auto transform(_par const& policy, Xs&& xs, F&& f) {
+            auto r = range(static_cast<Xs&&>(xs));
+            using R = par_detail::result_of_t<decltype(r), F>;
+            using Alloc = typename std::allocator_traits<
+                typename std::decay<Xs>::type::allocator_type
+            >::template rebind_alloc<R>;
+            return transform_<R>(policy, Alloc(xs.get_allocator()), r, f,
+                std::integral_constant<bool,
+                    std::is_default_constructible<R>::value &&
+                    std::is_move_assignable<R>::value
+                >{});
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // std::array
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct par_impl<ext::std::Array>
+        : par_detail::algorithms<par_impl<ext::std::Array>>
+    {
+        template <typename Xs>
+        static auto range(Xs&& xs)
+        { return par_detail::make_contiguous_range(static_cast<Xs&&>(xs)); }
+
+        template <typename Xs, typename F>
+        static auto transform(_par const& policy, Xs&& xs, F&& f) {
+            constexpr std::size_t N = std::tuple_size<typename std::decay<Xs>::type>::value;
+            auto r = range(static_cast<Xs&&>(xs));
+            using R = par_detail::result_of_t<decltype(r), F>;
+            par_detail::buffer<R> buffer{N};
+            par_detail::transform_construct(policy, r, f, buffer);
+            return par_detail::move_into_array(buffer, std::make_index_sequence<N>{});
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Tuple
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct par_impl<Tuple>
+        : par_detail::algorithms<par_impl<Tuple>>
+    {
+        template <typename Xs>
+        static auto range(Xs&& xs)
+        { return par_detail::make_tuple_range(static_cast<Xs&&>(xs)); }
+
+        template <typename Range, typename F>
+        static auto transform_(_par const& policy, Range const& r, F& f) {
+            using R = par_detail::result_of_t<Range, F>;
+            par_detail::buffer<R> buffer{r.size()};
+            par_detail::transform_construct(policy, r, f, buffer);
+            return par_detail::move_into_tuple(buffer,
+                std::make_index_sequence<std::tuple_size<decltype(r.pointers)>::value>{});
+        }
+
+        template <typename F>
+        static auto transform_(_par const&, par_detail::empty_range const&, F&)
+        { return hana::make<Tuple>(); }
+
+        template <typename Xs, typename F>
+        static auto transform(_par const& policy, Xs&& xs, F&& f)
+        { return transform_(policy, range(static_cast<Xs&&>(xs)), f); }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // for_each_parallel and transform_parallel
+    //////////////////////////////////////////////////////////////////////////
+    //! @cond
+    template <typename Xs, typename F>
+    void _for_each_parallel::operator()(Xs&& xs, F&& f) const {
+        hana::unpack(static_cast<Xs&&>(xs), par_detail::for_each_parallel<F>{f});
+    }
+
+    template <typename Xs, typename F>
+    auto _transform_parallel::operator()(Xs&& xs, F&& f) const {
+        return hana::unpack(static_cast<Xs&&>(xs),
+                            par_detail::transform_parallel<F>{f});
+    }
+    //! @endcond
+
+    //////////////////////////////////////////////////////////////////////////
+    // eval_parallel
+    //////////////////////////////////////////////////////////////////////////
+    //! @cond
+    template <typename Xs>
+    auto _eval_parallel::operator()(Xs&& xs) const
+    { return hana::transform_parallel(static_cast<Xs&&>(xs), hana::eval); }
+
+    template <typename Stages, typename Dependencies>
+    auto _eval_parallel::operator()(Stages&& stages, Dependencies const&) const {
+        return hana::unpack(static_cast<Stages&&>(stages),
+                            par_detail::eval_graph<Dependencies>{});
+    }
+    //! @endcond
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_PAR_HPP
@@ -18,7 +18,9 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/default.hpp>
 #include <boost/hana/core/models.hpp>
 #include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
 #include <boost/hana/foldable.hpp>
+#include <boost/hana/hashable.hpp>
 #include <boost/hana/logical.hpp>
 #include <boost/hana/orderable.hpp>
 
@@ -73,6 +75,17 @@ namespace boost { namespace hana {
         }
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // Hashable
+    //////////////////////////////////////////////////////////////////////////
+    template <typename P>
+    struct hash_impl<P, when<_models<Product, P>{}()>> {
+        template <typename X>
+        static constexpr detail::std::size_t apply(X const& x) {
+            return hash_detail::hash_elements{}(hana::first(x), hana::second(x));
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Orderable
     //////////////////////////////////////////////////////////////////////////
@@ -20,6 +20,12 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/models.hpp>
 #include <boost/hana/core/when.hpp>
 #include <boost/hana/detail/by.hpp> // needed by xxx.by
+#include <boost/hana/detail/closure.hpp>
+#include <boost/hana/detail/find_index.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/declval.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
 #include <boost/hana/detail/variadic/foldr1.hpp>
 #include <boost/hana/foldable.hpp>
 #include <boost/hana/functional/compose.hpp>
@@ -27,6 +33,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/functional/flip.hpp>
 #include <boost/hana/functional/partial.hpp>
 #include <boost/hana/functor.hpp>
+#include <boost/hana/hashable.hpp>
 #include <boost/hana/iterable.hpp>
 #include <boost/hana/lazy.hpp>
 #include <boost/hana/logical.hpp>
@@ -123,6 +130,27 @@ namespace boost { namespace hana {
         };
 
         constexpr _for2 for2_{};
+
+        // The following are used to implement some algorithms by computing
+        // the indices of the elements they keep, instead of recursing on
+        // `head` and `tail`. They are called with the elements of a sequence
+        // by `unpack`, which lets them refer to any element in constant time
+        // through a closure of references. The result is then built with a
+        // single call to `make`, so the template recursion depth does not
+        // depend on the length of the sequence.
+        template <typename ...X>
+        using elements = detail::closure<X&&...>;
+
+        template <detail::std::size_t n, typename Xn>
+        constexpr Xn&& forward_at(detail::element<n, Xn> const& x)
+        { return static_cast<Xn&&>(x.get); }
+
+        template <typename S, detail::std::size_t from,
+                  typename Elements, detail::std::size_t ...i>
+        constexpr auto
+        make_slice(Elements const& xs, detail::std::index_sequence<i...>)
+        { return hana::make<S>(sequence_detail::forward_at<from + i>(xs)...); }
+
     } // end namespace sequence_detail
 
     //////////////////////////////////////////////////////////////////////////
@@ -137,7 +165,7 @@ namespace boost { namespace hana {
         static constexpr decltype(auto) apply(Xs&& xs) {
             return hana::eval_if(hana::is_empty(xs),
                 hana::lazy(hana::make<S>()),
-                hana::lazy(hana::unpack)(
+                hana::lazy_ref(hana::unpack)(
                     static_cast<Xs&&>(xs),
                     hana::partial(hana::ap, hana::lift<S>(hana::make<S>))
                 )
@@ -243,10 +271,11 @@ namespace boost { namespace hana {
         };
 
         template <typename Xs, typename Z>
-        static constexpr decltype(auto) apply(Xs&& xs, Z&& z) {
+        static constexpr auto apply(Xs&& xs, Z&& z) {
             return hana::eval_if(hana::is_empty(xs),
-                hana::lazy(xs),
-                hana::lazy(intersperse_helper{})(xs, z)
+                hana::lazy_ref(static_cast<Xs&&>(xs)),
+                hana::lazy_ref(intersperse_helper{})(static_cast<Xs&&>(xs),
+                                                     static_cast<Z&&>(z))
             );
         }
     };
@@ -258,26 +287,24 @@ namespace boost { namespace hana {
     struct partition_impl : partition_impl<S, when<true>> { };
 
     namespace sequence_detail {
-        template <typename Parts, typename X>
         struct append_first {
-            template <typename Parts_, typename X_>
-            constexpr decltype(auto) operator()(Parts_* parts, X_* x) const {
+            template <typename Parts, typename X>
+            constexpr decltype(auto) operator()(Parts&& parts, X&& x) const {
                 return hana::make<Pair>(
-                    hana::append(hana::first(static_cast<Parts&&>(*parts)),
-                                 static_cast<X&&>(*x)),
-                    hana::second(static_cast<Parts&&>(*parts))
+                    hana::append(hana::first(static_cast<Parts&&>(parts)),
+                                 static_cast<X&&>(x)),
+                    hana::second(static_cast<Parts&&>(parts))
                 );
             }
         };
 
-        template <typename Parts, typename X>
         struct append_second {
-            template <typename Parts_, typename X_>
-            constexpr decltype(auto) operator()(Parts_* parts, X_* x) const {
+            template <typename Parts, typename X>
+            constexpr decltype(auto) operator()(Parts&& parts, X&& x) const {
                 return hana::make<Pair>(
-                    hana::first(static_cast<Parts&&>(*parts)),
-                    hana::append(hana::second(static_cast<Parts&&>(*parts)),
-                                 static_cast<X&&>(*x))
+                    hana::first(static_cast<Parts&&>(parts)),
+                    hana::append(hana::second(static_cast<Parts&&>(parts)),
+                                 static_cast<X&&>(x))
                 );
             }
         };
@@ -287,8 +314,10 @@ namespace boost { namespace hana {
             constexpr decltype(auto)
             operator()(Pred&& pred, Parts&& parts, X&& x) const {
                 return hana::eval_if(static_cast<Pred&&>(pred)(x),
-                    hana::lazy(append_first<Parts&&, X&&>{})(&parts, &x),
-                    hana::lazy(append_second<Parts&&, X&&>{})(&parts, &x)
+                    hana::lazy_ref(append_first{})(static_cast<Parts&&>(parts),
+                                                   static_cast<X&&>(x)),
+                    hana::lazy_ref(append_second{})(static_cast<Parts&&>(parts),
+                                                    static_cast<X&&>(x))
                 );
             }
         };
@@ -332,8 +361,8 @@ namespace boost { namespace hana {
             template <typename X, typename Xs>
             constexpr decltype(auto) operator()(X&& x, Xs&& l) const {
                 return hana::eval_if(hana::is_empty(l),
-                    hana::lazy(hana::compose(lift<S>, lift<S>))(x),
-                    hana::lazy(insertions2{})(x, l)
+                    hana::lazy_ref(hana::compose(lift<S>, lift<S>))(x),
+                    hana::lazy_ref(insertions2{})(x, l)
                 );
             }
         };
@@ -351,8 +380,8 @@ namespace boost { namespace hana {
         template <typename Xs>
         static constexpr auto apply(Xs&& xs) {
             return hana::eval_if(hana::is_empty(xs),
-                hana::lazy(lift<S>)(empty<S>()),
-                hana::lazy(permutations_helper{})(xs)
+                hana::lazy_ref(lift<S>)(empty<S>()),
+                hana::lazy_ref(permutations_helper{})(xs)
             );
         }
     };
@@ -379,8 +408,8 @@ namespace boost { namespace hana {
         static constexpr decltype(auto) apply(Xs&& xs, N&& n) {
             using I = typename datatype<N>::type;
             return hana::eval_if(hana::equal(n, zero<I>()),
-                hana::lazy(hana::tail)(xs),
-                hana::lazy(remove_at_helper{})(xs, n)
+                hana::lazy_ref(hana::tail)(xs),
+                hana::lazy_ref(remove_at_helper{})(xs, n)
             );
         }
     };
@@ -432,7 +461,7 @@ namespace boost { namespace hana {
         static constexpr auto apply(Xs xs, State state, F f) {
             return hana::eval_if(hana::is_empty(xs),
                 hana::lazy(hana::lift<S>(state)),
-                hana::lazy(scan_left_helper{})(xs, state, f)
+                hana::lazy_ref(scan_left_helper{})(xs, state, f)
             );
         }
     };
@@ -463,7 +492,7 @@ namespace boost { namespace hana {
             decltype(auto) done = hana::is_empty(xs);
             return hana::eval_if(static_cast<decltype(done)&&>(done),
                 hana::lazy(empty<S>()),
-                hana::lazy(sequence_detail::scan_left_nostate_helper{})(
+                hana::lazy_ref(sequence_detail::scan_left_nostate_helper{})(
                     static_cast<Xs&&>(xs), static_cast<F&&>(f)
                 )
             );
@@ -491,8 +520,8 @@ namespace boost { namespace hana {
             auto done = hana::is_empty(xs);
             return hana::eval_if(done,
                 hana::lazy(hana::lift<S>(state)),
-                hana::lazy(scan_right_helper{})(static_cast<Xs&&>(xs), state,
-                                                static_cast<F&&>(f))
+                hana::lazy_ref(scan_right_helper{})(static_cast<Xs&&>(xs), state,
+                                                    static_cast<F&&>(f))
             );
         }
     };
@@ -520,7 +549,7 @@ namespace boost { namespace hana {
                 auto ys = hana::tail(xs);
                 return hana::eval_if(hana::is_empty(ys),
                     hana::lazy(hana::lift<S>(y)),
-                    hana::lazy(scanr1_helper2{})(y, ys, static_cast<F&&>(f))
+                    hana::lazy_ref(scanr1_helper2{})(y, ys, static_cast<F&&>(f))
                 );
             }
         };
@@ -530,8 +559,8 @@ namespace boost { namespace hana {
             auto done = hana::is_empty(xs);
             return hana::eval_if(done,
                 hana::lazy(empty<S>()),
-                hana::lazy(scanr1_helper1{})(static_cast<Xs&&>(xs),
-                                             static_cast<F&&>(f))
+                hana::lazy_ref(scanr1_helper1{})(static_cast<Xs&&>(xs),
+                                                 static_cast<F&&>(f))
             );
         }
     };
@@ -591,8 +620,8 @@ namespace boost { namespace hana {
             template <typename Xs, typename Pred>
             constexpr decltype(auto) operator()(Xs&& xs, Pred&& pred) const {
                 return hana::eval_if(hana::is_empty(hana::tail(xs)),
-                    hana::lazy(xs),
-                    hana::lazy(sort_by_helper2{})(xs, static_cast<Pred&&>(pred))
+                    hana::lazy_ref(xs),
+                    hana::lazy_ref(sort_by_helper2{})(xs, static_cast<Pred&&>(pred))
                 );
             }
         };
@@ -600,8 +629,8 @@ namespace boost { namespace hana {
         template <typename Xs, typename Pred>
         static constexpr auto apply(Xs xs, Pred&& pred) {
             return hana::eval_if(hana::is_empty(xs),
-                hana::lazy(xs),
-                hana::lazy(sort_by_helper1{})(xs, static_cast<Pred&&>(pred))
+                hana::lazy_ref(static_cast<Xs&&>(xs)),
+                hana::lazy_ref(sort_by_helper1{})(xs, static_cast<Pred&&>(pred))
             );
         }
     };
@@ -627,32 +656,28 @@ namespace boost { namespace hana {
 
     template <typename S, bool condition>
     struct span_impl<S, when<condition>> : default_ {
-        struct span_helper2 {
-            template <typename Xs, typename Pred>
-            constexpr decltype(auto) operator()(Xs&& xs, Pred&& pred) const {
-                auto ys_zs = span_impl::apply(hana::tail(xs), pred);
-                auto ys = hana::first(ys_zs);
-                auto zs = hana::second(ys_zs);
-                return hana::make_pair(hana::prepend(hana::head(xs), ys), zs);
-            }
-        };
-
-        struct span_helper1 {
-            template <typename Xs, typename Pred>
-            constexpr decltype(auto) operator()(Xs&& xs, Pred&& pred) const {
-                return hana::eval_if(pred(hana::head(xs)),
-                    hana::lazy(span_helper2{})(xs, pred),
-                    hana::lazy(make_pair)(empty<S>(), xs)
+        template <typename Pred>
+        struct span_helper {
+            template <typename ...X>
+            constexpr auto operator()(X&& ...x) const {
+                constexpr detail::std::size_t k = detail::first_true<
+                    !detail::satisfies<Pred, X>()...
+                >();
+                sequence_detail::elements<X...> xs{static_cast<X&&>(x)...};
+                return hana::make_pair(
+                    sequence_detail::make_slice<S, 0>(
+                        xs, detail::std::make_index_sequence<k>{}),
+                    sequence_detail::make_slice<S, k>(
+                        xs,
+                        detail::std::make_index_sequence<sizeof...(X) - k>{})
                 );
             }
         };
 
         template <typename Xs, typename Pred>
-        static constexpr auto apply(Xs xs, Pred pred) {
-            return hana::eval_if(hana::is_empty(xs),
-                hana::lazy(make_pair)(empty<S>(), empty<S>()),
-                hana::lazy(span_helper1{})(xs, pred)
-            );
+        static constexpr auto apply(Xs&& xs, Pred&&) {
+            return hana::unpack(static_cast<Xs&&>(xs),
+                span_helper<typename detail::std::decay<Pred>::type>{});
         }
     };
 
@@ -714,7 +739,7 @@ namespace boost { namespace hana {
         static constexpr auto apply(Xs&& xs, N const& n) {
             return hana::eval_if(hana::equal(n, size_t<0>),
                 hana::lazy(empty<S>()),
-                hana::lazy(sequence_detail::take_helper<take_exactly_impl>{})(
+                hana::lazy_ref(sequence_detail::take_helper<take_exactly_impl>{})(
                     static_cast<Xs&&>(xs), n
                 )
             );
@@ -734,7 +759,7 @@ namespace boost { namespace hana {
             return hana::eval_if(
                 hana::or_(hana::equal(n, size_t<0>), hana::is_empty(xs)),
                 hana::lazy(empty<S>()),
-                hana::lazy(sequence_detail::take_helper<take_at_most_impl>{})(xs, n)
+                hana::lazy_ref(sequence_detail::take_helper<take_at_most_impl>{})(xs, n)
             );
         }
     };
@@ -773,58 +798,25 @@ namespace boost { namespace hana {
     template <typename S, typename>
     struct take_while_impl : take_while_impl<S, when<true>> { };
 
-    namespace sequence_detail {
+    template <typename S, bool condition>
+    struct take_while_impl<S, when<condition>> : default_ {
+        template <typename Pred>
         struct take_while_helper {
-            template <typename Xs, typename State>
-            constexpr decltype(auto) operator()(Xs&& xs, State&& state) const {
-                return hana::append(static_cast<State&&>(state),
-                                    hana::head(static_cast<Xs&&>(xs)));
-            }
-        };
-
-        struct take_while_predicate {
-            template <typename Pred, typename Xs>
-            static constexpr decltype(auto)
-            helper(Pred&& pred, Xs&& xs, bool cond) {
-                return cond ? false
-                            : static_cast<Pred&&>(pred)(
-                                hana::head(static_cast<Xs&&>(xs)));
-            }
-
-            template <typename Pred, typename Xs>
-            static constexpr decltype(auto)
-            helper(Pred&& pred, Xs&& xs, detail::std::false_type) {
-                return static_cast<Pred&&>(pred)(
-                        hana::head(static_cast<Xs&&>(xs)));
-            }
-
-            template <typename Pred, typename Xs>
-            static constexpr decltype(auto)
-            helper(Pred&& /*pred*/, Xs&& /*xs*/, detail::std::true_type)
-            { return false_; }
-
-            template <typename Pred, typename Xs>
-            constexpr decltype(auto) operator()(Pred&& pred, Xs&& xs) const {
-                return helper(
-                    static_cast<Pred&&>(pred),
-                    static_cast<Xs&&>(xs),
-                    hana::if_(hana::is_empty(xs),
-                        detail::std::true_type{},
-                        detail::std::false_type{}));
+            template <typename ...X>
+            constexpr auto operator()(X&& ...x) const {
+                constexpr detail::std::size_t k = detail::first_true<
+                    !detail::satisfies<Pred, X>()...
+                >();
+                return sequence_detail::make_slice<S, 0>(
+                    sequence_detail::elements<X...>{static_cast<X&&>(x)...},
+                    detail::std::make_index_sequence<k>{});
             }
         };
-    }
 
-    template <typename S, bool condition>
-    struct take_while_impl<S, when<condition>> : default_ {
         template <typename Xs, typename Pred>
-        static constexpr auto apply(Xs xs, Pred pred) {
-            return sequence_detail::for2_(
-                static_cast<Xs&&>(xs),
-                hana::partial(sequence_detail::take_while_predicate{},
-                              static_cast<Pred&&>(pred)),
-                tail
-            )(sequence_detail::take_while_helper{})(empty<S>());
+        static constexpr auto apply(Xs&& xs, Pred&&) {
+            return hana::unpack(static_cast<Xs&&>(xs),
+                take_while_helper<typename detail::std::decay<Pred>::type>{});
         }
     };
 
@@ -1049,7 +1041,7 @@ namespace boost { namespace hana {
             auto done = hana::is_empty(xs);
             return hana::eval_if(done,
                 hana::lazy(empty<S>()),
-                hana::lazy(sequence_detail::zip_unsafe_with_helper{})(
+                hana::lazy_ref(sequence_detail::zip_unsafe_with_helper{})(
                     static_cast<F&&>(f),
                     static_cast<Xs&&>(xs),
                     static_cast<Ys&&>(ys)...
@@ -1106,6 +1098,67 @@ namespace boost { namespace hana {
         }
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // Index-based Iterable methods
+    //////////////////////////////////////////////////////////////////////////
+    template <typename S>
+    struct last_impl<S, when<_models<Sequence, S>{}()>> {
+        struct last_helper {
+            template <typename ...X>
+            constexpr auto operator()(X&& ...x) const {
+                return sequence_detail::forward_at<sizeof...(X) - 1>(
+                    sequence_detail::elements<X...>{static_cast<X&&>(x)...});
+            }
+        };
+
+        template <typename Xs>
+        static constexpr auto apply(Xs&& xs)
+        { return hana::unpack(static_cast<Xs&&>(xs), last_helper{}); }
+    };
+
+    template <typename S>
+    struct drop_at_most_impl<S, when<_models<Sequence, S>{}()>> {
+        template <detail::std::size_t n>
+        struct drop_helper {
+            template <typename ...X>
+            constexpr auto operator()(X&& ...x) const {
+                constexpr detail::std::size_t k =
+                    n < sizeof...(X) ? n : sizeof...(X);
+                return sequence_detail::make_slice<S, k>(
+                    sequence_detail::elements<X...>{static_cast<X&&>(x)...},
+                    detail::std::make_index_sequence<sizeof...(X) - k>{});
+            }
+        };
+
+        template <typename Xs, typename N>
+        static constexpr auto apply(Xs&& xs, N const&) {
+            constexpr detail::std::size_t n = hana::value<N>();
+            return hana::unpack(static_cast<Xs&&>(xs), drop_helper<n>{});
+        }
+    };
+
+    template <typename S>
+    struct drop_while_impl<S, when<_models<Sequence, S>{}()>> {
+        template <typename Pred>
+        struct drop_while_helper {
+            template <typename ...X>
+            constexpr auto operator()(X&& ...x) const {
+                constexpr detail::std::size_t k = detail::first_true<
+                    !detail::satisfies<Pred, X>()...
+                >();
+                return sequence_detail::make_slice<S, k>(
+                    sequence_detail::elements<X...>{static_cast<X&&>(x)...},
+                    detail::std::make_index_sequence<sizeof...(X) - k>{});
+            }
+        };
+
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs&& xs, Pred&&) {
+            return hana::unpack(static_cast<Xs&&>(xs),
+                drop_while_helper<typename detail::std::decay<Pred>::type>{});
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Automatic model of Comparable
     //////////////////////////////////////////////////////////////////////////
@@ -1149,6 +1202,16 @@ namespace boost { namespace hana {
         : Sequence::equal_impl<T, U>
     { };
 
+    //////////////////////////////////////////////////////////////////////////
+    // Automatic model of Hashable
+    //////////////////////////////////////////////////////////////////////////
+    template <typename S>
+    struct hash_impl<S, when<_models<Sequence, S>{}()>> {
+        template <typename Xs>
+        static constexpr detail::std::size_t apply(Xs const& xs)
+        { return hana::unpack(xs, hash_detail::hash_elements{}); }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Automatic model of Orderable
     //////////////////////////////////////////////////////////////////////////
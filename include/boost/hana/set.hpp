@@ -12,20 +12,32 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/fwd/set.hpp>
 
+#include <boost/hana/bool.hpp>
 #include <boost/hana/comparable.hpp>
+#include <boost/hana/constant.hpp>
 #include <boost/hana/core/convert.hpp>
 #include <boost/hana/core/make.hpp>
 #include <boost/hana/core/models.hpp>
 #include <boost/hana/core/operators.hpp>
 #include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/closure.hpp>
+#include <boost/hana/detail/constexpr/algorithm.hpp>
+#include <boost/hana/detail/constexpr/array.hpp>
 #include <boost/hana/detail/erase_key_fwd.hpp>
 #include <boost/hana/detail/insert_fwd.hpp>
+#include <boost/hana/detail/key_index.hpp>
 #include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/declval.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/detail/union_fwd.hpp>
 #include <boost/hana/foldable.hpp>
 #include <boost/hana/functional/flip.hpp>
 #include <boost/hana/functional/id.hpp>
 #include <boost/hana/lazy.hpp>
 #include <boost/hana/logical.hpp>
+#include <boost/hana/maybe.hpp>
 #include <boost/hana/searchable.hpp>
 #include <boost/hana/tuple.hpp>
 
@@ -57,6 +69,99 @@ namespace boost { namespace hana {
         { };
     }
 
+    namespace set_detail {
+        template <typename S>
+        struct index_of;
+
+        template <typename ...Xs>
+        struct index_of<_set<Xs...>> {
+            using type = detail::key_index<Xs...>;
+        };
+
+        template <typename S>
+        using index_t = typename index_of<
+            typename detail::std::decay<S>::type
+        >::type;
+
+        // Whether all the elements of the set `S2` are in the set whose
+        // `key_index` is `Index`, without comparing them one by one.
+        template <typename Index, typename ...Ys>
+        constexpr bool contains_all(_set<Ys...> const*)
+        { return Index::template contains_all<Ys...>(); }
+
+        template <typename S1, typename S2>
+        constexpr bool is_subset() {
+            return contains_all<index_t<S2>>(
+                static_cast<typename detail::std::decay<S1>::type const*>(nullptr)
+            );
+        }
+
+        template <typename S1, typename S2>
+        using both_keyed = detail::std::integral_constant<bool,
+            index_t<S1>::available && index_t<S2>::available
+        >;
+
+        // Indices of the elements of `S1` for which `contains(s2, x)` is
+        // `keep`. This is used to implement the set-theoretic operations
+        // in a single step.
+        template <bool keep, typename S2, typename S1>
+        struct select_indices;
+
+        template <bool keep, typename S2, typename ...Xs>
+        struct select_indices<keep, S2, _set<Xs...>> {
+            static constexpr auto apply() {
+                using detail::constexpr_::count;
+                using detail::constexpr_::array;
+                using detail::std::size_t;
+                using detail::std::declval;
+
+                constexpr size_t N = sizeof...(Xs);
+                constexpr array<bool, N> results = {{
+                    (hana::value<decltype(hana::contains(
+                        declval<S2 const&>(), declval<Xs const&>()
+                    ))>() == keep)...
+                }};
+                constexpr size_t keptN = count(&results[0], &results[N], true);
+                array<size_t, keptN> kept_indices{};
+                size_t* kept = &kept_indices[0];
+                for (size_t index = 0; index < N; ++index)
+                    if (results[index])
+                        *kept++ = index;
+                return kept_indices;
+            }
+        };
+
+        template <bool keep, typename S1, typename S2>
+        constexpr auto select() {
+            return tuple_detail::generate_index_sequence<select_indices<
+                keep,
+                typename detail::std::decay<S2>::type,
+                typename detail::std::decay<S1>::type
+            >>();
+        }
+
+        template <typename S>
+        constexpr auto all() {
+            return detail::std::make_index_sequence<
+                decltype(hana::length(detail::std::declval<S>().storage))::value
+            >{};
+        }
+
+        // Builds a set from the elements of `s1` at indices `i...` and the
+        // elements of `s2` at indices `j...`, which are known to be unique.
+        template <typename S1, detail::std::size_t ...i,
+                  typename S2, detail::std::size_t ...j>
+        constexpr auto merge(S1&& s1, detail::std::index_sequence<i...>,
+                             S2&& s2, detail::std::index_sequence<j...>)
+        {
+            (void)s1; (void)s2; // remove GCC warnings about unused parameters
+            return hana::make<Set>(
+                detail::get<i>(static_cast<S1&&>(s1).storage)...,
+                detail::get<j>(static_cast<S2&&>(s2).storage)...
+            );
+        }
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // make<Set>
     //////////////////////////////////////////////////////////////////////////
@@ -76,12 +181,28 @@ namespace boost { namespace hana {
     template <>
     struct equal_impl<Set, Set> {
         template <typename S1, typename S2>
-        static constexpr decltype(auto) apply(S1&& s1, S2&& s2) {
+        static constexpr auto apply(S1&&, S2&&, detail::std::true_type) {
+            return hana::bool_<
+                decltype(hana::length(detail::std::declval<S1>().storage))::value ==
+                decltype(hana::length(detail::std::declval<S2>().storage))::value &&
+                set_detail::is_subset<S1, S2>()
+            >;
+        }
+
+        template <typename S1, typename S2>
+        static constexpr decltype(auto) apply(S1&& s1, S2&& s2, detail::std::false_type) {
             return hana::and_(
                 hana::equal(hana::length(s1.storage), hana::length(s2.storage)),
                 hana::is_subset(static_cast<S1&&>(s1), static_cast<S2&&>(s2))
             );
         }
+
+        template <typename S1, typename S2>
+        static constexpr decltype(auto) apply(S1&& s1, S2&& s2) {
+            return equal_impl::apply(static_cast<S1&&>(s1),
+                                     static_cast<S2&&>(s2),
+                                     set_detail::both_keyed<S1, S2>{});
+        }
     };
 
     //////////////////////////////////////////////////////////////////////////
@@ -117,6 +238,87 @@ namespace boost { namespace hana {
         }
     };
 
+    template <>
+    struct contains_impl<Set> {
+        template <typename S, typename X>
+        static constexpr auto apply(S&&, X&&, detail::std::true_type)
+        { return hana::bool_<set_detail::index_t<S>::template contains<X>()>; }
+
+        template <typename S, typename X>
+        static constexpr decltype(auto) apply(S&& set, X&& x, detail::std::false_type) {
+            return hana::contains(static_cast<S&&>(set).storage,
+                                  static_cast<X&&>(x));
+        }
+
+        template <typename S, typename X>
+        static constexpr decltype(auto) apply(S&& set, X&& x) {
+            using Index = set_detail::index_t<S>;
+            return contains_impl::apply(static_cast<S&&>(set),
+                                        static_cast<X&&>(x),
+                detail::std::integral_constant<bool,
+                    Index::available && Index::template can_find<X>()
+                >{});
+        }
+    };
+
+    template <>
+    struct find_impl<Set> {
+        template <typename X, typename S>
+        static constexpr auto found(S&&, detail::std::false_type)
+        { return hana::nothing; }
+
+        template <typename X, typename S>
+        static constexpr auto found(S&& set, detail::std::true_type) {
+            return hana::just(detail::get<
+                set_detail::index_t<S>::template find<X>()
+            >(static_cast<S&&>(set).storage));
+        }
+
+        template <typename S, typename X>
+        static constexpr auto apply(S&& set, X&&, detail::std::true_type) {
+            return find_impl::found<X>(static_cast<S&&>(set),
+                detail::std::integral_constant<bool,
+                    set_detail::index_t<S>::template contains<X>()
+                >{});
+        }
+
+        template <typename S, typename X>
+        static constexpr decltype(auto) apply(S&& set, X&& x, detail::std::false_type) {
+            return hana::find(static_cast<S&&>(set).storage,
+                              static_cast<X&&>(x));
+        }
+
+        template <typename S, typename X>
+        static constexpr decltype(auto) apply(S&& set, X&& x) {
+            using Index = set_detail::index_t<S>;
+            return find_impl::apply(static_cast<S&&>(set),
+                                    static_cast<X&&>(x),
+                detail::std::integral_constant<bool,
+                    Index::available && Index::template can_find<X>()
+                >{});
+        }
+    };
+
+    template <>
+    struct is_subset_impl<Set, Set> {
+        template <typename S1, typename S2>
+        static constexpr auto apply(S1&&, S2&&, detail::std::true_type)
+        { return hana::bool_<set_detail::is_subset<S1, S2>()>; }
+
+        template <typename S1, typename S2>
+        static constexpr decltype(auto) apply(S1&& s1, S2&& s2, detail::std::false_type) {
+            return hana::all_of(static_cast<S1&&>(s1),
+                    hana::partial(hana::contains, static_cast<S2&&>(s2)));
+        }
+
+        template <typename S1, typename S2>
+        static constexpr decltype(auto) apply(S1&& s1, S2&& s2) {
+            return is_subset_impl::apply(static_cast<S1&&>(s1),
+                                         static_cast<S2&&>(s2),
+                                         set_detail::both_keyed<S1, S2>{});
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Conversions
     //////////////////////////////////////////////////////////////////////////
@@ -147,10 +349,11 @@ namespace boost { namespace hana {
         };
 
         template <typename S, typename X>
-        static constexpr decltype(auto) apply(S&& set, X&& x) {
+        static constexpr auto apply(S&& set, X&& x) {
             return hana::eval_if(hana::contains(set, x),
-                hana::lazy(set),
-                hana::lazy(insert_helper{})(set, x)
+                hana::lazy_ref(static_cast<S&&>(set)),
+                hana::lazy_ref(insert_helper{})(static_cast<S&&>(set),
+                                                static_cast<X&&>(x))
             );
         }
     };
@@ -169,6 +372,62 @@ namespace boost { namespace hana {
             );
         }
     };
+
+    //////////////////////////////////////////////////////////////////////////
+    // union_
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct union_impl<Set> {
+        template <typename S1, typename S2>
+        static constexpr auto apply(S1&& s1, S2&& s2) {
+            return set_detail::merge(
+                static_cast<S1&&>(s1), set_detail::all<S1>(),
+                static_cast<S2&&>(s2), set_detail::select<false, S2, S1>()
+            );
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // intersection
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct intersection_impl<Set> {
+        template <typename S1, typename S2>
+        static constexpr auto apply(S1&& s1, S2&&) {
+            return set_detail::merge(
+                static_cast<S1&&>(s1), set_detail::select<true, S1, S2>(),
+                hana::make<Set>(), detail::std::index_sequence<>{}
+            );
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // difference
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct difference_impl<Set> {
+        template <typename S1, typename S2>
+        static constexpr auto apply(S1&& s1, S2&&) {
+            return set_detail::merge(
+                static_cast<S1&&>(s1), set_detail::select<false, S1, S2>(),
+                hana::make<Set>(), detail::std::index_sequence<>{}
+            );
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // symmetric_difference
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct symmetric_difference_impl<Set> {
+        template <typename S1, typename S2>
+        static constexpr auto apply(S1&& s1, S2&& s2) {
+            return set_detail::merge(
+                static_cast<S1&&>(s1), set_detail::select<false, S1, S2>(),
+                static_cast<S2&&>(s2), set_detail::select<false, S2, S1>()
+            );
+        }
+    };
 }} // end namespace boost::hana
 
 #endif // !BOOST_HANA_SET_HPP
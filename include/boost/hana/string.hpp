@@ -23,9 +23,11 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/detail/constexpr/algorithm.hpp>
 #include <boost/hana/detail/std/enable_if.hpp>
 #include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
 #include <boost/hana/detail/std/is_same.hpp>
 #include <boost/hana/detail/std/size_t.hpp>
 #include <boost/hana/foldable.hpp>
+#include <boost/hana/hashable.hpp>
 #include <boost/hana/integral_constant.hpp>
 #include <boost/hana/iterable.hpp>
 #include <boost/hana/logical.hpp>
@@ -130,6 +132,20 @@ namespace boost { namespace hana {
         { return false_; }
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // Hashable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct hash_impl<String> {
+        template <char ...s>
+        static constexpr detail::std::size_t apply(_string<s...> const&) {
+            return detail::std::integral_constant<detail::std::size_t,
+                hash_detail::bytes(to_impl<char const*, String>::c_string<s...>,
+                                   sizeof...(s))
+            >::value;
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Orderable
     //////////////////////////////////////////////////////////////////////////
@@ -14,16 +14,34 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/bool.hpp>
 #include <boost/hana/comparable.hpp>
+#include <boost/hana/core/convert.hpp>
 #include <boost/hana/core/datatype.hpp>
 #include <boost/hana/core/default.hpp>
 #include <boost/hana/core/models.hpp>
 #include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/constexpr/algorithm.hpp>
+#include <boost/hana/detail/constexpr/array.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/declval.hpp>
+#include <boost/hana/detail/std/conditional.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/is_lvalue_reference.hpp>
+#include <boost/hana/detail/std/is_trivially_copyable.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/detail/struct_layout.hpp>
+#include <boost/hana/detail/wrong.hpp>
 #include <boost/hana/foldable.hpp>
 #include <boost/hana/functional/compose.hpp>
 #include <boost/hana/functional/partial.hpp>
 #include <boost/hana/functor.hpp>
+#include <boost/hana/fwd/map.hpp>
+#include <boost/hana/fwd/sequence.hpp>
+#include <boost/hana/fwd/string.hpp>
+#include <boost/hana/hashable.hpp>
+#include <boost/hana/iterable.hpp>
 #include <boost/hana/pair.hpp>
 #include <boost/hana/searchable.hpp>
+#include <boost/hana/tuple.hpp>
 
 
 namespace boost { namespace hana {
@@ -67,6 +85,143 @@ namespace boost { namespace hana {
         }
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // members_ref and tie_members
+    //////////////////////////////////////////////////////////////////////////
+    namespace struct_detail {
+        template <typename Object>
+        struct make_members_ref {
+            Object&& object;
+
+            template <typename ...Accessors>
+            constexpr _tuple<decltype(
+                hana::second(detail::std::declval<Accessors>())(
+                    detail::std::declval<Object>()
+                )
+            )...> operator()(Accessors&& ...accessors) const {
+                return {hana::second(static_cast<Accessors&&>(accessors))(
+                    static_cast<Object&&>(object)
+                )...};
+            }
+        };
+    }
+
+    //! @cond
+    template <typename Object>
+    constexpr decltype(auto) _members_ref::operator()(Object&& object) const {
+        using S = typename datatype<Object>::type;
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            static_assert(_models<Struct, S>{},
+            "hana::members_ref(object) requires object to be a Struct");
+        #endif
+
+        return hana::unpack(hana::accessors<S>(),
+            struct_detail::make_members_ref<Object>{
+                static_cast<Object&&>(object)
+            });
+    }
+
+    template <typename Object>
+    constexpr decltype(auto) _tie_members::operator()(Object&& object) const {
+        static_assert(detail::std::is_lvalue_reference<Object>{},
+        "hana::tie_members(object) requires object to be an lvalue; "
+        "use hana::members_ref to get references to the members of "
+        "an rvalue");
+
+        return hana::members_ref(object);
+    }
+    //! @endcond
+
+    //////////////////////////////////////////////////////////////////////////
+    // layout, padding_bytes, is_tightly_packed and contiguous_trivial_runs
+    //////////////////////////////////////////////////////////////////////////
+    namespace struct_detail {
+        template <typename S>
+        struct layout_helper {
+            using Layout = detail::struct_layout_of<
+                S, detail::std::is_trivially_copyable
+            >;
+            using Offsets = typename Layout::Offsets;
+            static constexpr detail::std::size_t n = Layout::n;
+
+            static constexpr void check() {
+                static_assert(Offsets::available,
+                "hana::layout<S>() and hana::contiguous_trivial_runs<S>() "
+                "require the offsets of the members of S to be known; S "
+                "must be a standard-layout type defined with "
+                "BOOST_HANA_DEFINE_STRUCT or BOOST_HANA_ADAPT_STRUCT");
+            }
+
+            static constexpr detail::constexpr_::array<member_layout, n>
+            members() {
+                detail::constexpr_::array<member_layout, n> result{};
+                for (detail::std::size_t i = 0; i < n; ++i) {
+                    result[i] = member_layout{
+                        Offsets::get(i), Layout::size(i),
+                        Layout::alignment(i), Layout::in_block(i)
+                    };
+                }
+                return result;
+            }
+
+            static constexpr detail::std::size_t run_count() {
+                detail::std::size_t count = 0;
+                for (detail::std::size_t i = 0; i < n; ++i)
+                    if (Layout::in_block(i) && Layout::run_end(i) != i)
+                        ++count;
+                return count;
+            }
+
+            static constexpr detail::constexpr_::array<member_run, run_count()>
+            runs() {
+                detail::constexpr_::array<member_run, run_count()> result{};
+                detail::std::size_t k = 0;
+                for (detail::std::size_t i = 0; i < n; ++i) {
+                    if (Layout::in_block(i) && Layout::run_end(i) != i) {
+                        result[k++] = member_run{
+                            i, Layout::run_end(i),
+                            Offsets::get(i), Layout::run_bytes(i)
+                        };
+                    }
+                }
+                return result;
+            }
+        };
+    }
+
+    //! @cond
+    template <typename S>
+    constexpr decltype(auto) _layout<S>::operator()() const {
+        using Helper = struct_detail::layout_helper<S>;
+        Helper::check();
+        return Helper::members();
+    }
+
+    template <typename S>
+    constexpr auto _padding_bytes<S>::operator()() const {
+        using Layout = typename struct_detail::layout_helper<S>::Layout;
+        static_assert(Layout::fits_in(sizeof(S)),
+        "hana::padding_bytes<S>() requires the members of S to be distinct "
+        "members stored in S, whose sizes add up to at most sizeof(S)");
+        return _integral_constant<detail::std::size_t,
+            sizeof(S) - Layout::member_bytes()
+        >{};
+    }
+
+    template <typename S>
+    constexpr auto _is_tightly_packed<S>::operator()() const {
+        using Layout = typename struct_detail::layout_helper<S>::Layout;
+        return _integral_constant<bool, sizeof(S) == Layout::member_bytes()>{};
+    }
+
+    template <typename S>
+    constexpr decltype(auto) _contiguous_trivial_runs<S>::operator()() const {
+        using Helper = struct_detail::layout_helper<S>;
+        Helper::check();
+        return Helper::runs();
+    }
+    //! @endcond
+
     //////////////////////////////////////////////////////////////////////////
     // keys
     //////////////////////////////////////////////////////////////////////////
@@ -128,24 +283,112 @@ namespace boost { namespace hana {
         }
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // Model of Hashable
+    //////////////////////////////////////////////////////////////////////////
+    template <typename S>
+    struct hash_impl<S, when<_models<Struct, S>{}()>> {
+        using Layout = detail::struct_layout_of<S, hash_detail::is_bytewise>;
+        using size_t = detail::std::size_t;
+
+        template <size_t i, typename X>
+        static constexpr decltype(auto) member(X const& x)
+        { return hana::second(hana::at_c<i>(hana::accessors<S>()))(x); }
+
+        template <size_t i, typename X>
+        static size_t hash_member(size_t seed, X const&, detail::in_run)
+        { return seed; }
+
+        template <size_t i, typename X>
+        static size_t hash_member(size_t seed, X const& x, detail::alone)
+        { return hash_detail::combine(seed, hana::hash(member<i>(x))); }
+
+        template <size_t i, typename X>
+        static size_t hash_member(size_t seed, X const& x, detail::run_start) {
+            return hash_detail::combine(seed, hash_detail::bytes(
+                reinterpret_cast<unsigned char const*>(&member<i>(x)),
+                Layout::run_bytes(i)
+            ));
+        }
+
+        template <typename X, size_t ...i>
+        static size_t hash_members(X const& x, detail::std::index_sequence<i...>) {
+            size_t seed = hash_detail::mix(sizeof...(i));
+            using swallow = int[];
+            (void)swallow{0, (seed = hash_member<i>(seed, x,
+                detail::run_kind<Layout::run_end(i), i>{}
+            ), 0)...};
+            return seed;
+        }
+
+        template <typename X>
+        static size_t apply(X const& x) {
+            return hash_members(x,
+                detail::std::make_index_sequence<Layout::n>{});
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Model of Foldable
     //////////////////////////////////////////////////////////////////////////
     namespace struct_detail {
+        // The pair holding the `Member` returned by an accessor. Members
+        // of lvalue objects are held by reference, while members of rvalue
+        // objects are moved into the pair.
+        template <typename Key, typename Member>
+        using member_pair = _pair<
+            typename detail::std::decay<Key>::type,
+            typename detail::std::conditional<
+                detail::std::is_lvalue_reference<Member>{},
+                Member,
+                typename detail::std::decay<Member>::type
+            >::type
+        >;
+
         // This is equivalent to `demux`, except that `demux` can't forward
         // the `udt` because it does not know the `g`s are accessors. Hence,
-        // this can result in faster code.
+        // this can result in faster code. `f` and `udt` are held by
+        // reference, since they are only used during the call to `unpack`.
+        template <typename F, typename Udt>
         struct almost_demux {
-            template <typename F, typename Udt, typename ...Members>
-            constexpr decltype(auto)
-            operator()(F&& f, Udt&& udt, Members&& ...g) const {
-                return static_cast<F&&>(f)(hana::make_pair(
+            F&& f;
+            Udt&& udt;
+
+            template <typename ...Members>
+            constexpr decltype(auto) operator()(Members&& ...g) const {
+                return static_cast<F&&>(f)(member_pair<
+                    decltype(hana::first(static_cast<Members&&>(g))),
+                    decltype(hana::second(static_cast<Members&&>(g))
+                                                (static_cast<Udt&&>(udt)))
+                >{
+                    hana::first(static_cast<Members&&>(g)),
+                    hana::second(static_cast<Members&&>(g))
+                                                (static_cast<Udt&&>(udt))
+                }...);
+            }
+        };
+
+        // Creates a `Tuple` of pairs holding copies of the members of `udt`,
+        // or the members themselves if `udt` is an rvalue.
+        template <typename Udt>
+        struct copy_members {
+            Udt&& udt;
+
+            template <typename ...Members>
+            constexpr auto operator()(Members&& ...g) const {
+                return hana::make<Tuple>(hana::make_pair(
                     hana::first(static_cast<Members&&>(g)),
                     hana::second(static_cast<Members&&>(g))
                                                 (static_cast<Udt&&>(udt))
                 )...);
             }
         };
+
+        template <typename S, typename Udt>
+        constexpr auto copy_pairs(Udt&& udt) {
+            return hana::unpack(hana::accessors<S>(),
+                copy_members<Udt>{static_cast<Udt&&>(udt)});
+        }
     }
 
     template <typename S>
@@ -153,9 +396,37 @@ namespace boost { namespace hana {
         template <typename Udt, typename F>
         static constexpr decltype(auto) apply(Udt&& udt, F&& f) {
             return hana::unpack(hana::accessors<S>(),
-                hana::partial(struct_detail::almost_demux{},
-                              static_cast<F&&>(f),
-                              static_cast<Udt&&>(udt)));
+                struct_detail::almost_demux<F, Udt>{
+                    static_cast<F&&>(f), static_cast<Udt&&>(udt)
+                });
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Conversions
+    //
+    // Unlike the pairs passed to `unpack`, the `Map`s and `Sequence`s
+    // created from a `Struct` never refer to its members, so they can't
+    // outlive it by accident.
+    //////////////////////////////////////////////////////////////////////////
+    template <typename S>
+    struct to_impl<Map, S, when<_models<Struct, S>{}()>> {
+        template <typename Udt>
+        static constexpr auto apply(Udt&& udt) {
+            return hana::to<Map>(
+                struct_detail::copy_pairs<S>(static_cast<Udt&&>(udt)));
+        }
+    };
+
+    template <typename Seq, typename S>
+    struct to_impl<Seq, S, when<_models<Sequence, Seq>{}() &&
+                                _models<Struct, S>{}()>>
+        : embedding<false>
+    {
+        template <typename Udt>
+        static constexpr decltype(auto) apply(Udt&& udt) {
+            return hana::to<Seq>(
+                struct_detail::copy_pairs<S>(static_cast<Udt&&>(udt)));
         }
     };
 
@@ -196,6 +467,193 @@ namespace boost { namespace hana {
                     hana::compose(static_cast<Pred&&>(pred), hana::first));
         }
     };
+
+    //////////////////////////////////////////////////////////////////////////
+    // visit_member
+    //////////////////////////////////////////////////////////////////////////
+    namespace struct_detail {
+        using detail::std::size_t;
+
+        // FNV-1a; it is used both to hash the names of the members at
+        // compile-time and to hash the name being looked up at runtime.
+        constexpr unsigned long long hash_name(char const* s, size_t n) {
+            unsigned long long h = 14695981039346656037ull;
+            for (size_t i = 0; i != n; ++i) {
+                h ^= static_cast<unsigned char>(s[i]);
+                h *= 1099511628211ull;
+            }
+            return h;
+        }
+
+        template <typename Name>
+        struct member_name {
+            static_assert(detail::wrong<Name>{},
+            "hana::visit_member(object, name, f) requires the names of the "
+            "members of the Struct to be compile-time Strings");
+        };
+
+        template <char ...s>
+        struct member_name<_string<s...>> {
+            static constexpr char value[sizeof...(s) + 1] = {s..., '\0'};
+            static constexpr size_t size = sizeof...(s);
+            static constexpr unsigned long long hash = hash_name(value, size);
+        };
+
+        template <char ...s>
+        constexpr char member_name<_string<s...>>::value[sizeof...(s) + 1];
+
+        // An open-addressed hash table mapping the name of each member to
+        // its index in the `accessors` sequence. The table is built at
+        // compile-time and is kept at most half full, so that a runtime
+        // lookup only has to probe a couple of buckets on average.
+        template <typename ...Names>
+        struct member_table {
+            static constexpr size_t size = sizeof...(Names);
+
+            static constexpr size_t bucket_count() {
+                size_t buckets = 1;
+                while (buckets < 2 * size)
+                    buckets *= 2;
+                return buckets;
+            }
+
+            using Buckets = detail::constexpr_::array<size_t, bucket_count()>;
+
+            // Each bucket holds the index of a member plus one, or 0 when
+            // the bucket is empty.
+            static constexpr Buckets make_buckets() {
+                constexpr unsigned long long hashes[] = {
+                    member_name<Names>::hash..., 0
+                };
+                constexpr size_t mask = bucket_count() - 1;
+                Buckets buckets{};
+                for (size_t i = 0; i != size; ++i) {
+                    size_t b = static_cast<size_t>(hashes[i]) & mask;
+                    while (buckets[b] != 0)
+                        b = (b + 1) & mask;
+                    buckets[b] = i + 1;
+                }
+                return buckets;
+            }
+
+            static constexpr Buckets buckets = make_buckets();
+            static constexpr unsigned long long hashes[] = {
+                member_name<Names>::hash..., 0
+            };
+            static constexpr char const* names[] = {
+                member_name<Names>::value..., nullptr
+            };
+            static constexpr size_t sizes[] = {member_name<Names>::size..., 0};
+
+            // Returns the index of the member with the given name, or
+            // `size` if there is no such member.
+            static size_t find(char const* name, size_t length) {
+                constexpr size_t mask = bucket_count() - 1;
+                unsigned long long const h = hash_name(name, length);
+                for (size_t b = static_cast<size_t>(h) & mask;
+                     buckets[b] != 0;
+                     b = (b + 1) & mask)
+                {
+                    size_t const i = buckets[b] - 1;
+                    if (hashes[i] == h && sizes[i] == length &&
+                        detail::constexpr_::equal(names[i], names[i] + length,
+                                                  name, name + length))
+                        return i;
+                }
+                return size;
+            }
+        };
+
+        template <typename ...Names>
+        constexpr typename member_table<Names...>::Buckets
+        member_table<Names...>::buckets;
+
+        template <typename ...Names>
+        constexpr unsigned long long member_table<Names...>::hashes[];
+
+        template <typename ...Names>
+        constexpr char const* member_table<Names...>::names[];
+
+        template <typename ...Names>
+        constexpr size_t member_table<Names...>::sizes[];
+
+        struct make_member_table {
+            template <typename ...Accessors>
+            constexpr member_table<
+                typename detail::std::decay<decltype(
+                    hana::first(detail::std::declval<Accessors>())
+                )>::type...
+            > operator()(Accessors&& ...) const { return {}; }
+        };
+
+        template <typename Name>
+        constexpr auto name_data(Name const& name, int)
+            -> decltype(name.data())
+        { return name.data(); }
+
+        constexpr char const* name_data(char const* name, long)
+        { return name; }
+
+        template <typename Name>
+        constexpr auto name_size(Name const& name, int)
+            -> decltype(static_cast<size_t>(name.size()))
+        { return static_cast<size_t>(name.size()); }
+
+        constexpr size_t name_size(char const* name, long) {
+            size_t n = 0;
+            while (name[n] != '\0')
+                ++n;
+            return n;
+        }
+
+        template <typename S, typename Object, typename F>
+        struct visit_nth_member {
+            template <size_t i>
+            static void apply(Object&& object, F&& f) {
+                static_cast<F&&>(f)(
+                    hana::second(hana::at_c<i>(hana::accessors<S>()))(
+                        static_cast<Object&&>(object)
+                    )
+                );
+            }
+        };
+
+        template <typename S, typename Object, typename F, size_t ...i>
+        void visit_member_helper(Object&& object, size_t index, F&& f,
+                                 detail::std::index_sequence<i...>)
+        {
+            using Visit = void(*)(Object&&, F&&);
+            static constexpr Visit visitors[] = {
+                &visit_nth_member<S, Object, F>::template apply<i>..., nullptr
+            };
+            visitors[index](static_cast<Object&&>(object), static_cast<F&&>(f));
+        }
+    }
+
+    //! @cond
+    template <typename Object, typename Name, typename F>
+    bool _visit_member::operator()(Object&& object, Name const& name, F&& f) const {
+        using S = typename datatype<Object>::type;
+        #ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+            static_assert(_models<Struct, S>{},
+            "hana::visit_member(object, name, f) requires object to be a Struct");
+        #endif
+
+        using Table = decltype(hana::unpack(hana::accessors<S>(),
+                                            struct_detail::make_member_table{}));
+        detail::std::size_t const index = Table::find(
+            struct_detail::name_data(name, int{}),
+            struct_detail::name_size(name, int{})
+        );
+        if (index == Table::size)
+            return false;
+
+        struct_detail::visit_member_helper<S>(static_cast<Object&&>(object),
+            index, static_cast<F&&>(f),
+            detail::std::make_index_sequence<Table::size>{});
+        return true;
+    }
+    //! @endcond
 }} // end namespace boost::hana
 
 #endif // !BOOST_HANA_STRUCT_HPP
@@ -18,6 +18,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/config.hpp>
 #include <boost/hana/core/models.hpp>
 #include <boost/hana/functional/id.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/pair.hpp>
 #include <boost/hana/string.hpp>
 #include <boost/hana/struct.hpp>
@@ -40,6 +41,8 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/preprocessor/variadic/size.hpp>
 #include <boost/preprocessor/variadic/to_seq.hpp>
 
+#include <cstddef>
+
 
 #if !BOOST_PP_VARIADICS && !defined(BOOST_HANA_DOXYGEN_INVOKED)
 #   error "BOOST_PP_VARIADICS must be defined in order to use the functionality provided by this header"
@@ -71,6 +74,18 @@ namespace boost { namespace hana { namespace detail {
     )                                                                       \
 /**/
 
+#define BOOST_HANA_PP_STRUCT_MEMBER_OFFSET_(_, TYPE, MEMBER)               \
+    ::boost::hana::size_t<offsetof(                                         \
+        TYPE,                                                               \
+        BOOST_PP_TUPLE_ELEM(BOOST_PP_DEC(BOOST_PP_TUPLE_SIZE(MEMBER)), MEMBER)\
+    )>                                                                      \
+/**/
+
+// `member_offsets` returns a generic lambda whose return type holds the
+// offsets of the members. This way, `offsetof` is only evaluated when the
+// offsets are actually needed, which should only be for standard-layout
+// types. A member template can't be used, since the macros may be used
+// inside local classes.
 #define BOOST_HANA_PP_STRUCT_ACCESSORS_APPLY(TYPE, MEMBERS)                 \
     static BOOST_HANA_CONSTEXPR_LAMBDA auto apply() {                       \
         return ::boost::hana::make_tuple(                                   \
@@ -81,6 +96,27 @@ namespace boost { namespace hana { namespace detail {
             )                                                               \
         );                                                                  \
     }                                                                       \
+                                                                            \
+    static auto member_offsets() {                                          \
+        return [](auto type) {                                              \
+            using T_ = typename decltype(type)::type;                       \
+            return ::boost::hana::make_tuple(                               \
+                BOOST_PP_SEQ_ENUM(                                          \
+                    BOOST_PP_SEQ_TRANSFORM(                                 \
+                        BOOST_HANA_PP_STRUCT_MEMBER_OFFSET_, T_, MEMBERS    \
+                    )                                                       \
+                )                                                           \
+            );                                                              \
+        };                                                                  \
+    }                                                                       \
+/**/
+
+#define BOOST_HANA_PP_STRUCT_ACCESSORS_APPLY_EMPTY(TYPE, MEMBERS)           \
+    static constexpr auto apply()                                           \
+    { return ::boost::hana::make_tuple(); }                                 \
+                                                                            \
+    static auto member_offsets()                                            \
+    { return [](auto) { return ::boost::hana::make_tuple(); }; }            \
 /**/
 
 #define BOOST_HANA_PP_IGNORE(...) /* nothing */
@@ -110,9 +146,7 @@ namespace boost { namespace hana { namespace detail {
     struct hana { struct accessors_impl {                                   \
         BOOST_PP_IF(HAS_MEMBERS,                                            \
             BOOST_HANA_PP_STRUCT_ACCESSORS_APPLY,                           \
-            static constexpr auto apply()                                   \
-            { return ::boost::hana::make_tuple(); }                         \
-            BOOST_HANA_PP_IGNORE                                            \
+            BOOST_HANA_PP_STRUCT_ACCESSORS_APPLY_EMPTY                      \
         )(TYPE, MEMBERS)                                                    \
     }; }                                                                    \
 /**/
@@ -134,9 +168,7 @@ namespace boost { namespace hana { namespace detail {
         struct accessors_impl<TYPE> {                                       \
             BOOST_PP_IF(HAS_MEMBERS,                                        \
                 BOOST_HANA_PP_STRUCT_ACCESSORS_APPLY,                       \
-                static constexpr auto apply()                               \
-                { return ::boost::hana::make_tuple(); }                     \
-                BOOST_HANA_PP_IGNORE                                        \
+                BOOST_HANA_PP_STRUCT_ACCESSORS_APPLY_EMPTY                  \
             )(TYPE, MEMBERS)                                                \
         };                                                                  \
     }} static_assert(true, "force the usage of a trailing semicolon")       \
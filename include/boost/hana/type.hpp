@@ -18,6 +18,8 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/operators.hpp>
 #include <boost/hana/detail/std/declval.hpp>
 #include <boost/hana/detail/std/remove_reference.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/hashable.hpp>
 #include <boost/hana/integral_constant.hpp>
 
 
@@ -190,6 +192,31 @@ namespace boost { namespace hana {
         static constexpr auto apply(_type<T> const&, _type<T> const&)
         { return true_; }
     };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Hashable
+    //////////////////////////////////////////////////////////////////////////
+    namespace type_detail {
+        // Hashes the name of this function, which is a compile-time string
+        // containing the name of `T`.
+        template <typename T>
+        constexpr detail::std::size_t hash_type_name() {
+            return hash_detail::bytes(__PRETTY_FUNCTION__,
+                                      sizeof(__PRETTY_FUNCTION__) - 1);
+        }
+
+        template <typename T>
+        struct type_hash {
+            static constexpr detail::std::size_t value = hash_type_name<T>();
+        };
+    }
+
+    template <>
+    struct hash_impl<Type> {
+        template <typename T>
+        static constexpr detail::std::size_t apply(_type<T> const&)
+        { return type_detail::type_hash<T>::value; }
+    };
 }} // end namespace boost::hana
 
 #endif // !BOOST_HANA_TYPE_HPP
@@ -0,0 +1,231 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/json.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <climits>
+#include <cmath>
+#include <string>
+#include <vector>
+using namespace boost::hana;
+using experimental::from_json;
+using experimental::json_error;
+using experimental::read_json;
+using experimental::to_json;
+
+
+struct Point {
+    int x;
+    double y;
+
+    struct hana {
+        struct accessors_impl {
+            static auto apply() {
+                return make_tuple(
+                    make_pair(string<'x'>, [](auto&& p) -> decltype(auto) {
+                        return (static_cast<decltype(p)&&>(p).x);
+                    }),
+                    make_pair(string<'y'>, [](auto&& p) -> decltype(auto) {
+                        return (static_cast<decltype(p)&&>(p).y);
+                    })
+                );
+            }
+        };
+    };
+};
+
+struct Shape {
+    std::string name;
+    std::vector<Point> points;
+    bool closed;
+
+    struct hana {
+        struct accessors_impl {
+            static auto apply() {
+                return make_tuple(
+                    make_pair(string<'n', 'a', 'm', 'e'>, [](auto&& s) -> decltype(auto) {
+                        return (static_cast<decltype(s)&&>(s).name);
+                    }),
+                    make_pair(string<'p', 't', 's'>, [](auto&& s) -> decltype(auto) {
+                        return (static_cast<decltype(s)&&>(s).points);
+                    }),
+                    make_pair(string<'c', 'l', 'o', 's', 'e', 'd'>, [](auto&& s) -> decltype(auto) {
+                        return (static_cast<decltype(s)&&>(s).closed);
+                    })
+                );
+            }
+        };
+    };
+};
+
+template <typename T>
+bool fails(std::string const& json) {
+    try { from_json<T>(json); }
+    catch (json_error const&) { return true; }
+    return false;
+}
+
+int main() {
+    // numbers
+    {
+        BOOST_HANA_RUNTIME_CHECK(from_json<int>(std::string{"0"}) == 0);
+        BOOST_HANA_RUNTIME_CHECK(from_json<int>(std::string{" -17 "}) == -17);
+        BOOST_HANA_RUNTIME_CHECK(from_json<int>(std::to_string(INT_MIN)) == INT_MIN);
+        BOOST_HANA_RUNTIME_CHECK(from_json<int>(std::to_string(INT_MAX)) == INT_MAX);
+        BOOST_HANA_RUNTIME_CHECK(from_json<long long>(std::to_string(LLONG_MIN)) == LLONG_MIN);
+        BOOST_HANA_RUNTIME_CHECK(from_json<unsigned long long>(std::to_string(ULLONG_MAX)) == ULLONG_MAX);
+        BOOST_HANA_RUNTIME_CHECK(from_json<unsigned>(std::string{"-0"}) == 0);
+        BOOST_HANA_RUNTIME_CHECK(fails<int>(std::to_string(INT_MAX + 1ll)));
+        BOOST_HANA_RUNTIME_CHECK(fails<int>(std::to_string(INT_MIN - 1ll)));
+        BOOST_HANA_RUNTIME_CHECK(fails<unsigned>("-1"));
+        BOOST_HANA_RUNTIME_CHECK(fails<char>("1"));
+        BOOST_HANA_RUNTIME_CHECK(fails<signed char>("128"));
+        BOOST_HANA_RUNTIME_CHECK(fails<int>("99999999999999999999999"));
+        BOOST_HANA_RUNTIME_CHECK(fails<int>("1.5"));
+        BOOST_HANA_RUNTIME_CHECK(fails<int>(""));
+        BOOST_HANA_RUNTIME_CHECK(fails<int>("x"));
+
+        BOOST_HANA_RUNTIME_CHECK(from_json<double>(std::string{"2.5"}) == 2.5);
+        BOOST_HANA_RUNTIME_CHECK(from_json<double>(std::string{"-1e+300"}) == -1e300);
+        BOOST_HANA_RUNTIME_CHECK(from_json<float>(std::string{"0.5"}) == 0.5f);
+        BOOST_HANA_RUNTIME_CHECK(from_json<double>(std::string{"7"}) == 7);
+        BOOST_HANA_RUNTIME_CHECK(std::isnan(from_json<double>(std::string{"null"})));
+        BOOST_HANA_RUNTIME_CHECK(from_json<double>(to_json(1.0 / 3)) == 1.0 / 3);
+        BOOST_HANA_RUNTIME_CHECK(fails<double>("nul"));
+        BOOST_HANA_RUNTIME_CHECK(fails<double>("-"));
+        BOOST_HANA_RUNTIME_CHECK(fails<double>("+1"));
+        BOOST_HANA_RUNTIME_CHECK(fails<double>("1e"));
+        BOOST_HANA_RUNTIME_CHECK(fails<double>("1."));
+        BOOST_HANA_RUNTIME_CHECK(fails<double>(".5"));
+        BOOST_HANA_RUNTIME_CHECK(fails<double>("01"));
+        BOOST_HANA_RUNTIME_CHECK(fails<double>("1.2.3"));
+        BOOST_HANA_RUNTIME_CHECK(fails<double>("1,5"));
+        BOOST_HANA_RUNTIME_CHECK(fails<double>("1e400"));
+
+        BOOST_HANA_RUNTIME_CHECK(from_json<bool>(std::string{"true"}) == true);
+        BOOST_HANA_RUNTIME_CHECK(from_json<bool>(std::string{"false"}) == false);
+        BOOST_HANA_RUNTIME_CHECK(fails<bool>("tru"));
+        BOOST_HANA_RUNTIME_CHECK(fails<bool>("falsy"));
+    }
+
+    // strings
+    {
+        BOOST_HANA_RUNTIME_CHECK(from_json<std::string>(std::string{R"("")"}) == "");
+        BOOST_HANA_RUNTIME_CHECK(from_json<std::string>(std::string{R"("abc")"}) == "abc");
+        BOOST_HANA_RUNTIME_CHECK(
+            from_json<std::string>(std::string{R"("q\"b\\n\/\nt\t\u0001")"}) == "q\"b\\n/\nt\t\x01"
+        );
+        BOOST_HANA_RUNTIME_CHECK(
+            from_json<std::string>(std::string{R"("é€😀")"}) ==
+            "\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80"
+        );
+        BOOST_HANA_RUNTIME_CHECK(from_json<char>(std::string{R"("a")"}) == 'a');
+        BOOST_HANA_RUNTIME_CHECK(fails<std::string>(R"("abc)"));
+        BOOST_HANA_RUNTIME_CHECK(fails<std::string>(R"("\x")"));
+        BOOST_HANA_RUNTIME_CHECK(fails<std::string>(R"("\u12")"));
+        BOOST_HANA_RUNTIME_CHECK(
+            from_json<std::string>(std::string{R"("\ud83d\ude00")"}) == "\xf0\x9f\x98\x80"
+        );
+        BOOST_HANA_RUNTIME_CHECK(fails<std::string>(R"("\ud800\u0041")"));
+        BOOST_HANA_RUNTIME_CHECK(fails<std::string>(R"("\ud800")"));
+        BOOST_HANA_RUNTIME_CHECK(fails<std::string>(R"("\udc00")"));
+        BOOST_HANA_RUNTIME_CHECK(fails<std::string>("abc"));
+        BOOST_HANA_RUNTIME_CHECK(fails<char>(R"("ab")"));
+
+        BOOST_HANA_RUNTIME_CHECK(from_json<std::string>(to_json(std::string{"\n\"\x1f"})) == "\n\"\x1f");
+    }
+
+    // Sequences and std::vector
+    {
+        BOOST_HANA_CONSTANT_CHECK(from_json<_tuple<>>(std::string{"[]"}) == make_tuple());
+        BOOST_HANA_RUNTIME_CHECK(
+            from_json<_tuple<int, std::string, _tuple<bool>>>(std::string{R"([1, "a", [true]])"})
+            == make_tuple(1, std::string{"a"}, make_tuple(true))
+        );
+        BOOST_HANA_RUNTIME_CHECK(fails<_tuple<int, int>>("[1]"));
+        BOOST_HANA_RUNTIME_CHECK(fails<_tuple<int>>("[1, 2]"));
+
+        BOOST_HANA_RUNTIME_CHECK(from_json<std::vector<int>>(std::string{"[ ]"}).empty());
+        BOOST_HANA_RUNTIME_CHECK(
+            from_json<std::vector<int>>(std::string{"[1,2, 3]"}) == std::vector<int>{1, 2, 3}
+        );
+        BOOST_HANA_RUNTIME_CHECK(
+            from_json<std::vector<std::vector<int>>>(std::string{"[[1],[],[2,3]]"}) ==
+            (std::vector<std::vector<int>>{{1}, {}, {2, 3}})
+        );
+        BOOST_HANA_RUNTIME_CHECK(fails<std::vector<int>>("[1 2]"));
+        BOOST_HANA_RUNTIME_CHECK(fails<std::vector<int>>("[1,"));
+
+        // existing elements are replaced
+        std::vector<int> xs{4, 5, 6, 7};
+        std::string json = "[8]";
+        read_json(json.data(), json.data() + json.size(), xs);
+        BOOST_HANA_RUNTIME_CHECK(xs == std::vector<int>{8});
+    }
+
+    // Structs
+    {
+        Point p = from_json<Point>(std::string{R"({"x": 1, "y": 2.5})"});
+        BOOST_HANA_RUNTIME_CHECK(p.x == 1 && p.y == 2.5);
+
+        // keys in any order, unknown keys are skipped, escaped keys are decoded
+        p = from_json<Point>(std::string{
+            R"({"unknown": {"a": [1, "}", {"b": null}]}, "y": -3, "x": 4, "z": "\"", "w": true})"
+        });
+        BOOST_HANA_RUNTIME_CHECK(p.x == 4 && p.y == -3);
+
+        // missing keys are left untouched
+        p = Point{5, 6};
+        std::string json = R"({"y": 7})";
+        read_json(json.data(), json.data() + json.size(), p);
+        BOOST_HANA_RUNTIME_CHECK(p.x == 5 && p.y == 7);
+
+        Shape shape = from_json<Shape>(std::string{
+            R"({"name": "tri", "closed": true,
+                "pts": [{"x": 0, "y": 0}, {"x": 1, "y": 0.5}, {"x": 2, "y": -1}]})"
+        });
+        BOOST_HANA_RUNTIME_CHECK(shape.name == "tri");
+        BOOST_HANA_RUNTIME_CHECK(shape.closed);
+        BOOST_HANA_RUNTIME_CHECK(shape.points.size() == 3);
+        BOOST_HANA_RUNTIME_CHECK(shape.points[1].x == 1 && shape.points[1].y == 0.5);
+
+        // round trip with the writer
+        Shape copy = from_json<Shape>(to_json(shape));
+        BOOST_HANA_RUNTIME_CHECK(to_json(copy) == to_json(shape));
+
+        BOOST_HANA_RUNTIME_CHECK(fails<Point>(R"({"x": 1 "y": 2})"));
+        BOOST_HANA_RUNTIME_CHECK(fails<Point>(R"({"x" 1})"));
+        BOOST_HANA_RUNTIME_CHECK(fails<Point>(R"({"x": "1"})"));
+        BOOST_HANA_RUNTIME_CHECK(fails<Point>(R"({"x": 1)"));
+        BOOST_HANA_RUNTIME_CHECK(fails<Point>(R"({"x": 1} x)"));
+        BOOST_HANA_RUNTIME_CHECK(fails<Point>(R"({"z": "\)"));
+        BOOST_HANA_RUNTIME_CHECK(fails<Point>(R"({"z": tru})"));
+        BOOST_HANA_RUNTIME_CHECK(fails<Point>(R"({"z": abc})"));
+        BOOST_HANA_RUNTIME_CHECK(fails<Point>(R"({"z": [1 2]})"));
+        BOOST_HANA_RUNTIME_CHECK(fails<Point>(R"({"z": {1: 2}})"));
+        BOOST_HANA_RUNTIME_CHECK(fails<Point>(R"({"z": [1.2.3]})"));
+
+        // deeply nested unknown values don't overflow the stack
+        std::string deep(100000, '[');
+        BOOST_HANA_RUNTIME_CHECK(fails<Point>(R"({"z": )" + deep + "}"));
+        deep = R"({"z": )" + deep + std::string(100000, ']') + R"(, "x": 3})";
+        read_json(deep.data(), deep.data() + deep.size(), p);
+        BOOST_HANA_RUNTIME_CHECK(p.x == 3);
+        BOOST_HANA_RUNTIME_CHECK(fails<Point>(R"([1, 2])"));
+    }
+
+    // read_json returns a pointer past the parsed value
+    {
+        std::string json = "[1, 2] tail";
+        std::vector<int> xs;
+        char const* last = read_json(json.data(), json.data() + json.size(), xs);
+        BOOST_HANA_RUNTIME_CHECK(std::string(last) == " tail");
+    }
+}
@@ -0,0 +1,162 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/json.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <climits>
+#include <iterator>
+#include <locale>
+#include <sstream>
+#include <string>
+#include <vector>
+using namespace boost::hana;
+using experimental::to_json;
+using experimental::write_json;
+
+
+struct comma_decimal_point : std::numpunct<char> {
+    char do_decimal_point() const override { return ','; }
+};
+
+struct Empty {
+    struct hana {
+        struct accessors_impl {
+            static auto apply() { return make_tuple(); }
+        };
+    };
+};
+
+struct Point {
+    int x;
+    double y;
+
+    struct hana {
+        struct accessors_impl {
+            static auto apply() {
+                return make_tuple(
+                    make_pair(string<'x'>, [](auto&& p) -> decltype(auto) {
+                        return (static_cast<decltype(p)&&>(p).x);
+                    }),
+                    make_pair(string<'y'>, [](auto&& p) -> decltype(auto) {
+                        return (static_cast<decltype(p)&&>(p).y);
+                    })
+                );
+            }
+        };
+    };
+};
+
+struct Shape {
+    std::string name;
+    std::vector<Point> points;
+    Empty tag;
+
+    struct hana {
+        struct accessors_impl {
+            static auto apply() {
+                return make_tuple(
+                    make_pair(string<'n', 'a', 'm', 'e'>, [](auto&& s) -> decltype(auto) {
+                        return (static_cast<decltype(s)&&>(s).name);
+                    }),
+                    make_pair(string<'p', 't', 's'>, [](auto&& s) -> decltype(auto) {
+                        return (static_cast<decltype(s)&&>(s).points);
+                    }),
+                    make_pair(string<'t', 'a', 'g'>, [](auto&& s) -> decltype(auto) {
+                        return (static_cast<decltype(s)&&>(s).tag);
+                    })
+                );
+            }
+        };
+    };
+};
+
+int main() {
+    // numbers
+    {
+        BOOST_HANA_RUNTIME_CHECK(to_json(0) == "0");
+        BOOST_HANA_RUNTIME_CHECK(to_json(-17) == "-17");
+        BOOST_HANA_RUNTIME_CHECK(to_json(123456789u) == "123456789");
+        BOOST_HANA_RUNTIME_CHECK(to_json(INT_MIN) == std::to_string(INT_MIN));
+        BOOST_HANA_RUNTIME_CHECK(to_json(LLONG_MIN) == std::to_string(LLONG_MIN));
+        BOOST_HANA_RUNTIME_CHECK(to_json(ULLONG_MAX) == std::to_string(ULLONG_MAX));
+        BOOST_HANA_RUNTIME_CHECK(to_json(true) == "true");
+        BOOST_HANA_RUNTIME_CHECK(to_json(false) == "false");
+        BOOST_HANA_RUNTIME_CHECK(to_json(2.5) == "2.5");
+        BOOST_HANA_RUNTIME_CHECK(to_json(0.1) == "0.1");
+        BOOST_HANA_RUNTIME_CHECK(to_json(-1e300) == "-1e+300");
+        BOOST_HANA_RUNTIME_CHECK(to_json(1.0 / 3) == "0.33333333333333331");
+        BOOST_HANA_RUNTIME_CHECK(to_json(0.5f) == "0.5");
+        BOOST_HANA_RUNTIME_CHECK(to_json(1.0 / 0.0) == "null");
+    }
+
+    // numbers do not depend on the global locale
+    {
+        std::locale old = std::locale::global(
+            std::locale(std::locale::classic(), new comma_decimal_point)
+        );
+        BOOST_HANA_RUNTIME_CHECK(to_json(2.5) == "2.5");
+        BOOST_HANA_RUNTIME_CHECK(to_json(1.0 / 3) == "0.33333333333333331");
+        BOOST_HANA_RUNTIME_CHECK(to_json(0.5f) == "0.5");
+        std::locale::global(old);
+    }
+
+    // strings
+    {
+        BOOST_HANA_RUNTIME_CHECK(to_json('a') == R"("a")");
+        BOOST_HANA_RUNTIME_CHECK(to_json("") == R"("")");
+        BOOST_HANA_RUNTIME_CHECK(to_json(std::string("abc")) == R"("abc")");
+        BOOST_HANA_RUNTIME_CHECK(to_json(BOOST_HANA_STRING("abc")) == R"("abc")");
+        BOOST_HANA_RUNTIME_CHECK(
+            to_json("q\"b\\n\nt\t\x01") == R"("q\"b\\n\nt\t\u0001")"
+        );
+        char const* s = "ptr";
+        BOOST_HANA_RUNTIME_CHECK(to_json(s) == R"("ptr")");
+    }
+
+    // Sequences and std::vector
+    {
+        BOOST_HANA_RUNTIME_CHECK(to_json(make_tuple()) == "[]");
+        BOOST_HANA_RUNTIME_CHECK(to_json(make_tuple(1)) == "[1]");
+        BOOST_HANA_RUNTIME_CHECK(
+            to_json(make_tuple(1, "a", make_tuple(true, 'c'))) == R"([1,"a",[true,"c"]])"
+        );
+        BOOST_HANA_RUNTIME_CHECK(to_json(std::vector<int>{}) == "[]");
+        BOOST_HANA_RUNTIME_CHECK(to_json(std::vector<int>{1, 2, 3}) == "[1,2,3]");
+    }
+
+    // Structs
+    {
+        BOOST_HANA_RUNTIME_CHECK(to_json(Empty{}) == "{}");
+        BOOST_HANA_RUNTIME_CHECK(to_json(Point{1, 2.5}) == R"({"x":1,"y":2.5})");
+
+        Shape shape{"tri", {{0, 0}, {1, 0.5}, {2, -1}}, {}};
+        BOOST_HANA_RUNTIME_CHECK(to_json(shape) ==
+            R"({"name":"tri","pts":[{"x":0,"y":0},{"x":1,"y":0.5},{"x":2,"y":-1}],"tag":{}})"
+        );
+    }
+
+    // writing to different kinds of output iterators
+    {
+        Point p{-3, 0.25};
+
+        char buffer[32];
+        char* last = write_json(buffer, p);
+        BOOST_HANA_RUNTIME_CHECK(std::string(buffer, last) == R"({"x":-3,"y":0.25})");
+
+        std::ostringstream os;
+        write_json(std::ostreambuf_iterator<char>(os), p);
+        BOOST_HANA_RUNTIME_CHECK(os.str() == R"({"x":-3,"y":0.25})");
+
+        std::vector<char> v;
+        write_json(std::back_inserter(v), make_tuple(p, p));
+        BOOST_HANA_RUNTIME_CHECK(std::string(v.begin(), v.end()) ==
+            R"([{"x":-3,"y":0.25},{"x":-3,"y":0.25}])");
+    }
+}
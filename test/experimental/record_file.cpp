@@ -0,0 +1,285 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/record_file.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+using namespace boost::hana;
+using experimental::mapped_records;
+using experimental::record_file_error;
+using experimental::record_writer;
+
+
+#define ACCESSOR(NAME)                                                      \
+    make_pair(BOOST_HANA_STRING(#NAME), [](auto&& s) -> decltype(auto) {    \
+        return (static_cast<decltype(s)&&>(s).NAME);                        \
+    })                                                                      \
+/**/
+
+#define OFFSET(TYPE, NAME) boost::hana::size_t<offsetof(TYPE, NAME)>
+
+enum class Side : std::uint8_t { buy, sell };
+
+struct Record {
+    std::uint64_t id;
+    double price;
+    std::int32_t qty;
+    Side side;
+
+    struct hana {
+        struct accessors_impl {
+            static auto apply() {
+                return make_tuple(ACCESSOR(id), ACCESSOR(price),
+                                  ACCESSOR(qty), ACCESSOR(side));
+            }
+
+            static auto member_offsets() {
+                return [](auto) {
+                    return make_tuple(OFFSET(Record, id), OFFSET(Record, price),
+                                      OFFSET(Record, qty), OFFSET(Record, side));
+                };
+            }
+        };
+    };
+};
+
+// A newer version of Record: `side` was removed, `venue` was added, `qty`
+// changed type and the remaining members were reordered.
+struct RecordV2 {
+    double price;
+    std::uint16_t venue;
+    std::int64_t qty;
+    std::uint64_t id;
+
+    struct hana {
+        struct accessors_impl {
+            static auto apply() {
+                return make_tuple(ACCESSOR(price), ACCESSOR(venue),
+                                  ACCESSOR(qty), ACCESSOR(id));
+            }
+
+            static auto member_offsets() {
+                return [](auto) {
+                    return make_tuple(OFFSET(RecordV2, price), OFFSET(RecordV2, venue),
+                                      OFFSET(RecordV2, qty), OFFSET(RecordV2, id));
+                };
+            }
+        };
+    };
+};
+
+// A record aligned more strictly than any fundamental type.
+struct Aligned {
+    alignas(2 * alignof(std::max_align_t)) std::uint64_t id;
+
+    struct hana {
+        struct accessors_impl {
+            static auto apply()
+            { return make_tuple(ACCESSOR(id)); }
+
+            static auto member_offsets()
+            { return [](auto) { return make_tuple(OFFSET(Aligned, id)); }; }
+        };
+    };
+};
+
+Record make_record(std::size_t i) {
+    Record r{};
+    r.id = i;
+    r.price = 0.5 * i;
+    r.qty = static_cast<std::int32_t>(i) - 50;
+    r.side = i % 2 ? Side::sell : Side::buy;
+    return r;
+}
+
+void write_file(std::string const& path, std::string const& bytes) {
+    std::FILE* f = std::fopen(path.c_str(), "wb");
+    std::fwrite(bytes.data(), 1, bytes.size(), f);
+    std::fclose(f);
+}
+
+std::string read_file(std::string const& path) {
+    std::string bytes;
+    std::FILE* f = std::fopen(path.c_str(), "rb");
+    char buffer[4096];
+    std::size_t n;
+    while ((n = std::fread(buffer, 1, sizeof(buffer), f)) != 0)
+        bytes.append(buffer, n);
+    std::fclose(f);
+    return bytes;
+}
+
+template <typename S>
+bool throws(std::string const& path) {
+    try { mapped_records<S>{path}; }
+    catch (record_file_error const&) { return true; }
+    return false;
+}
+
+int main() {
+    std::string const path = "test.experimental.record_file.bin";
+    std::vector<Record> records;
+    for (std::size_t i = 0; i < 1000; ++i)
+        records.push_back(make_record(i));
+
+    // schema
+    {
+        auto schema = experimental::record_schema<Record>();
+        BOOST_HANA_RUNTIME_CHECK(schema.size() == 4);
+        BOOST_HANA_RUNTIME_CHECK(schema[0].name == "id");
+        BOOST_HANA_RUNTIME_CHECK(schema[0].kind == 'u');
+        BOOST_HANA_RUNTIME_CHECK(schema[1].name == "price");
+        BOOST_HANA_RUNTIME_CHECK(schema[1].kind == 'f');
+        BOOST_HANA_RUNTIME_CHECK(schema[2].kind == 'i');
+        BOOST_HANA_RUNTIME_CHECK(schema[2].offset == offsetof(Record, qty));
+        BOOST_HANA_RUNTIME_CHECK(schema[3].kind == 'e');
+        BOOST_HANA_RUNTIME_CHECK(schema[3].size == 1);
+
+        BOOST_HANA_RUNTIME_CHECK(experimental::record_schema_hash<Record>() ==
+                                 experimental::record_schema_hash<Record>());
+        BOOST_HANA_RUNTIME_CHECK(experimental::record_schema_hash<Record>() !=
+                                 experimental::record_schema_hash<RecordV2>());
+    }
+
+    // write and read back in place
+    {
+        {
+            record_writer<Record> writer{path};
+            writer.write(records.data(), 600);
+            for (std::size_t i = 600; i < records.size(); ++i)
+                writer.write(records[i]);
+            BOOST_HANA_RUNTIME_CHECK(writer.size() == 1000);
+            writer.close();
+            writer.close();
+        }
+
+        mapped_records<Record> file{path};
+        BOOST_HANA_RUNTIME_CHECK(file.schema_matches());
+        BOOST_HANA_RUNTIME_CHECK(file.schema_hash() ==
+                                 experimental::record_schema_hash<Record>());
+        BOOST_HANA_RUNTIME_CHECK(file.columns() ==
+                                 experimental::record_schema<Record>());
+        BOOST_HANA_RUNTIME_CHECK(file.size() == 1000);
+        BOOST_HANA_RUNTIME_CHECK(file.end() - file.begin() == 1000);
+        BOOST_HANA_RUNTIME_CHECK(
+            reinterpret_cast<std::uintptr_t>(file.data()) % alignof(Record) == 0);
+
+        std::size_t i = 0;
+        for (Record const& r : file) {
+            BOOST_HANA_RUNTIME_CHECK(r.id == records[i].id);
+            BOOST_HANA_RUNTIME_CHECK(r.price == records[i].price);
+            BOOST_HANA_RUNTIME_CHECK(r.qty == records[i].qty);
+            BOOST_HANA_RUNTIME_CHECK(r.side == records[i].side);
+            ++i;
+        }
+        BOOST_HANA_RUNTIME_CHECK(i == 1000);
+        BOOST_HANA_RUNTIME_CHECK(&file[999] == &file.at(999));
+        BOOST_HANA_RUNTIME_CHECK(file[123].id == 123);
+
+        Record p = file.project(321);
+        BOOST_HANA_RUNTIME_CHECK(p.id == 321 && p.qty == 321 - 50);
+
+        bool thrown = false;
+        try { file.at(1000); } catch (record_file_error const&) { thrown = true; }
+        BOOST_HANA_RUNTIME_CHECK(thrown);
+    }
+
+    // over-aligned records
+    {
+        Aligned aligned[3] = {{7}, {8}, {9}};
+        experimental::write_records(path, aligned, 3);
+        mapped_records<Aligned> file{path};
+        BOOST_HANA_RUNTIME_CHECK(file.schema_matches());
+        BOOST_HANA_RUNTIME_CHECK(
+            reinterpret_cast<std::uintptr_t>(file.data()) % alignof(Aligned) == 0);
+        BOOST_HANA_RUNTIME_CHECK(file[0].id == 7 && file[2].id == 9);
+        BOOST_HANA_RUNTIME_CHECK(file.project(1).id == 8);
+    }
+
+    // the destructor of the writer finishes the file
+    {
+        {
+            record_writer<Record> writer{path};
+            writer.write(records.data(), 10);
+        }
+        mapped_records<Record> file{path};
+        BOOST_HANA_RUNTIME_CHECK(file.size() == 10);
+        BOOST_HANA_RUNTIME_CHECK(file[9].id == 9);
+    }
+
+    // empty files
+    {
+        experimental::write_records<Record>(path, nullptr, 0);
+        mapped_records<Record> file{path};
+        BOOST_HANA_RUNTIME_CHECK(file.schema_matches());
+        BOOST_HANA_RUNTIME_CHECK(file.empty());
+        BOOST_HANA_RUNTIME_CHECK(file.begin() == file.end());
+    }
+
+    // column projection when the schema does not match
+    {
+        experimental::write_records(path, records.data(), records.size());
+        mapped_records<RecordV2> file{path};
+        BOOST_HANA_RUNTIME_CHECK(!file.schema_matches());
+        BOOST_HANA_RUNTIME_CHECK(file.size() == 1000);
+        BOOST_HANA_RUNTIME_CHECK(file.schema_hash() ==
+                                 experimental::record_schema_hash<Record>());
+
+        for (std::size_t i = 0; i < file.size(); ++i) {
+            RecordV2 r = file.project(i);
+            BOOST_HANA_RUNTIME_CHECK(r.id == records[i].id);
+            BOOST_HANA_RUNTIME_CHECK(r.price == records[i].price);
+            BOOST_HANA_RUNTIME_CHECK(r.venue == 0);
+            BOOST_HANA_RUNTIME_CHECK(r.qty == 0);
+        }
+
+        RecordV2 r{};
+        r.venue = 7;
+        r.qty = 8;
+        file.project(42, r);
+        BOOST_HANA_RUNTIME_CHECK(r.id == 42 && r.venue == 7 && r.qty == 8);
+
+        bool thrown = false;
+        try { file.begin(); } catch (record_file_error const&) { thrown = true; }
+        BOOST_HANA_RUNTIME_CHECK(thrown);
+    }
+
+    // malformed files
+    {
+        experimental::write_records(path, records.data(), records.size());
+        std::string const good = read_file(path);
+
+        BOOST_HANA_RUNTIME_CHECK(throws<Record>("no/such/record/file"));
+
+        write_file(path, "");
+        BOOST_HANA_RUNTIME_CHECK(throws<Record>(path));
+
+        write_file(path, good.substr(0, 20));
+        BOOST_HANA_RUNTIME_CHECK(throws<Record>(path));
+
+        std::string bad_magic = good;
+        bad_magic[0] = 'X';
+        write_file(path, bad_magic);
+        BOOST_HANA_RUNTIME_CHECK(throws<Record>(path));
+
+        write_file(path, good.substr(0, good.size() - 1));
+        BOOST_HANA_RUNTIME_CHECK(throws<Record>(path));
+        BOOST_HANA_RUNTIME_CHECK(throws<RecordV2>(path));
+
+        write_file(path, good);
+        BOOST_HANA_RUNTIME_CHECK(!throws<Record>(path));
+    }
+
+    std::remove(path.c_str());
+}
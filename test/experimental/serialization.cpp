@@ -0,0 +1,264 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/experimental/serialization.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+using namespace boost::hana;
+using experimental::deserialize;
+using experimental::serialization_error;
+using experimental::serialize;
+using experimental::serialized_size;
+
+
+#define ACCESSOR(NAME)                                                      \
+    make_pair(BOOST_HANA_STRING(#NAME), [](auto&& s) -> decltype(auto) {    \
+        return (static_cast<decltype(s)&&>(s).NAME);                        \
+    })                                                                      \
+/**/
+
+#define OFFSET(TYPE, NAME) boost::hana::size_t<offsetof(TYPE, NAME)>
+
+// Record is laid out like this on all the platforms we care about:
+//  a: [0, 4), b: [4, 8), c: [8, 9), (padding), d: [16, 24), e: [24, 32)
+struct Record {
+    std::int32_t a;
+    float b;
+    char c;
+    double d;
+    std::string e;
+
+    struct hana {
+        struct accessors_impl {
+            static auto apply() {
+                return make_tuple(ACCESSOR(a), ACCESSOR(b), ACCESSOR(c),
+                                  ACCESSOR(d), ACCESSOR(e));
+            }
+
+            static auto member_offsets() {
+                return [](auto) {
+                    return make_tuple(OFFSET(Record, a), OFFSET(Record, b),
+                                      OFFSET(Record, c), OFFSET(Record, d),
+                                      OFFSET(Record, e));
+                };
+            }
+        };
+    };
+};
+
+// Same as Record, but the offsets of the members are unknown.
+struct Opaque {
+    std::int32_t a;
+    float b;
+    char c;
+    double d;
+    std::string e;
+
+    struct hana {
+        struct accessors_impl {
+            static auto apply() {
+                return make_tuple(ACCESSOR(a), ACCESSOR(b), ACCESSOR(c),
+                                  ACCESSOR(d), ACCESSOR(e));
+            }
+        };
+    };
+};
+
+struct Packed {
+    std::int32_t x, y, z;
+
+    struct hana {
+        struct accessors_impl {
+            static auto apply()
+            { return make_tuple(ACCESSOR(x), ACCESSOR(y), ACCESSOR(z)); }
+
+            static auto member_offsets() {
+                return [](auto) {
+                    return make_tuple(OFFSET(Packed, x), OFFSET(Packed, y),
+                                      OFFSET(Packed, z));
+                };
+            }
+        };
+    };
+};
+
+struct Nested {
+    Packed p;
+    std::vector<Packed> ps;
+    std::vector<Record> rs;
+
+    struct hana {
+        struct accessors_impl {
+            static auto apply()
+            { return make_tuple(ACCESSOR(p), ACCESSOR(ps), ACCESSOR(rs)); }
+        };
+    };
+};
+
+enum class Color : std::uint8_t { red, green, blue };
+
+template <typename T>
+bool fails(std::string const& in) {
+    try { deserialize<T>(in); }
+    catch (serialization_error const&) { return true; }
+    return false;
+}
+
+int main() {
+    using experimental::serialization_detail::layout_of;
+
+    // runs are detected only when the offsets are known
+    {
+        static_assert(layout_of<Record>::run_end(0) == 3, ""); // a, b, c
+        static_assert(layout_of<Record>::run_end(1) == 1, "");
+        static_assert(layout_of<Record>::run_end(2) == 2, "");
+        static_assert(layout_of<Record>::run_end(3) == 4, ""); // d (padding before)
+        static_assert(layout_of<Record>::run_end(4) == 5, ""); // e (not raw)
+        static_assert(layout_of<Record>::run_bytes(0) == 9, "");
+
+        static_assert(layout_of<Packed>::run_end(0) == 3, "");
+        static_assert(layout_of<Packed>::run_bytes(0) == 12, "");
+
+        static_assert(layout_of<Opaque>::run_end(0) == 1, "");
+        static_assert(layout_of<Opaque>::run_end(1) == 2, "");
+    }
+
+    // raw objects
+    {
+        std::string buffer;
+        serialize(std::int32_t{0x01020304}, buffer);
+        serialize(2.5, buffer);
+        BOOST_HANA_RUNTIME_CHECK(buffer.size() == 4 + 8);
+
+        std::int32_t i = deserialize<std::int32_t>(buffer.data(), buffer.data() + 4);
+        BOOST_HANA_RUNTIME_CHECK(i == 0x01020304);
+        double d = deserialize<double>(buffer.data() + 4, buffer.data() + buffer.size());
+        BOOST_HANA_RUNTIME_CHECK(d == 2.5);
+        BOOST_HANA_RUNTIME_CHECK(fails<std::int32_t>(std::string(3, '\0')));
+        BOOST_HANA_RUNTIME_CHECK(fails<std::int32_t>(std::string(5, '\0')));
+    }
+
+    // Structs: padding is not written, and the result does not depend
+    // on whether members are coalesced
+    {
+        Record r{-1, 1.5f, 'x', 3.25, "hello"};
+        Opaque o{-1, 1.5f, 'x', 3.25, "hello"};
+        std::string rbuf, obuf;
+        serialize(r, rbuf);
+        serialize(o, obuf);
+        BOOST_HANA_RUNTIME_CHECK(rbuf.size() == 4 + 4 + 1 + 8 + 8 + 5);
+        BOOST_HANA_RUNTIME_CHECK(rbuf.size() == serialized_size(r));
+        BOOST_HANA_RUNTIME_CHECK(rbuf == obuf);
+
+        Record r2 = deserialize<Record>(rbuf);
+        BOOST_HANA_RUNTIME_CHECK(r2.a == -1 && r2.b == 1.5f && r2.c == 'x' &&
+                                 r2.d == 3.25 && r2.e == "hello");
+        Opaque o2 = deserialize<Opaque>(rbuf);
+        BOOST_HANA_RUNTIME_CHECK(o2.a == -1 && o2.b == 1.5f && o2.c == 'x' &&
+                                 o2.d == 3.25 && o2.e == "hello");
+
+        for (std::size_t n = 0; n < rbuf.size(); ++n)
+            BOOST_HANA_RUNTIME_CHECK(fails<Record>(rbuf.substr(0, n)));
+        BOOST_HANA_RUNTIME_CHECK(fails<Record>(rbuf + '\0'));
+    }
+
+    // raw buffers
+    {
+        Packed p{1, 2, 3};
+        char buffer[12];
+        char* last = serialize(p, buffer);
+        BOOST_HANA_RUNTIME_CHECK(last == buffer + 12);
+        std::int32_t xyz[3];
+        std::memcpy(xyz, buffer, sizeof(xyz));
+        BOOST_HANA_RUNTIME_CHECK(xyz[0] == 1 && xyz[1] == 2 && xyz[2] == 3);
+
+        Packed q = deserialize<Packed>(buffer, buffer + 12);
+        BOOST_HANA_RUNTIME_CHECK(q.x == 1 && q.y == 2 && q.z == 3);
+    }
+
+    // Sequences, std::vector and std::string
+    {
+        auto xs = make_tuple(std::uint8_t{7}, std::string{"abc"},
+                             std::vector<std::int16_t>{1, 2, 3},
+                             std::vector<std::string>{"", "de"},
+                             make_tuple());
+        std::vector<char> buffer;
+        serialize(xs, buffer);
+        BOOST_HANA_RUNTIME_CHECK(buffer.size() ==
+            1 + (8 + 3) + (8 + 3 * 2) + (8 + (8 + 0) + (8 + 2)));
+        BOOST_HANA_RUNTIME_CHECK(buffer.size() == serialized_size(xs));
+
+        auto ys = deserialize<decltype(xs)>(buffer);
+        BOOST_HANA_RUNTIME_CHECK(at_c<0>(ys) == 7);
+        BOOST_HANA_RUNTIME_CHECK(at_c<1>(ys) == "abc");
+        BOOST_HANA_RUNTIME_CHECK(at_c<2>(ys) == (std::vector<std::int16_t>{1, 2, 3}));
+        BOOST_HANA_RUNTIME_CHECK(at_c<3>(ys) == (std::vector<std::string>{"", "de"}));
+
+        // a corrupted length prefix is detected before allocating
+        std::string corrupted(8, '\xff');
+        BOOST_HANA_RUNTIME_CHECK(fails<std::vector<int>>(corrupted));
+        BOOST_HANA_RUNTIME_CHECK(fails<std::string>(corrupted));
+        BOOST_HANA_RUNTIME_CHECK(fails<std::vector<std::string>>(corrupted));
+        BOOST_HANA_RUNTIME_CHECK(fails<std::vector<_tuple<std::string>>>(corrupted));
+
+        // pointers are not serialized as raw addresses
+        static_assert(!experimental::serialization_detail::is_raw<char const*>{}, "");
+        static_assert(!experimental::serialization_detail::is_raw<int Record::*>{}, "");
+
+        // elements without any bytes don't make the length prefix suspicious
+        std::vector<_tuple<>> nothings(3);
+        std::string buffer_of_nothings;
+        serialize(nothings, buffer_of_nothings);
+        BOOST_HANA_RUNTIME_CHECK(buffer_of_nothings.size() == 8);
+        BOOST_HANA_RUNTIME_CHECK(
+            deserialize<std::vector<_tuple<>>>(buffer_of_nothings).size() == 3);
+        BOOST_HANA_RUNTIME_CHECK(
+            fails<std::vector<_tuple<std::vector<int>>>>(corrupted));
+        BOOST_HANA_RUNTIME_CHECK(fails<std::vector<Packed>>(corrupted));
+
+        // bools and enumerations are validated
+        static_assert(!experimental::serialization_detail::is_raw<bool>{}, "");
+        static_assert(!experimental::serialization_detail::is_raw<Color>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(deserialize<bool>(std::string(1, '\1')) == true);
+        BOOST_HANA_RUNTIME_CHECK(deserialize<bool>(std::string(1, '\0')) == false);
+        BOOST_HANA_RUNTIME_CHECK(fails<bool>(std::string(1, '\2')));
+        std::string colors;
+        serialize(make_tuple(Color::blue, true), colors);
+        BOOST_HANA_RUNTIME_CHECK(colors.size() == 2);
+        BOOST_HANA_RUNTIME_CHECK(deserialize<_tuple<Color, bool>>(colors) ==
+                                 make_tuple(Color::blue, true));
+
+        // empty things
+        std::string empty;
+        serialize(make_tuple(), empty);
+        BOOST_HANA_RUNTIME_CHECK(empty.empty());
+        serialize(std::vector<int>{}, empty);
+        BOOST_HANA_RUNTIME_CHECK(empty.size() == 8);
+        BOOST_HANA_RUNTIME_CHECK(deserialize<std::vector<int>>(empty).empty());
+    }
+
+    // nested Structs
+    {
+        Nested n{{1, 2, 3}, {{4, 5, 6}, {7, 8, 9}}, {{1, 2, '3', 4, "5"}}};
+        std::string buffer;
+        serialize(n, buffer);
+        BOOST_HANA_RUNTIME_CHECK(buffer.size() ==
+            12 + (8 + 2 * 12) + (8 + (4 + 4 + 1 + 8 + 8 + 1)));
+
+        Nested m = deserialize<Nested>(buffer);
+        BOOST_HANA_RUNTIME_CHECK(m.p.z == 3);
+        BOOST_HANA_RUNTIME_CHECK(m.ps.size() == 2 && m.ps[1].y == 8);
+        BOOST_HANA_RUNTIME_CHECK(m.rs.size() == 1 && m.rs[0].c == '3' && m.rs[0].e == "5");
+    }
+}
@@ -38,4 +38,17 @@ int main() {
     test::TestFoldable<ext::boost::fusion::Deque>{eq_deques};
     test::TestIterable<ext::boost::fusion::Deque>{eq_deques};
     test::TestTraversable<ext::boost::fusion::Deque>{};
+
+    //////////////////////////////////////////////////////////////////////////
+    // Runtime values
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto minus = [](auto x, auto y) { return x - y; };
+        BOOST_HANA_RUNTIME_CHECK(fold.left(fusion::make_deque(1, 2l, 3.0), 10, minus) == 4);
+        BOOST_HANA_RUNTIME_CHECK(fold.right(fusion::make_deque(1, 2l, 3.0), 10, minus) == -8);
+        BOOST_HANA_RUNTIME_CHECK(at_c<2>(fusion::make_deque(1, '2', 3.0)) == 3.0);
+        BOOST_HANA_RUNTIME_CHECK(
+            any_of(fusion::make_deque(1, 2, 3), [](int i) { return i == 2; })
+        );
+    }
 }
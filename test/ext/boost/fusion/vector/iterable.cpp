@@ -14,7 +14,11 @@ Distributed under the Boost Software License, Version 1.0.
 #include <laws/traversable.hpp>
 
 #include <boost/fusion/container/generation/make_vector.hpp>
+#include <boost/fusion/container/generation/vector_tie.hpp>
 #include <boost/fusion/container/vector.hpp>
+
+#include <memory>
+#include <string>
 using namespace boost::hana;
 namespace fusion = boost::fusion;
 
@@ -39,4 +43,37 @@ int main() {
     test::TestFoldable<ext::boost::fusion::Vector>{eq_vectors};
     test::TestIterable<ext::boost::fusion::Vector>{eq_vectors};
     test::TestTraversable<ext::boost::fusion::Vector>{};
+
+    //////////////////////////////////////////////////////////////////////////
+    // Runtime values and rvalue sequences
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto minus = [](auto x, auto y) { return x - y; };
+        BOOST_HANA_RUNTIME_CHECK(fold.left(fusion::make_vector(1, 2l, 3.0), 10, minus) == 4);
+        BOOST_HANA_RUNTIME_CHECK(fold.right(fusion::make_vector(1, 2l, 3.0), 10, minus) == -8);
+        BOOST_HANA_RUNTIME_CHECK(at_c<2>(fusion::make_vector(1, '2', 3.0)) == 3.0);
+        BOOST_HANA_RUNTIME_CHECK(
+            any_of(fusion::make_vector(1, 2, 3), [](int i) { return i == 2; })
+        );
+
+        // Elements of rvalue sequences are moved, not copied.
+        auto n = unpack(
+            fusion::make_vector(std::make_unique<int>(1), std::make_unique<int>(2)),
+            [](std::unique_ptr<int> a, std::unique_ptr<int> b) {
+                return *a + *b;
+            });
+        BOOST_HANA_RUNTIME_CHECK(n == 3);
+
+        // The objects referenced by a rvalue sequence of references are
+        // not moved from.
+        std::string a{"abc"}, b{"def"};
+        unpack(fusion::vector_tie(a, b), [](auto&& x, auto&& y) {
+            std::string ignore_x{static_cast<decltype(x)&&>(x)},
+                        ignore_y{static_cast<decltype(y)&&>(y)};
+        });
+        BOOST_HANA_RUNTIME_CHECK(a == "abc" && b == "def");
+
+        auto& first = at_c<0>(fusion::vector_tie(a, b));
+        BOOST_HANA_RUNTIME_CHECK(&first == &a);
+    }
 }
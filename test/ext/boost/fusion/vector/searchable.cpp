@@ -7,6 +7,7 @@ Distributed under the Boost Software License, Version 1.0.
 #define FUSION_MAX_VECTOR_SIZE 20
 #include <boost/hana/ext/boost/fusion/vector.hpp>
 
+#include <boost/hana/assert.hpp>
 #include <boost/hana/bool.hpp>
 #include <boost/hana/tuple.hpp>
 
@@ -53,4 +54,17 @@ int main() {
         );
         test::TestSearchable<ext::boost::fusion::Vector>{bools, make<Tuple>(true_, false_)};
     }
+
+    // any_of stops calling a runtime predicate once it returned true
+    {
+        int calls = 0;
+        BOOST_HANA_RUNTIME_CHECK(any_of(fusion::make_vector(1, 2, 3), [&](int i) {
+            ++calls;
+            return i == 2;
+        }));
+        BOOST_HANA_RUNTIME_CHECK(calls == 2);
+        BOOST_HANA_RUNTIME_CHECK(!any_of(fusion::make_vector(1, 2, 3), [](int i) {
+            return i == 4;
+        }));
+    }
 }
@@ -163,6 +163,18 @@ int main() {
             ));
         }
 
+        // length
+        {
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                length(mpl::vector<>{}),
+                boost::hana::size_t<0>
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                length(mpl::vector<t1, t2, t3>{}),
+                boost::hana::size_t<3>
+            ));
+        }
+
         // laws
         test::TestFoldable<ext::boost::mpl::Vector>{vectors};
     }
@@ -216,6 +228,18 @@ int main() {
             BOOST_HANA_CONSTANT_CHECK(not_(is_empty(mpl::vector2<t1, t2>{})));
         }
 
+        // at
+        {
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                at_c<0>(mpl::vector<t1, t2, t3>{}),
+                type<t1>
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                at_c<2>(mpl::vector<t1, t2, t3>{}),
+                type<t3>
+            ));
+        }
+
         // laws
         test::TestIterable<ext::boost::mpl::Vector>{vectors};
     }
@@ -13,6 +13,8 @@ Distributed under the Boost Software License, Version 1.0.
 #include <laws/traversable.hpp>
 
 #include <boost/tuple/tuple.hpp>
+
+#include <string>
 using namespace boost::hana;
 
 
@@ -36,4 +38,25 @@ int main() {
     test::TestFoldable<ext::boost::Tuple>{eq_tuples};
     test::TestIterable<ext::boost::Tuple>{eq_tuples};
     test::TestTraversable<ext::boost::Tuple>{};
+
+    //////////////////////////////////////////////////////////////////////////
+    // Runtime values
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto minus = [](auto x, auto y) { return x - y; };
+        BOOST_HANA_RUNTIME_CHECK(fold.left(::boost::make_tuple(1, 2l, 3.0), 10, minus) == 4);
+        BOOST_HANA_RUNTIME_CHECK(fold.right(::boost::make_tuple(1, 2l, 3.0), 10, minus) == -8);
+        BOOST_HANA_RUNTIME_CHECK(fold.left(::boost::make_tuple(1, 2l, 3.0), minus) == -4);
+        BOOST_HANA_RUNTIME_CHECK(fold.right(::boost::make_tuple(1, 2l, 3.0), minus) == 2);
+        BOOST_HANA_RUNTIME_CHECK(at_c<2>(::boost::make_tuple(1, '2', 3.0)) == 3.0);
+
+        // The objects referenced by a rvalue tuple of references are not
+        // moved from.
+        std::string a{"abc"}, b{"def"};
+        unpack(::boost::tie(a, b), [](auto&& x, auto&& y) {
+            std::string ignore_x{static_cast<decltype(x)&&>(x)},
+                        ignore_y{static_cast<decltype(y)&&>(y)};
+        });
+        BOOST_HANA_RUNTIME_CHECK(a == "abc" && b == "def");
+    }
 }
@@ -11,6 +11,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <laws/base.hpp>
 #include <laws/comparable.hpp>
 #include <laws/foldable.hpp>
+#include <laws/functor.hpp>
 #include <laws/iterable.hpp>
 #include <laws/orderable.hpp>
 #include <laws/searchable.hpp>
@@ -24,6 +25,22 @@ constexpr auto array() { return std::array<int, sizeof...(i)>{{i...}}; }
 
 using test::ct_eq;
 
+struct Total {
+    int const value;
+};
+
+// A state which checks that it is never move-assigned to itself.
+struct Sum {
+    int value;
+    Sum(int v) : value{v} { }
+    Sum(Sum&&) = default;
+    Sum& operator=(Sum&& other) {
+        BOOST_HANA_RUNTIME_CHECK(this != &other);
+        value = other.value;
+        return *this;
+    }
+};
+
 int main() {
     auto int_arrays = make<Tuple>(
           array<>()
@@ -112,6 +129,75 @@ int main() {
         auto eq_keys = make<Tuple>(ct_eq<0>{});
 
         test::TestSearchable<ext::std::Array>{eq_arrays, eq_keys};
+
+        // any_of with a runtime predicate
+        {
+            auto is_odd = [](int i) { return i % 2 != 0; };
+            BOOST_HANA_CONSTANT_CHECK(not_(any_of(array<>(), is_odd)));
+            BOOST_HANA_RUNTIME_CHECK(!any_of(array<0, 2, 4>(), is_odd));
+            BOOST_HANA_RUNTIME_CHECK(any_of(array<0, 1, 2>(), is_odd));
+            BOOST_HANA_RUNTIME_CHECK(all_of(array<1, 3>(), is_odd));
+        }
+    }
+
+#elif BOOST_HANA_TEST_PART == 6
+    //////////////////////////////////////////////////////////////////////////
+    // Functor
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto eq_arrays = make<Tuple>(
+              std::array<ct_eq<0>, 0>{}
+            , std::array<ct_eq<0>, 1>{}
+            , std::array<ct_eq<0>, 2>{}
+            , std::array<ct_eq<0>, 3>{}
+        );
+
+        test::TestFunctor<ext::std::Array>{eq_arrays, make<Tuple>(ct_eq<0>{})};
+
+        BOOST_HANA_RUNTIME_CHECK(
+            transform(array<0, 1, 2>(), [](int i) { return i * 0.5; })
+                == (std::array<double, 3>{{0.0, 0.5, 1.0}})
+        );
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Folds implemented as loops
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto minus = [](int x, int y) { return x - y; };
+        BOOST_HANA_RUNTIME_CHECK(fold.left(array<1, 2, 3>(), 10, minus) == 4);
+        BOOST_HANA_RUNTIME_CHECK(fold.right(array<1, 2, 3>(), 10, minus) == -8);
+        BOOST_HANA_RUNTIME_CHECK(fold.left(array<1, 2, 3>(), minus) == -4);
+        BOOST_HANA_RUNTIME_CHECK(fold.right(array<1, 2, 3>(), minus) == 2);
+        BOOST_HANA_RUNTIME_CHECK(fold.left(array<>(), 10, minus) == 10);
+        BOOST_HANA_RUNTIME_CHECK(fold.right(array<1>(), minus) == 1);
+
+        // Elements of rvalue arrays are moved into the function.
+        std::array<test::Tracked, 2> xs{{test::Tracked{1}, test::Tracked{2}}};
+        auto n = fold.left(std::move(xs), 0, [](int n, test::Tracked t) {
+            test::Tracked moved{std::move(t)}; (void)moved;
+            return n + 1;
+        });
+        BOOST_HANA_RUNTIME_CHECK(n == 2);
+
+        // States that can't be assigned are folded without a loop.
+        auto add = [](Total t, int x) { return Total{t.value + x}; };
+        auto radd = [](int x, Total t) { return Total{t.value + x}; };
+        BOOST_HANA_RUNTIME_CHECK(fold.left(array<1, 2, 3>(), Total{10}, add).value == 16);
+        BOOST_HANA_RUNTIME_CHECK(fold.right(array<1, 2, 3>(), Total{10}, radd).value == 16);
+
+        // Functions returning the state they were given don't cause the
+        // state to be move-assigned to itself.
+        auto accumulate = [](Sum&& s, int x) -> Sum&& {
+            s.value += x;
+            return static_cast<Sum&&>(s);
+        };
+        auto raccumulate = [](int x, Sum&& s) -> Sum&& {
+            s.value += x;
+            return static_cast<Sum&&>(s);
+        };
+        BOOST_HANA_RUNTIME_CHECK(fold.left(array<1, 2, 3>(), Sum{10}, accumulate).value == 16);
+        BOOST_HANA_RUNTIME_CHECK(fold.right(array<1, 2, 3>(), Sum{10}, raccumulate).value == 16);
     }
 #endif
 }
@@ -0,0 +1,106 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/ext/std/hash.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/struct.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+#include <laws/hashable.hpp>
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+using namespace boost::hana;
+
+
+struct Person {
+    std::string name;
+    int age;
+
+    struct hana {
+        struct accessors_impl {
+            static auto apply() {
+                return make_tuple(
+                    make_pair(BOOST_HANA_STRING("name"), [](auto&& p) -> decltype(auto) {
+                        return (static_cast<decltype(p)&&>(p).name);
+                    }),
+                    make_pair(BOOST_HANA_STRING("age"), [](auto&& p) -> decltype(auto) {
+                        return (static_cast<decltype(p)&&>(p).age);
+                    })
+                );
+            }
+        };
+    };
+};
+
+struct NotHashable { };
+
+int main() {
+    // types supported by std::hash are Hashable
+    {
+        static_assert(_models<Hashable, double>{}, "");
+        static_assert(_models<Hashable, std::string>{}, "");
+        static_assert(_models<Hashable, int const*>{}, "");
+        static_assert(!_models<Hashable, NotHashable>{}, "");
+
+        test::TestHashable<std::string>{make_tuple(
+            std::string{}, std::string{"abc"}, std::string{"abd"}
+        )};
+        test::TestHashable<double>{make_tuple(0.0, 1.5, -2.25)};
+
+        // arithmetic values that compare equal hash equally
+        BOOST_HANA_RUNTIME_CHECK(hash(3.0) == hash(3));
+        BOOST_HANA_RUNTIME_CHECK(hash(-3.0f) == hash(-3ll));
+        BOOST_HANA_RUNTIME_CHECK(hash(0.0) == hash(-0.0));
+        BOOST_HANA_RUNTIME_CHECK(hash(1e19) == hash(10000000000000000000ull));
+        BOOST_HANA_RUNTIME_CHECK(hash(0.5f) == hash(0.5));
+        BOOST_HANA_RUNTIME_CHECK(hash(int_<3>) == hash(3.0));
+
+        BOOST_HANA_RUNTIME_CHECK(hash(1.5) == std::hash<long double>{}(1.5L));
+        BOOST_HANA_RUNTIME_CHECK(
+            hash(std::string{"abc"}) == std::hash<std::string>{}("abc")
+        );
+
+        // Hana's own models are not overridden
+        static_assert(hash(3) == hash(int_<3>), "");
+    }
+
+    // std::hash works for Tuples and Pairs
+    {
+        auto xs = make_tuple(1, std::string{"abc"}, 2.5);
+        BOOST_HANA_RUNTIME_CHECK(std::hash<decltype(xs)>{}(xs) == hash(xs));
+
+        auto p = make_pair(std::string{"abc"}, 1);
+        BOOST_HANA_RUNTIME_CHECK(std::hash<decltype(p)>{}(p) == hash(p));
+
+        std::unordered_map<_tuple<int, std::string>, int> map;
+        map[make_tuple(1, std::string{"one"})] = 1;
+        map[make_tuple(2, std::string{"two"})] = 2;
+        map[make_tuple(1, std::string{"one"})] = 3;
+        BOOST_HANA_RUNTIME_CHECK(map.size() == 2);
+        BOOST_HANA_RUNTIME_CHECK(map[make_tuple(1, std::string{"one"})] == 3);
+        BOOST_HANA_RUNTIME_CHECK(map[make_tuple(2, std::string{"two"})] == 2);
+    }
+
+    // decltype(hash) works as the Hash parameter for Structs
+    {
+        std::unordered_set<Person, decltype(hash), decltype(equal)> people;
+        people.insert(Person{"John", 30});
+        people.insert(Person{"Jane", 25});
+        people.insert(Person{"John", 30});
+        BOOST_HANA_RUNTIME_CHECK(people.size() == 2);
+        BOOST_HANA_RUNTIME_CHECK(people.count(Person{"Jane", 25}) == 1);
+        BOOST_HANA_RUNTIME_CHECK(people.count(Person{"Jane", 26}) == 0);
+    }
+}
@@ -32,7 +32,9 @@ Distributed under the Boost Software License, Version 1.0.
 #endif
 #include <laws/sequence.hpp>
 
+#include <memory>
 #include <tuple>
+#include <type_traits>
 using namespace boost::hana;
 
 
@@ -131,6 +133,52 @@ int main() {
     test::TestIterable<ext::std::Tuple>{big_eq_tuples};
     test::TestTraversable<ext::std::Tuple>{};
 
+    //////////////////////////////////////////////////////////////////////////
+    // Runtime values and rvalue tuples
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto minus = [](auto x, auto y) { return x - y; };
+        BOOST_HANA_RUNTIME_CHECK(fold.left(std::make_tuple(1, 2l, 3.0), 10, minus) == 4);
+        BOOST_HANA_RUNTIME_CHECK(fold.right(std::make_tuple(1, 2l, 3.0), 10, minus) == -8);
+        BOOST_HANA_RUNTIME_CHECK(fold.left(std::make_tuple(1, 2l, 3.0), minus) == -4);
+        BOOST_HANA_RUNTIME_CHECK(fold.right(std::make_tuple(1, 2l, 3.0), minus) == 2);
+        BOOST_HANA_CONSTANT_CHECK(length(std::make_tuple(1, '2', 3.0)) == boost::hana::size_t<3>);
+
+        BOOST_HANA_RUNTIME_CHECK(
+            drop(std::make_tuple(1, '2', 3.0), int_<1>) == std::make_tuple('2', 3.0)
+        );
+        BOOST_HANA_RUNTIME_CHECK(
+            slice(std::make_tuple(1, '2', 3.0, 4u), int_<1>, int_<3>)
+                == std::make_tuple('2', 3.0)
+        );
+        BOOST_HANA_RUNTIME_CHECK(last(std::make_tuple(1, '2', 3.0)) == 3.0);
+
+        auto is_char = [](auto x) {
+            return bool_<std::is_same<decltype(x), char>::value>;
+        };
+        BOOST_HANA_RUNTIME_CHECK(
+            find_if(std::make_tuple(1, '2', 3.0, '4'), is_char) == just('2')
+        );
+        BOOST_HANA_CONSTANT_CHECK(
+            find_if(std::make_tuple(1, 3.0), is_char) == nothing
+        );
+        int calls = 0;
+        BOOST_HANA_RUNTIME_CHECK(
+            any_of(std::make_tuple(1, 2, 3), [&](int i) { ++calls; return i == 2; })
+        );
+        BOOST_HANA_RUNTIME_CHECK(calls == 2);
+        BOOST_HANA_CONSTANT_CHECK(any_of(std::make_tuple(1, '2', 3.0), is_char));
+        BOOST_HANA_CONSTANT_CHECK(!any_of(std::make_tuple(1, 3.0), is_char));
+
+        // Elements of rvalue tuples are moved, not copied.
+        auto n = unpack(
+            std::make_tuple(std::make_unique<int>(1), std::make_unique<int>(2)),
+            [](std::unique_ptr<int> a, std::unique_ptr<int> b) {
+                return *a + *b;
+            });
+        BOOST_HANA_RUNTIME_CHECK(n == 3);
+    }
+
 #elif BOOST_HANA_TEST_PART == 5
     //////////////////////////////////////////////////////////////////////////
     // Functor up to Monad
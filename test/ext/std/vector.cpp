@@ -14,6 +14,7 @@ Distributed under the Boost Software License, Version 1.0.
 // #include <laws/functor.hpp>
 #include <laws/orderable.hpp>
 
+#include <string>
 #include <vector>
 using namespace boost::hana;
 
@@ -43,4 +44,114 @@ int main() {
     test::TestComparable<ext::std::Vector>{eqs};
     test::TestOrderable<ext::std::Vector>{ords};
     // test::TestFunctor<ext::std::Vector>{eqs, eq_values};
+
+    //////////////////////////////////////////////////////////////////////////
+    // Functor
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto half = [](int i) { return i * 0.5; };
+        auto twice = [](int i) { return i * 2; };
+        std::vector<int> v{1, 2, 3};
+
+        BOOST_HANA_RUNTIME_CHECK(
+            transform(v, half) == (std::vector<double>{0.5, 1.0, 1.5})
+        );
+        BOOST_HANA_RUNTIME_CHECK(transform(v, twice) == (std::vector<int>{2, 4, 6}));
+        BOOST_HANA_RUNTIME_CHECK(v == (std::vector<int>{1, 2, 3}));
+
+        // rvalue vectors are reused when the type of the elements does not
+        // change
+        int const* data = v.data();
+        std::vector<int> w = transform(std::move(v), twice);
+        BOOST_HANA_RUNTIME_CHECK(w == (std::vector<int>{2, 4, 6}));
+        BOOST_HANA_RUNTIME_CHECK(w.data() == data);
+
+        BOOST_HANA_RUNTIME_CHECK(transform(std::vector<int>{}, half).empty());
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto minus = [](int x, int y) { return x - y; };
+        std::vector<int> v{1, 2, 3};
+
+        BOOST_HANA_RUNTIME_CHECK(fold.left(v, 10, minus) == 4);
+        BOOST_HANA_RUNTIME_CHECK(fold.right(v, 10, minus) == -8);
+        BOOST_HANA_RUNTIME_CHECK(fold.left(v, minus) == -4);
+        BOOST_HANA_RUNTIME_CHECK(fold.right(v, minus) == 2);
+        BOOST_HANA_RUNTIME_CHECK(fold.left(std::vector<int>{}, 10, minus) == 10);
+        BOOST_HANA_RUNTIME_CHECK(length(v) == 3);
+
+        int sum = 0;
+        for_each(v, [&](int i) { sum += i; });
+        BOOST_HANA_RUNTIME_CHECK(sum == 6);
+
+        // rvalue vectors have their elements moved into the function
+        std::vector<std::string> strings{"abc", "def"};
+        std::vector<std::string> moved;
+        for_each(std::move(strings), [&](std::string&& s) {
+            moved.push_back(std::move(s));
+        });
+        BOOST_HANA_RUNTIME_CHECK(moved == (std::vector<std::string>{"abc", "def"}));
+
+        // states that can't be assigned are supported
+        struct Total { int const value; };
+        auto add = [](Total t, int i) { return Total{t.value + i}; };
+        auto add_r = [](int i, Total t) { return Total{t.value + i}; };
+        BOOST_HANA_RUNTIME_CHECK(fold.left(v, Total{10}, add).value == 16);
+        BOOST_HANA_RUNTIME_CHECK(fold.right(v, Total{10}, add_r).value == 16);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // any_of
+    //////////////////////////////////////////////////////////////////////////
+    {
+        using ext::std::any_of;
+        static_assert(!_models<Searchable, ext::std::Vector>{}, "");
+        std::vector<int> v{1, 2, 3, 4};
+        int calls = 0;
+        BOOST_HANA_RUNTIME_CHECK(any_of(v, [&](int i) { ++calls; return i == 2; }));
+        BOOST_HANA_RUNTIME_CHECK(calls == 2);
+        BOOST_HANA_RUNTIME_CHECK(!any_of(v, [](int i) { return i > 4; }));
+        BOOST_HANA_RUNTIME_CHECK(!any_of(std::vector<int>{}, [](int) { return true; }));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // concat, filter and remove_if
+    //////////////////////////////////////////////////////////////////////////
+    {
+        using ext::std::concat;
+        using ext::std::filter;
+        using ext::std::remove_if;
+        static_assert(!_models<MonadPlus, ext::std::Vector>{}, "");
+        auto odd = [](int i) { return i % 2 != 0; };
+        std::vector<int> v{1, 2, 3, 4, 5};
+
+        BOOST_HANA_RUNTIME_CHECK(filter(v, odd) == (std::vector<int>{1, 3, 5}));
+        BOOST_HANA_RUNTIME_CHECK(remove_if(v, odd) == (std::vector<int>{2, 4}));
+        BOOST_HANA_RUNTIME_CHECK(v == (std::vector<int>{1, 2, 3, 4, 5}));
+
+        std::vector<int> w{6, 7};
+        BOOST_HANA_RUNTIME_CHECK(concat(v, w) == (std::vector<int>{1, 2, 3, 4, 5, 6, 7}));
+        BOOST_HANA_RUNTIME_CHECK(concat(std::vector<int>{}, w) == w);
+        BOOST_HANA_RUNTIME_CHECK(concat(w, std::vector<int>{}) == w);
+
+        // rvalue vectors are reused
+        std::vector<int> u = v;
+        int const* data = u.data();
+        std::vector<int> odds = filter(std::move(u), odd);
+        BOOST_HANA_RUNTIME_CHECK(odds == (std::vector<int>{1, 3, 5}));
+        BOOST_HANA_RUNTIME_CHECK(odds.data() == data);
+
+        u = v;
+        data = u.data();
+        std::vector<int> evens = remove_if(std::move(u), odd);
+        BOOST_HANA_RUNTIME_CHECK(evens == (std::vector<int>{2, 4}));
+        BOOST_HANA_RUNTIME_CHECK(evens.data() == data);
+
+        std::vector<std::string> xs{"abc"}, ys{"def", "ghi"};
+        std::vector<std::string> zs = concat(std::move(xs), std::move(ys));
+        BOOST_HANA_RUNTIME_CHECK(zs == (std::vector<std::string>{"abc", "def", "ghi"}));
+    }
 }
@@ -0,0 +1,273 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/flat_tuple.hpp>
+
+#include <boost/hana/functional/always.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/applicative.hpp>
+#include <laws/base.hpp>
+#include <laws/comparable.hpp>
+#include <laws/foldable.hpp>
+#include <laws/functor.hpp>
+#include <laws/iterable.hpp>
+#include <laws/monad.hpp>
+#include <laws/monad_plus.hpp>
+#include <laws/orderable.hpp>
+#include <laws/searchable.hpp>
+#include <laws/sequence.hpp>
+#include <laws/traversable.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+using namespace boost::hana;
+
+
+template <int i>
+using eq = test::ct_eq<i>;
+
+template <int i>
+using ord = test::ct_ord<i>;
+
+template <typename Xs, typename Member>
+std::size_t offset(Xs const& xs, Member const& member) {
+    return static_cast<std::size_t>(
+        reinterpret_cast<char const*>(&member) -
+        reinterpret_cast<char const*>(&xs)
+    );
+}
+
+struct Record {
+    std::uint8_t a;
+    std::uint32_t b;
+    double c;
+    std::uint16_t d;
+};
+
+
+int main() {
+    auto eq_tuples = make<Tuple>(
+          make<FlatTuple>()
+        , make<FlatTuple>(eq<0>{})
+        , make<FlatTuple>(eq<0>{}, eq<1>{})
+        , make<FlatTuple>(eq<0>{}, eq<1>{}, eq<2>{})
+        , make<FlatTuple>(eq<0>{}, eq<1>{}, eq<2>{}, eq<3>{})
+        , make<FlatTuple>(eq<0>{}, eq<1>{}, eq<2>{}, eq<3>{}, eq<4>{})
+        , make<FlatTuple>(eq<0>{}, eq<1>{}, eq<2>{}, eq<3>{}, eq<4>{}, eq<5>{})
+    );
+    (void)eq_tuples;
+
+    auto eq_values = make<Tuple>(eq<0>{}, eq<2>{}, eq<4>{});
+    (void)eq_values;
+
+    auto predicates = make<Tuple>(
+        equal.to(eq<0>{}), equal.to(eq<2>{}), equal.to(eq<4>{}),
+        always(true_), always(false_)
+    );
+    (void)predicates;
+
+    auto ord_tuples = make<Tuple>(
+          make<FlatTuple>()
+        , make<FlatTuple>(ord<0>{})
+        , make<FlatTuple>(ord<0>{}, ord<1>{})
+        , make<FlatTuple>(ord<0>{}, ord<1>{}, ord<2>{})
+        , make<FlatTuple>(ord<0>{}, ord<1>{}, ord<2>{}, ord<3>{})
+    );
+    (void)ord_tuples;
+
+    auto nested_eqs = make<Tuple>(
+          make<FlatTuple>()
+        , make<FlatTuple>(make<FlatTuple>(eq<0>{}))
+        , make<FlatTuple>(make<FlatTuple>(eq<0>{}), make<FlatTuple>(eq<1>{}, eq<2>{}))
+        , make<FlatTuple>(make<FlatTuple>(eq<0>{}),
+                          make<FlatTuple>(eq<1>{}, eq<2>{}),
+                          make<FlatTuple>(eq<3>{}, eq<4>{}))
+    );
+    (void)nested_eqs;
+
+#if BOOST_HANA_TEST_PART == 1
+    //////////////////////////////////////////////////////////////////////////
+    // Layout guarantees
+    //////////////////////////////////////////////////////////////////////////
+    {
+        using Flat = _flat_tuple<std::uint8_t, std::uint32_t, double, std::uint16_t>;
+        static_assert(std::is_standard_layout<Flat>{}, "");
+        static_assert(std::is_trivially_copyable<Flat>{}, "");
+        static_assert(std::is_trivially_default_constructible<Flat>{}, "");
+        static_assert(std::is_trivially_destructible<Flat>{}, "");
+        static_assert(sizeof(Flat) == sizeof(Record), "");
+        static_assert(alignof(Flat) == alignof(Record), "");
+
+        Flat xs{std::uint8_t{1}, std::uint32_t{2}, 3.0, std::uint16_t{4}};
+        BOOST_HANA_RUNTIME_CHECK(offset(xs, at_c<0>(xs)) == offsetof(Record, a));
+        BOOST_HANA_RUNTIME_CHECK(offset(xs, at_c<1>(xs)) == offsetof(Record, b));
+        BOOST_HANA_RUNTIME_CHECK(offset(xs, at_c<2>(xs)) == offsetof(Record, c));
+        BOOST_HANA_RUNTIME_CHECK(offset(xs, at_c<3>(xs)) == offsetof(Record, d));
+
+        // The object representation can be copied around.
+        Record r;
+        std::memcpy(&r, &xs, sizeof(r));
+        BOOST_HANA_RUNTIME_CHECK(r.a == 1 && r.b == 2 && r.c == 3.0 && r.d == 4);
+
+        Flat ys;
+        std::memcpy(&ys, &r, sizeof(r));
+        BOOST_HANA_RUNTIME_CHECK(xs == ys);
+
+        // Nested flat tuples are still standard-layout.
+        using Nested = _flat_tuple<_flat_tuple<int, char>, _flat_tuple<int>>;
+        static_assert(std::is_standard_layout<Nested>{}, "");
+        static_assert(std::is_trivially_copyable<Nested>{}, "");
+        static_assert(sizeof(Nested) == 3 * sizeof(int), "");
+
+        // Empty flat tuples.
+        static_assert(std::is_standard_layout<_flat_tuple<>>{}, "");
+        static_assert(std::is_trivially_copyable<_flat_tuple<>>{}, "");
+
+        // Non-trivial elements are supported, without the guarantees.
+        static_assert(!std::is_trivially_copyable<_flat_tuple<int, std::string>>{}, "");
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // More than 16 elements
+    //////////////////////////////////////////////////////////////////////////
+    {
+        using Big = _flat_tuple<
+            int, int, int, int, int, int, int, int,
+            int, int, int, int, int, int, int, int,
+            int, int, char
+        >;
+        static_assert(std::is_standard_layout<Big>{}, "");
+        static_assert(std::is_trivially_copyable<Big>{}, "");
+
+        Big xs{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 'x'};
+        BOOST_HANA_RUNTIME_CHECK(at_c<15>(xs) == 15);
+        BOOST_HANA_RUNTIME_CHECK(at_c<16>(xs) == 16);
+        BOOST_HANA_RUNTIME_CHECK(at_c<18>(xs) == 'x');
+        BOOST_HANA_RUNTIME_CHECK(offset(xs, at_c<16>(xs)) == 16 * sizeof(int));
+        BOOST_HANA_CONSTANT_CHECK(length(xs) == boost::hana::size_t<19>);
+        BOOST_HANA_RUNTIME_CHECK(
+            fold.left(xs, 0, [](int s, auto x) { return s + x; }) ==
+            (18 * 17) / 2 + 'x'
+        );
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Construction, assignment and operators
+    //////////////////////////////////////////////////////////////////////////
+    {
+        constexpr _flat_tuple<int, char, double> xs{1, 'a', 2.5};
+        static_assert(at_c<0>(xs) == 1, "");
+        static_assert(at_c<1>(xs) == 'a', "");
+        static_assert(xs[boost::hana::size_t<2>] == 2.5, "");
+
+        constexpr _flat_tuple<int, char> zeros{};
+        static_assert(zeros == make<FlatTuple>(0, '\0'), "");
+
+        static_assert(make<FlatTuple>(1, 2) == make<FlatTuple>(1, 2), "");
+        static_assert(make<FlatTuple>(1, 2) != make<FlatTuple>(1, 3), "");
+        static_assert(make<FlatTuple>(1, 2) < make<FlatTuple>(1, 3), "");
+        static_assert(make<FlatTuple>(1, 2) <= make<FlatTuple>(1, 2), "");
+        static_assert(make<FlatTuple>(1, 3) > make<FlatTuple>(1, 2), "");
+        static_assert(make<FlatTuple>(1, 3) >= make<FlatTuple>(1, 3), "");
+        static_assert(make<FlatTuple>(1, 2) == make<FlatTuple>(1l, 2l), "");
+        static_assert(equal(make<FlatTuple>(1, 2), make<Tuple>(1, 2)), "");
+
+        static_assert(!std::is_constructible<_flat_tuple<int, int>, int>{}, "");
+        static_assert(!std::is_constructible<_flat_tuple<int>, std::string>{}, "");
+        static_assert(std::is_convertible<_flat_tuple<int>&, _flat_tuple<int>>{}, "");
+
+        _flat_tuple<std::string, int> ys{"abc", 1};
+        _flat_tuple<std::string, int> zs = ys;
+        BOOST_HANA_RUNTIME_CHECK(zs == ys);
+        zs = make<FlatTuple>(std::string{"def"}, 2);
+        BOOST_HANA_RUNTIME_CHECK(at_c<0>(zs) == "def" && at_c<1>(zs) == 2);
+        at_c<1>(zs) = 3;
+        BOOST_HANA_RUNTIME_CHECK(zs[boost::hana::size_t<1>] == 3);
+
+        auto moved = std::move(zs);
+        BOOST_HANA_RUNTIME_CHECK(at_c<0>(moved) == "def");
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Move-only friendliness and reference semantics
+    //////////////////////////////////////////////////////////////////////////
+    {
+        {
+            auto xs = make<FlatTuple>(test::move_only{});
+            auto by_val = [](auto) { };
+
+            by_val(std::move(xs));
+            by_val(head(std::move(xs)));
+            by_val(at_c<0>(std::move(xs)));
+            by_val(last(std::move(xs)));
+        }
+
+        {
+            auto const& xs = make<FlatTuple>(test::move_only{});
+            auto by_const_ref = [](auto const&) { };
+
+            by_const_ref(xs);
+            by_const_ref(head(xs));
+            by_const_ref(at_c<0>(xs));
+            by_const_ref(last(xs));
+        }
+
+        {
+            auto xs = make<FlatTuple>(test::move_only{});
+            auto by_ref = [](auto&) { };
+
+            by_ref(xs);
+            by_ref(head(xs));
+            by_ref(at_c<0>(xs));
+            by_ref(last(xs));
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Comparable and Orderable
+    //////////////////////////////////////////////////////////////////////////
+    {
+        test::TestComparable<FlatTuple>{eq_tuples};
+        test::TestOrderable<FlatTuple>{ord_tuples};
+    }
+
+#elif BOOST_HANA_TEST_PART == 2
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable, Iterable, Searchable and Traversable
+    //////////////////////////////////////////////////////////////////////////
+    {
+        test::TestFoldable<FlatTuple>{eq_tuples};
+        test::TestIterable<FlatTuple>{eq_tuples};
+        test::TestSearchable<FlatTuple>{eq_tuples, make<Tuple>(eq<3>{}, eq<6>{})};
+        test::TestTraversable<FlatTuple>{};
+    }
+
+#elif BOOST_HANA_TEST_PART == 3
+    //////////////////////////////////////////////////////////////////////////
+    // Sequence
+    //////////////////////////////////////////////////////////////////////////
+    {
+        test::TestSequence<FlatTuple>{};
+    }
+
+#elif BOOST_HANA_TEST_PART == 4
+    //////////////////////////////////////////////////////////////////////////
+    // Functor, Applicative, Monad and MonadPlus
+    //////////////////////////////////////////////////////////////////////////
+    {
+        test::TestFunctor<FlatTuple>{eq_tuples, eq_values};
+        test::TestApplicative<FlatTuple>{eq_tuples};
+        test::TestMonad<FlatTuple>{eq_tuples, nested_eqs};
+        test::TestMonadPlus<FlatTuple>{eq_tuples, predicates, eq_values};
+    }
+#endif
+}
@@ -0,0 +1,240 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/detail/struct_layout.hpp>
+#include <boost/hana/hashable.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/struct.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <laws/base.hpp>
+#include <laws/hashable.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+using namespace boost::hana;
+
+
+#define ACCESSOR(NAME)                                                      \
+    make_pair(BOOST_HANA_STRING(#NAME), [](auto&& s) -> decltype(auto) {    \
+        return (static_cast<decltype(s)&&>(s).NAME);                        \
+    })                                                                      \
+/**/
+
+#define OFFSET(TYPE, NAME) boost::hana::size_t<offsetof(TYPE, NAME)>
+
+enum class Color { red, green, blue };
+
+struct Inner {
+    int x;
+    Color y;
+
+    struct hana {
+        struct accessors_impl {
+            static auto apply()
+            { return make_tuple(ACCESSOR(x), ACCESSOR(y)); }
+        };
+    };
+};
+
+// a, b and c are hashed as a single block, but d is hashed on its own
+// because of the padding before it, and e because it is a Struct.
+struct Record {
+    int a;
+    short b;
+    short c;
+    char d_pad;
+    long long d;
+    Inner e;
+
+    struct hana {
+        struct accessors_impl {
+            static auto apply() {
+                return make_tuple(ACCESSOR(a), ACCESSOR(b), ACCESSOR(c),
+                                  ACCESSOR(d), ACCESSOR(e));
+            }
+
+            static auto member_offsets() {
+                return [](auto) {
+                    return make_tuple(OFFSET(Record, a), OFFSET(Record, b),
+                                      OFFSET(Record, c), OFFSET(Record, d),
+                                      OFFSET(Record, e));
+                };
+            }
+        };
+    };
+};
+
+// Same as Record, but the offsets of the members are unknown.
+struct Opaque {
+    int a;
+    short b;
+    short c;
+    char d_pad;
+    long long d;
+    Inner e;
+
+    struct hana {
+        struct accessors_impl {
+            static auto apply() {
+                return make_tuple(ACCESSOR(a), ACCESSOR(b), ACCESSOR(c),
+                                  ACCESSOR(d), ACCESSOR(e));
+            }
+        };
+    };
+};
+
+struct Padded {
+    char c;
+    int i;
+
+    struct hana {
+        struct accessors_impl {
+            static auto apply()
+            { return make_tuple(ACCESSOR(c), ACCESSOR(i)); }
+
+            static auto member_offsets() {
+                return [](auto) {
+                    return make_tuple(OFFSET(Padded, c), OFFSET(Padded, i));
+                };
+            }
+        };
+    };
+};
+
+template <typename S>
+using hash_layout = detail::struct_layout_of<S, hash_detail::is_bytewise>;
+
+int main() {
+    // laws
+    {
+        test::TestHashable<int>{make_tuple(0, 1, 2, -3)};
+        test::TestHashable<Color>{make_tuple(Color::red, Color::green, Color::blue)};
+        test::TestHashable<IntegralConstant<int>>{make_tuple(
+            int_<0>, int_<1>, int_<2>
+        )};
+        test::TestHashable<Tuple>{make_tuple(
+            make_tuple(), make_tuple(1), make_tuple(1, 2),
+            make_tuple(int_<1>, 2), make_tuple(2, 1)
+        )};
+        test::TestHashable<Pair>{make_tuple(
+            make_pair(1, 2), make_pair(int_<1>, 2), make_pair(2, 1)
+        )};
+        test::TestHashable<String>{make_tuple(
+            string<>, string<'a'>, string<'a', 'b'>, string<'b', 'a'>
+        )};
+        test::TestHashable<Type>{make_tuple(
+            type<void>, type<int>, type<int const>, type<Record>
+        )};
+    }
+
+    // integral types and enumerations
+    {
+        static_assert(hash(3) == hash(3l), "");
+        static_assert(hash(3) == hash(3u), "");
+        static_assert(hash(true) == hash(1), "");
+        static_assert(hash(3) != hash(4), "");
+        static_assert(-1 == 0xFFFFFFFFu && hash(-1) == hash(0xFFFFFFFFu), "");
+        static_assert(-1 == 0xFFFFFFFFFFFFFFFFull &&
+                      hash(-1) == hash(0xFFFFFFFFFFFFFFFFull), "");
+        static_assert(hash(-1) == hash(-1ll), "");
+        static_assert(hash(-1ll) != hash(-2ll), "");
+        static_assert(hash(1ll << 40) != hash(0), "");
+        static_assert(hash(Color::red) != hash(Color::green), "");
+    }
+
+    // Constants are hashed at compile-time, like their value
+    {
+        static_assert(hash(int_<3>) == hash(3), "");
+        static_assert(hash(bool_<true>) == hash(true), "");
+        static_assert(hash(boost::hana::size_t<3>) == hash(3), "");
+    }
+
+    // Sequences and Products
+    {
+        static_assert(hash(make_tuple()) != hash(make_tuple(0)), "");
+        static_assert(hash(make_tuple(1, 2)) != hash(make_tuple(2, 1)), "");
+        static_assert(hash(make_tuple(1, 2)) == hash(make_tuple(int_<1>, 2)), "");
+        static_assert(hash(make_tuple(1, make_tuple(2, 3))) ==
+                      hash(make_tuple(1, make_tuple(int_<2>, int_<3>))), "");
+        static_assert(hash(make_pair(1, 2)) != hash(make_pair(2, 1)), "");
+        static_assert(hash(make_pair(1, 2)) == hash(make_pair(1, int_<2>)), "");
+    }
+
+    // Strings
+    {
+        static_assert(hash(string<>) != hash(string<'\0'>), "");
+        static_assert(hash(string<'a', 'b'>) != hash(string<'b', 'a'>), "");
+        static_assert(hash(string<'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i'>) !=
+                      hash(string<'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'j'>), "");
+    }
+
+    // Types
+    {
+        static_assert(hash(type<int>) == hash(type<int>), "");
+        static_assert(hash(type<int>) != hash(type<int const>), "");
+        static_assert(hash(type<int>) != hash(type<Record>), "");
+        static_assert(
+            hash(make_tuple(type<int>, type<char>)) ==
+            hash(make_tuple(type<int>, type<char>))
+        , "");
+    }
+
+    // Structs
+    {
+        static_assert(hash_layout<Record>::run_end(0) == 3, ""); // a, b, c
+        static_assert(hash_layout<Record>::run_end(1) == 1, "");
+        static_assert(hash_layout<Record>::run_end(2) == 2, "");
+        static_assert(hash_layout<Record>::run_end(3) == 4, ""); // d (padding before)
+        static_assert(hash_layout<Record>::run_end(4) == 5, ""); // e (a Struct)
+        static_assert(hash_layout<Record>::run_bytes(0) == 8, "");
+        static_assert(hash_layout<Opaque>::run_end(0) == 1, "");
+        static_assert(hash_layout<Opaque>::run_end(1) == 2, "");
+
+        Record r{1, 2, 3, 0, 4, Inner{5, Color::blue}};
+        Record same{1, 2, 3, 9, 4, Inner{5, Color::blue}};
+        BOOST_HANA_RUNTIME_CHECK(hash(r) == hash(same));
+
+        Record diffs[] = {
+            {0, 2, 3, 0, 4, Inner{5, Color::blue}},
+            {1, 0, 3, 0, 4, Inner{5, Color::blue}},
+            {1, 2, 0, 0, 4, Inner{5, Color::blue}},
+            {1, 2, 3, 0, 0, Inner{5, Color::blue}},
+            {1, 2, 3, 0, 4, Inner{0, Color::blue}},
+            {1, 2, 3, 0, 4, Inner{5, Color::red}}
+        };
+        for (Record const& d : diffs)
+            BOOST_HANA_RUNTIME_CHECK(hash(r) != hash(d));
+
+        Opaque o{1, 2, 3, 0, 4, Inner{5, Color::blue}};
+        Opaque o_same{1, 2, 3, 7, 4, Inner{5, Color::blue}};
+        BOOST_HANA_RUNTIME_CHECK(hash(o) == hash(o_same));
+        BOOST_HANA_RUNTIME_CHECK(hash(o) != hash(Opaque{
+            1, 2, 3, 0, 5, Inner{5, Color::blue}
+        }));
+    }
+
+    // The padding of a Struct does not contribute to its hash
+    {
+        static_assert(hash_layout<Padded>::run_end(0) == 1, "");
+        static_assert(hash_layout<Padded>::run_end(1) == 2, "");
+
+        alignas(Padded) unsigned char zeros[sizeof(Padded)];
+        alignas(Padded) unsigned char ones[sizeof(Padded)];
+        std::memset(zeros, 0x00, sizeof(Padded));
+        std::memset(ones, 0xff, sizeof(Padded));
+        Padded* x = ::new (static_cast<void*>(zeros)) Padded;
+        Padded* y = ::new (static_cast<void*>(ones)) Padded;
+        x->c = y->c = 'x';
+        x->i = y->i = 42;
+        BOOST_HANA_RUNTIME_CHECK(hash(*x) == hash(*y));
+    }
+}
@@ -0,0 +1,60 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_TEST_LAWS_HASHABLE_HPP
+#define BOOST_HANA_TEST_LAWS_HASHABLE_HPP
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/comparable.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/core/when.hpp>
+#include <boost/hana/hashable.hpp>
+
+#include <laws/base.hpp>
+
+
+namespace boost { namespace hana { namespace test {
+    template <typename T, typename = when<true>>
+    struct TestHashable : TestHashable<T, laws> {
+        using TestHashable<T, laws>::TestHashable;
+    };
+
+    template <typename T>
+    struct TestHashable<T, laws> {
+        static_assert(_models<Hashable, T>{}, "");
+
+        template <typename Xs>
+        TestHashable(Xs xs) {
+            foreach2(xs, [](auto a, auto b) {
+
+                // equal objects have equal hashes
+                BOOST_HANA_CHECK(
+                    hana::equal(a, b) ^implies^
+                        (hana::hash(a) == hana::hash(b))
+                );
+
+            });
+        }
+    };
+
+    template <typename C>
+    struct TestHashable<C, when<_models<Constant, C>{}()>>
+        : TestHashable<C, laws>
+    {
+        template <typename Xs>
+        TestHashable(Xs xs) : TestHashable<C, laws>{xs} {
+            foreach(xs, [](auto c) {
+
+                BOOST_HANA_CHECK(
+                    hana::hash(c) == hana::hash(hana::value(c))
+                );
+
+            });
+        }
+    };
+}}} // end namespace boost::hana::test
+
+#endif // !BOOST_HANA_TEST_LAWS_HASHABLE_HPP
@@ -151,6 +151,36 @@ int main() {
                 decltype(expr) explicit_copy(expr); (void)explicit_copy;
             }
         }
+
+        // lazy_ref
+        {
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                eval(lazy_ref(ct_eq<0>{})),
+                ct_eq<0>{}
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                eval(lazy_ref(f)(ct_eq<3>{}, ct_eq<4>{})),
+                f(ct_eq<3>{}, ct_eq<4>{})
+            ));
+
+            // The referenced objects are neither copied nor moved.
+            {
+                int x = 0;
+                BOOST_HANA_RUNTIME_CHECK(&eval(lazy_ref(x)) == &x);
+
+                auto id_ = [](auto&& y) -> decltype(auto) {
+                    return static_cast<decltype(y)&&>(y);
+                };
+                BOOST_HANA_RUNTIME_CHECK(&eval(lazy_ref(id_)(x)) == &x);
+            }
+
+            // Rvalues are forwarded as rvalues.
+            {
+                test::Tracked x{1};
+                auto y = eval(lazy_ref(static_cast<test::Tracked&&>(x)));
+                (void)y;
+            }
+        }
     }
 
     //////////////////////////////////////////////////////////////////////////
@@ -8,9 +8,13 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/assert.hpp>
 #include <boost/hana/core/operators.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/maybe.hpp>
 #include <boost/hana/pair.hpp>
+#include <boost/hana/set.hpp>
+#include <boost/hana/string.hpp>
 #include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
 
 #include <laws/base.hpp>
 #include <laws/comparable.hpp>
@@ -477,5 +481,154 @@ int main() {
 
     // laws
     test::TestFoldable<Map>{eq_maps};
+#elif BOOST_HANA_TEST_PART == 8
+    //////////////////////////////////////////////////////////////////////////
+    // erase_keys
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            erase_keys(make<Map>(), list()),
+            make<Map>()
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            erase_keys(make<Map>(), list(undefined{})),
+            make<Map>()
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            erase_keys(make<Map>(p<1, 1>()), list()),
+            make<Map>(p<1, 1>())
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            erase_keys(make<Map>(p<1, 1>()), list(key<1>())),
+            make<Map>()
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            erase_keys(make<Map>(p<1, 1>(), p<2, 2>(), p<3, 3>()),
+                       list(key<3>(), key<4>(), key<1>())),
+            make<Map>(p<2, 2>())
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            erase_keys(make<Map>(p<1, 1>(), p<2, 2>(), p<3, 3>()),
+                       make<Set>(key<2>())),
+            make<Map>(p<1, 1>(), p<3, 3>())
+        ));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // union_
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            union_(make<Map>(), make<Map>()),
+            make<Map>()
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            union_(make<Map>(p<1, 1>()), make<Map>()),
+            make<Map>(p<1, 1>())
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            union_(make<Map>(), make<Map>(p<1, 1>())),
+            make<Map>(p<1, 1>())
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            union_(make<Map>(p<1, 1>()), make<Map>(p<1, 2>())),
+            make<Map>(p<1, 2>())
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            union_(make<Map>(p<1, 1>(), p<2, 2>()),
+                   make<Map>(p<3, 3>(), p<2, 4>())),
+            make<Map>(p<1, 1>(), p<2, 4>(), p<3, 3>())
+        ));
+
+        // with a conflict policy
+        auto first_value = [](auto x, auto) { return x; };
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            union_(make<Map>(p<1, 1>(), p<2, 2>()),
+                   make<Map>(p<3, 3>(), p<2, 4>()),
+                   first_value),
+            make<Map>(p<1, 1>(), p<2, 2>(), p<3, 3>())
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            union_(make<Map>(p<1, 1>()), make<Map>(p<2, 2>()), undefined{}),
+            make<Map>(p<1, 1>(), p<2, 2>())
+        ));
+
+        BOOST_HANA_RUNTIME_CHECK(equal(
+            union_(make<Map>(make_pair(int_<1>, 1), make_pair(type<int>, 2)),
+                   make<Map>(make_pair(long_<1>, 3), make_pair(type<void>, 4)),
+                   [](int x, int y) { return x + y; }),
+            make<Map>(make_pair(int_<1>, 4), make_pair(type<int>, 2),
+                      make_pair(type<void>, 4))
+        ));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Constant-time lookup of Types, IntegralConstants and Strings
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto m = make<Map>(
+            make_pair(type<int>, 1),
+            make_pair(int_<1>, 2),
+            make_pair(BOOST_HANA_STRING("abc"), 3)
+        );
+
+        BOOST_HANA_CONSTANT_CHECK(contains(m, type<int>));
+        BOOST_HANA_CONSTANT_CHECK(contains(m, long_<1>));
+        BOOST_HANA_CONSTANT_CHECK(contains(m, BOOST_HANA_STRING("abc")));
+        BOOST_HANA_CONSTANT_CHECK(not_(contains(m, type<char>)));
+        BOOST_HANA_CONSTANT_CHECK(not_(contains(m, int_<2>)));
+
+        BOOST_HANA_RUNTIME_CHECK(equal(find(m, type<int>), just(1)));
+        BOOST_HANA_RUNTIME_CHECK(equal(find(m, long_<1>), just(2)));
+        BOOST_HANA_CONSTANT_CHECK(equal(find(m, type<char>), nothing));
+
+        BOOST_HANA_RUNTIME_CHECK(equal(m, make<Map>(
+            make_pair(BOOST_HANA_STRING("abc"), 3),
+            make_pair(long_<1>, 2),
+            make_pair(type<int>, 1)
+        )));
+        BOOST_HANA_RUNTIME_CHECK(not_(equal(m, make<Map>(
+            make_pair(BOOST_HANA_STRING("abc"), 3),
+            make_pair(long_<1>, 9),
+            make_pair(type<int>, 1)
+        ))));
+        BOOST_HANA_CONSTANT_CHECK(not_(equal(m, make<Map>(
+            make_pair(BOOST_HANA_STRING("abc"), 3),
+            make_pair(long_<2>, 2),
+            make_pair(type<int>, 1)
+        ))));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // keys and values copy the contents of lvalue maps
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto m = make<Map>(make_pair(type<int>, 1), make_pair(type<char>, 2));
+
+        auto vs = values(m);
+        at_c<0>(vs) = 3;
+        BOOST_HANA_RUNTIME_CHECK(equal(find(m, type<int>), just(1)));
+
+        auto ks = keys(make<Map>(make_pair(1, 2)));
+        BOOST_HANA_RUNTIME_CHECK(equal(ks, list(1)));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // keys_view and values_view refer to the contents of lvalue maps
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto m = make<Map>(make_pair(type<int>, 1), make_pair(type<char>, 2));
+
+        auto vs = values_view(m);
+        at_c<0>(vs) = 3;
+        BOOST_HANA_RUNTIME_CHECK(equal(find(m, type<int>), just(3)));
+
+        auto const& cm = m;
+        BOOST_HANA_RUNTIME_CHECK(&at_c<1>(values_view(cm)) == &at_c<1>(cm.storage).second);
+        BOOST_HANA_RUNTIME_CHECK(&at_c<1>(keys_view(cm)) == &at_c<1>(cm.storage).first);
+
+        auto moved = values_view(make<Map>(make_pair(type<int>, 4)));
+        BOOST_HANA_RUNTIME_CHECK(equal(moved, list(4)));
+    }
 #endif
 }
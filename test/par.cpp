@@ -0,0 +1,419 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/par.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/core/datatype.hpp>
+#include <boost/hana/functional/overload.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/lazy.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/monoid.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+using namespace boost::hana;
+
+
+// Returns the message of each exception reported by a `parallel_error`, and
+// an empty string for the tasks that did not throw.
+std::vector<std::string> messages(parallel_error const& e) {
+    std::vector<std::string> whats;
+    for (std::exception_ptr const& error : e.exceptions()) {
+        try {
+            if (error)
+                std::rethrow_exception(error);
+            whats.push_back("");
+        } catch (std::runtime_error const& e) {
+            whats.push_back(e.what());
+        }
+    }
+    return whats;
+}
+
+// A Monoid whose `plus` is associative but not commutative; combining two
+// intervals only makes sense when they are adjacent, which lets us check
+// that partial results are combined in the right order.
+struct interval {
+    int first, last;
+    bool valid;
+};
+
+struct Interval;
+namespace boost { namespace hana {
+    template <>
+    struct datatype<interval> { using type = Interval; };
+
+    template <>
+    struct plus_impl<Interval, Interval> {
+        static interval apply(interval x, interval y) {
+            if (x.first == x.last) return y;
+            if (y.first == y.last) return x;
+            return {x.first, y.last, x.valid && y.valid && x.last == y.first};
+        }
+    };
+
+    template <>
+    struct zero_impl<Interval> {
+        static interval apply() { return {0, 0, true}; }
+    };
+}}
+
+struct no_default {
+    explicit no_default(int v) : value{v} { }
+    int value;
+};
+
+int main() {
+    std::vector<int> ints(10000);
+    for (std::size_t i = 0; i < ints.size(); ++i)
+        ints[i] = static_cast<int>(i);
+
+    //////////////////////////////////////////////////////////////////////////
+    // transform
+    //////////////////////////////////////////////////////////////////////////
+    {
+        // std::vector
+        {
+            std::vector<double> halves = transform(par(16), ints, [](int i) {
+                return i * 0.5;
+            });
+            BOOST_HANA_RUNTIME_CHECK(halves.size() == ints.size());
+            for (std::size_t i = 0; i < ints.size(); ++i)
+                BOOST_HANA_RUNTIME_CHECK(halves[i] == ints[i] * 0.5);
+
+            std::vector<no_default> wrapped = transform(par(16), ints, [](int i) {
+                return no_default{i};
+            });
+            BOOST_HANA_RUNTIME_CHECK(wrapped.size() == ints.size());
+            for (std::size_t i = 0; i < ints.size(); ++i)
+                BOOST_HANA_RUNTIME_CHECK(wrapped[i].value == ints[i]);
+
+            BOOST_HANA_RUNTIME_CHECK(
+                transform(par, std::vector<int>{}, [](int i) { return i; }).empty()
+            );
+
+            // elements of temporary vectors are moved
+            std::vector<std::string> strings(100, "a string long enough to be allocated");
+            std::vector<std::size_t> sizes = transform(par(1), std::move(strings),
+            [](std::string&& s) {
+                std::string stolen = std::move(s);
+                return stolen.size();
+            });
+            for (std::size_t i = 0; i < sizes.size(); ++i) {
+                BOOST_HANA_RUNTIME_CHECK(sizes[i] == 36);
+                BOOST_HANA_RUNTIME_CHECK(strings[i].empty());
+            }
+        }
+
+        // std::array
+        {
+            std::array<int, 5> a{{1, 2, 3, 4, 5}};
+            std::array<no_default, 5> b = transform(par(1), a, [](int i) {
+                return no_default{i * 2};
+            });
+            for (std::size_t i = 0; i < a.size(); ++i)
+                BOOST_HANA_RUNTIME_CHECK(b[i].value == a[i] * 2);
+
+            std::array<int, 0> empty{};
+            std::array<double, 0> result = transform(par, empty, [](int i) {
+                return i * 0.5;
+            });
+            (void)result;
+        }
+
+        // Tuple
+        {
+            auto xs = make<Tuple>(1, 2, 3, 4);
+            BOOST_HANA_RUNTIME_CHECK(
+                transform(par(1), xs, [](int i) { return i * 0.5; })
+                    ==
+                make<Tuple>(0.5, 1.0, 1.5, 2.0)
+            );
+            BOOST_HANA_RUNTIME_CHECK(
+                transform(par(1), make<Tuple>(std::string{"ab"}, std::string{"c"}),
+                          [](std::string&& s) { return std::move(s) + "!"; })
+                    ==
+                make<Tuple>(std::string{"ab!"}, std::string{"c!"})
+            );
+            BOOST_HANA_CONSTANT_CHECK(
+                transform(par, make<Tuple>(), [](int i) { return i; }) == make<Tuple>()
+            );
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // for_each
+    //////////////////////////////////////////////////////////////////////////
+    {
+        std::atomic<long> total{0};
+        for_each(par(16), ints, [&](int i) { total += i; });
+        BOOST_HANA_RUNTIME_CHECK(total == 9999L * 10000 / 2);
+
+        std::vector<int> visited(ints.size(), 0);
+        for_each(par(16), ints, [&](int i) { ++visited[i]; });
+        for (int v : visited)
+            BOOST_HANA_RUNTIME_CHECK(v == 1);
+
+        total = 0;
+        for_each(par(1), make<Tuple>(1, 2, 3), [&](int i) { total += i; });
+        BOOST_HANA_RUNTIME_CHECK(total == 6);
+
+        for_each(par, make<Tuple>(), [](int) { });
+        for_each(par, std::vector<int>{}, [](int) { });
+
+        // the first exception is propagated to the caller
+        bool thrown = false;
+        try {
+            for_each(par(16), ints, [](int i) {
+                if (i == 5000)
+                    throw std::runtime_error{"5000"};
+            });
+        } catch (std::runtime_error const& e) {
+            thrown = std::string{e.what()} == "5000";
+        }
+        BOOST_HANA_RUNTIME_CHECK(thrown);
+
+        // parallel algorithms may be nested
+        total = 0;
+        for_each(par(1), std::vector<int>(64, 0), [&](int) {
+            total += sum<>(par(16), ints);
+        });
+        BOOST_HANA_RUNTIME_CHECK(total == 64 * (9999L * 10000 / 2));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // sum and product
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_RUNTIME_CHECK(sum<>(par, ints) == 9999 * 10000 / 2);
+        BOOST_HANA_RUNTIME_CHECK(sum<>(par(16), ints) == 9999 * 10000 / 2);
+        BOOST_HANA_RUNTIME_CHECK(sum<>(par(1), make<Tuple>(1, 2, 3)) == 6);
+        BOOST_HANA_RUNTIME_CHECK(sum<>(par, std::vector<int>{}) == 0);
+        BOOST_HANA_CONSTANT_CHECK(sum<>(par, make<Tuple>()) == int_<0>);
+
+        std::array<long, 6> a{{1, 2, 3, 4, 5, 6}};
+        BOOST_HANA_RUNTIME_CHECK(product<>(par(1), a) == 720);
+        BOOST_HANA_RUNTIME_CHECK(product<>(par, a) == 720);
+        BOOST_HANA_RUNTIME_CHECK(product<>(par, std::vector<int>{}) == 1);
+
+        // partial results are combined in order
+        std::vector<interval> intervals;
+        for (int i = 0; i < 10000; ++i)
+            intervals.push_back({i, i + 1, true});
+        interval all = sum<Interval>(par(16), intervals);
+        BOOST_HANA_RUNTIME_CHECK(all.valid && all.first == 0 && all.last == 10000);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // count_if and any_of
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto even = [](int i) { return i % 2 == 0; };
+        BOOST_HANA_RUNTIME_CHECK(count_if(par(16), ints, even) == 5000);
+        BOOST_HANA_RUNTIME_CHECK(count_if(par, ints, even) == 5000);
+        BOOST_HANA_RUNTIME_CHECK(count_if(par(1), make<Tuple>(1, 2, 3, 4), even) == 2);
+        BOOST_HANA_RUNTIME_CHECK(count_if(par, make<Tuple>(), even) == 0);
+
+        BOOST_HANA_RUNTIME_CHECK(any_of(par(16), ints, [](int i) { return i == 9999; }));
+        BOOST_HANA_RUNTIME_CHECK(!any_of(par(16), ints, [](int i) { return i < 0; }));
+        BOOST_HANA_RUNTIME_CHECK(any_of(par(1), make<Tuple>(1, 2, 3), even));
+        BOOST_HANA_RUNTIME_CHECK(!any_of(par, std::vector<int>{}, even));
+        BOOST_HANA_RUNTIME_CHECK(!any_of(par, make<Tuple>(), even));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // for_each_parallel and transform_parallel
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto xs = make<Tuple>(1, 2.5, std::string{"abc"}, no_default{4});
+        auto describe = overload(
+            [](int i) { return std::to_string(i); },
+            [](double d) { return d * 2; },
+            [](std::string const& s) { return s + s; },
+            [](no_default const& n) { return no_default{n.value + 1}; }
+        );
+
+        // results are gathered in order, with their own types
+        auto ys = transform_parallel(xs, describe);
+        BOOST_HANA_RUNTIME_CHECK(at_c<0>(ys) == "1");
+        BOOST_HANA_RUNTIME_CHECK(at_c<1>(ys) == 5.0);
+        BOOST_HANA_RUNTIME_CHECK(at_c<2>(ys) == "abcabc");
+        BOOST_HANA_RUNTIME_CHECK(at_c<3>(ys).value == 5);
+
+        BOOST_HANA_CONSTANT_CHECK(
+            transform_parallel(make<Tuple>(), describe) == make<Tuple>()
+        );
+
+        // elements of temporary structures are forwarded as rvalues
+        auto moved = transform_parallel(
+            make<Tuple>(std::string{"a string long enough to be allocated"}, 1),
+            overload(
+                [](std::string&& s) { return std::move(s); },
+                [](int i) { return i; }
+            )
+        );
+        BOOST_HANA_RUNTIME_CHECK(at_c<0>(moved) == "a string long enough to be allocated");
+
+        std::atomic<int> visited{0};
+        for_each_parallel(xs, [&](auto const&) { ++visited; });
+        BOOST_HANA_RUNTIME_CHECK(visited == 4);
+        for_each_parallel(make<Tuple>(), [](auto const&) { });
+
+        // every element is processed, and the exception of a single failing
+        // element is also reported through a parallel_error
+        visited = 0;
+        std::vector<std::string> single;
+        try {
+            for_each_parallel(make<Tuple>(0, 1, 2, 3), [&](int i) {
+                ++visited;
+                if (i == 2)
+                    throw std::runtime_error{std::to_string(i)};
+            });
+        } catch (parallel_error const& e) {
+            single = messages(e);
+        }
+        BOOST_HANA_RUNTIME_CHECK(single == (std::vector<std::string>{"", "", "2", ""}));
+        BOOST_HANA_RUNTIME_CHECK(visited == 4);
+
+        // when several elements fail, all the exceptions are reported
+        visited = 0;
+        std::vector<std::string> whats;
+        try {
+            transform_parallel(make<Tuple>(0, 1, 2, 3), [&](int i) {
+                ++visited;
+                if (i == 1 || i == 3)
+                    throw std::runtime_error{std::to_string(i)};
+                return i;
+            });
+        } catch (parallel_error const& e) {
+            whats = messages(e);
+        }
+        BOOST_HANA_RUNTIME_CHECK(whats == (std::vector<std::string>{"", "1", "", "3"}));
+        BOOST_HANA_RUNTIME_CHECK(visited == 4);
+
+        // tasks may use the parallel algorithms themselves
+        auto nested = transform_parallel(make<Tuple>(ints, 'x'), overload(
+            [](std::vector<int> const& v) { return sum<>(par(16), v); },
+            [](char c) { return c; }
+        ));
+        BOOST_HANA_RUNTIME_CHECK(nested == make<Tuple>(9999 * 10000 / 2, 'x'));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // eval_parallel
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto twice = [](auto x) { return x + x; };
+
+        // flat structures
+        {
+            BOOST_HANA_RUNTIME_CHECK(
+                eval_parallel(make<Tuple>(lazy(twice)(1), lazy(twice)(std::string{"a"}), lazy(3.5)))
+                    ==
+                make<Tuple>(2, std::string{"aa"}, 3.5)
+            );
+            BOOST_HANA_CONSTANT_CHECK(eval_parallel(make<Tuple>()) == make<Tuple>());
+        }
+
+        // graphs
+        {
+            // Each stage records its position in the sequence of completed
+            // stages, which lets us check that prerequisites came first.
+            std::atomic<int> clock{0};
+            auto stage = [&](int id) {
+                return lazy([&clock, id] {
+                    std::this_thread::yield();
+                    return std::make_pair(id, clock++);
+                })();
+            };
+            auto at = [](auto const& results, auto key) {
+                return results[key].second;
+            };
+
+            /*
+                  0
+                 / \
+                1   2     4
+                 \ /
+                  3
+            */
+            auto stages = make<Map>(
+                make<Pair>(int_<3>, stage(3)),
+                make<Pair>(int_<1>, stage(1)),
+                make<Pair>(int_<4>, stage(4)),
+                make<Pair>(int_<0>, stage(0)),
+                make<Pair>(int_<2>, stage(2))
+            );
+            auto dependencies = make<Map>(
+                make<Pair>(int_<1>, make<Tuple>(int_<0>)),
+                make<Pair>(int_<2>, make<Tuple>(int_<0>)),
+                make<Pair>(int_<3>, make<Tuple>(int_<1>, int_<2>))
+            );
+
+            for (int repeat = 0; repeat < 20; ++repeat) {
+                clock = 0;
+                auto results = eval_parallel(stages, dependencies);
+                BOOST_HANA_RUNTIME_CHECK(results[int_<2>].first == 2);
+                BOOST_HANA_RUNTIME_CHECK(at(results, int_<0>) < at(results, int_<1>));
+                BOOST_HANA_RUNTIME_CHECK(at(results, int_<0>) < at(results, int_<2>));
+                BOOST_HANA_RUNTIME_CHECK(at(results, int_<1>) < at(results, int_<3>));
+                BOOST_HANA_RUNTIME_CHECK(at(results, int_<2>) < at(results, int_<3>));
+            }
+
+            // without dependencies
+            auto independent = eval_parallel(stages, make<Map>());
+            BOOST_HANA_RUNTIME_CHECK(independent[int_<4>].first == 4);
+            BOOST_HANA_CONSTANT_CHECK(eval_parallel(make<Map>(), make<Map>()) == make<Map>());
+
+            // the stages depending on a failing stage are skipped
+            std::atomic<bool> independent_ran{false}, dependent_ran{false};
+            std::vector<std::string> skipped;
+            try {
+                eval_parallel(
+                    make<Map>(
+                        make<Pair>(type<int>, lazy([&] { dependent_ran = true; return 0; })()),
+                        make<Pair>(type<char>, lazy([]() -> int { throw std::runtime_error{"char"}; })()),
+                        make<Pair>(type<long>, lazy([&] { independent_ran = true; return 0; })())
+                    ),
+                    make<Map>(make<Pair>(type<int>, make<Tuple>(type<char>)))
+                );
+            } catch (parallel_error const& e) {
+                skipped = messages(e);
+            }
+            BOOST_HANA_RUNTIME_CHECK(skipped == (std::vector<std::string>{"", "char", ""}));
+            BOOST_HANA_RUNTIME_CHECK(independent_ran.load());
+            BOOST_HANA_RUNTIME_CHECK(!dependent_ran.load());
+
+            // when several stages fail, all the exceptions are reported
+            std::vector<std::string> whats;
+            try {
+                eval_parallel(
+                    make<Map>(
+                        make<Pair>(type<int>, lazy([]() -> int { throw std::runtime_error{"int"}; })()),
+                        make<Pair>(type<char>, lazy([] { return 0; })()),
+                        make<Pair>(type<long>, lazy([]() -> int { throw std::runtime_error{"long"}; })())
+                    ),
+                    make<Map>()
+                );
+            } catch (parallel_error const& e) {
+                whats = messages(e);
+            }
+            BOOST_HANA_RUNTIME_CHECK(whats == (std::vector<std::string>{"int", "", "long"}));
+        }
+    }
+}
@@ -0,0 +1,86 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/iterable.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/sequence.hpp>
+
+#include <test/seq.hpp>
+using namespace boost::hana;
+
+
+// `test::Seq` is a minimal Sequence, so the algorithms below use the
+// index-based implementations provided for all Sequences.
+int main() {
+    using test::seq;
+    auto lt2 = [](auto x) { return x < int_<2>; };
+
+    // last
+    {
+        BOOST_HANA_CONSTANT_CHECK(equal(last(seq(int_<0>)), int_<0>));
+        BOOST_HANA_CONSTANT_CHECK(equal(last(seq(int_<0>, int_<1>, int_<2>)), int_<2>));
+        BOOST_HANA_CONSTEXPR_CHECK(last(seq(1, '2', 3.5)) == 3.5);
+    }
+
+    // drop.at_most
+    {
+        BOOST_HANA_CONSTANT_CHECK(equal(drop.at_most(seq(), int_<0>), seq()));
+        BOOST_HANA_CONSTANT_CHECK(equal(drop.at_most(seq(), int_<2>), seq()));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            drop.at_most(seq(int_<0>, int_<1>, int_<2>), int_<0>),
+            seq(int_<0>, int_<1>, int_<2>)
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            drop.at_most(seq(int_<0>, int_<1>, int_<2>), int_<2>),
+            seq(int_<2>)
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            drop.at_most(seq(int_<0>, int_<1>, int_<2>), int_<3>),
+            seq()
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            drop.at_most(seq(int_<0>, int_<1>, int_<2>), int_<5>),
+            seq()
+        ));
+        BOOST_HANA_CONSTEXPR_CHECK(equal(drop.at_most(seq(1, '2', 3.5), int_<1>),
+                                         seq('2', 3.5)));
+    }
+
+    // drop_while
+    {
+        BOOST_HANA_CONSTANT_CHECK(equal(drop_while(seq(), lt2), seq()));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            drop_while(seq(int_<2>, int_<0>), lt2),
+            seq(int_<2>, int_<0>)
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            drop_while(seq(int_<0>, int_<1>, int_<2>, int_<0>), lt2),
+            seq(int_<2>, int_<0>)
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            drop_while(seq(int_<0>, int_<1>), lt2),
+            seq()
+        ));
+    }
+
+    // take_while and span
+    {
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            take_while(seq(int_<0>, int_<1>, int_<2>, int_<0>), lt2),
+            seq(int_<0>, int_<1>)
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            span(seq(int_<0>, int_<1>, int_<2>, int_<0>), lt2),
+            make_pair(seq(int_<0>, int_<1>), seq(int_<2>, int_<0>))
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            span(seq(), lt2),
+            make_pair(seq(), seq())
+        ));
+    }
+}
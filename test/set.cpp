@@ -8,8 +8,11 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/assert.hpp>
 #include <boost/hana/core/operators.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/maybe.hpp>
+#include <boost/hana/string.hpp>
 #include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
 
 #include <laws/base.hpp>
 #include <laws/comparable.hpp>
@@ -334,5 +337,132 @@ int main() {
         // laws
         test::TestFoldable<Set>{eqs};
     }
+#elif BOOST_HANA_TEST_PART == 5
+    //////////////////////////////////////////////////////////////////////////
+    // Constant-time lookup of Types, IntegralConstants and Strings
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto xs = set(type<int>, int_<1>, BOOST_HANA_STRING("abc"), char_<'x'>);
+
+        // contains
+        BOOST_HANA_CONSTANT_CHECK(contains(xs, type<int>));
+        BOOST_HANA_CONSTANT_CHECK(contains(xs, int_<1>));
+        BOOST_HANA_CONSTANT_CHECK(contains(xs, long_<1>));
+        BOOST_HANA_CONSTANT_CHECK(contains(xs, BOOST_HANA_STRING("abc")));
+        BOOST_HANA_CONSTANT_CHECK(contains(xs, int_<'x'>));
+        BOOST_HANA_CONSTANT_CHECK(not_(contains(xs, type<int const>)));
+        BOOST_HANA_CONSTANT_CHECK(not_(contains(xs, int_<2>)));
+        BOOST_HANA_CONSTANT_CHECK(not_(contains(xs, BOOST_HANA_STRING("ab"))));
+        BOOST_HANA_CONSTANT_CHECK(contains(set(int_<-1>), long_<-1>));
+        BOOST_HANA_CONSTANT_CHECK(not_(contains(set(), type<int>)));
+
+        // find
+        BOOST_HANA_CONSTANT_CHECK(equal(find(xs, long_<1>), just(int_<1>)));
+        BOOST_HANA_CONSTANT_CHECK(equal(find(xs, type<int>), just(type<int>)));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            find(xs, BOOST_HANA_STRING("abc")),
+            just(BOOST_HANA_STRING("abc"))
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(find(xs, type<char>), nothing));
+
+        // equal
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            xs, set(char_<'x'>, BOOST_HANA_STRING("abc"), long_<1>, type<int>)
+        ));
+        BOOST_HANA_CONSTANT_CHECK(not_(equal(
+            xs, set(char_<'x'>, BOOST_HANA_STRING("abc"), type<int>)
+        )));
+        BOOST_HANA_CONSTANT_CHECK(not_(equal(
+            xs, set(char_<'y'>, BOOST_HANA_STRING("abc"), long_<1>, type<int>)
+        )));
+
+        // is_subset
+        BOOST_HANA_CONSTANT_CHECK(is_subset(set(), xs));
+        BOOST_HANA_CONSTANT_CHECK(is_subset(set(long_<1>, type<int>), xs));
+        BOOST_HANA_CONSTANT_CHECK(is_subset(xs, xs));
+        BOOST_HANA_CONSTANT_CHECK(not_(is_subset(set(int_<2>, type<int>), xs)));
+        BOOST_HANA_CONSTANT_CHECK(not_(is_subset(xs, set(type<int>))));
+
+        // insert
+        BOOST_HANA_CONSTANT_CHECK(equal(insert(xs, long_<1>), xs));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            insert(set(int_<1>), type<int>),
+            set(int_<1>, type<int>)
+        ));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // union_, intersection, difference and symmetric_difference
+    //////////////////////////////////////////////////////////////////////////
+    {
+        // Elements that can only be compared with `equal`
+        BOOST_HANA_CONSTANT_CHECK(equal(union_(set(), set()), set()));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            union_(set(ct_eq<0>{}), set()),
+            set(ct_eq<0>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            union_(set(), set(ct_eq<0>{})),
+            set(ct_eq<0>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            union_(set(ct_eq<0>{}, ct_eq<1>{}), set(ct_eq<1>{}, ct_eq<2>{})),
+            set(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{})
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(equal(intersection(set(), set()), set()));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            intersection(set(ct_eq<0>{}), set()),
+            set()
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            intersection(set(ct_eq<0>{}, ct_eq<1>{}), set(ct_eq<1>{}, ct_eq<2>{})),
+            set(ct_eq<1>{})
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(equal(difference(set(), set()), set()));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            difference(set(ct_eq<0>{}), set()),
+            set(ct_eq<0>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            difference(set(ct_eq<0>{}, ct_eq<1>{}), set(ct_eq<1>{}, ct_eq<2>{})),
+            set(ct_eq<0>{})
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            symmetric_difference(set(), set()),
+            set()
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            symmetric_difference(set(ct_eq<0>{}), set()),
+            set(ct_eq<0>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            symmetric_difference(
+                set(ct_eq<0>{}, ct_eq<1>{}),
+                set(ct_eq<1>{}, ct_eq<2>{})
+            ),
+            set(ct_eq<0>{}, ct_eq<2>{})
+        ));
+
+        // Elements that can be looked up in constant time
+        auto xs = set(type<int>, int_<1>, BOOST_HANA_STRING("abc"));
+        auto ys = set(long_<1>, type<char>);
+
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            union_(xs, ys),
+            set(type<int>, int_<1>, BOOST_HANA_STRING("abc"), type<char>)
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(intersection(xs, ys), set(int_<1>)));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            difference(xs, ys),
+            set(type<int>, BOOST_HANA_STRING("abc"))
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            symmetric_difference(xs, ys),
+            set(type<int>, BOOST_HANA_STRING("abc"), type<char>)
+        ));
+    }
 #endif
 }
@@ -0,0 +1,193 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/detail/std/is_trivially_copyable.hpp>
+#include <boost/hana/detail/struct_layout.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/struct.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+using namespace boost::hana;
+
+
+#define ACCESSOR(NAME)                                                      \
+    make_pair(BOOST_HANA_STRING(#NAME), [](auto&& s) -> decltype(auto) {    \
+        return (static_cast<decltype(s)&&>(s).NAME);                        \
+    })                                                                      \
+/**/
+
+#define OFFSET(TYPE, NAME) boost::hana::size_t<offsetof(TYPE, NAME)>
+
+// Record is laid out like this on all the platforms we care about:
+//  a: [0, 4), b: [4, 6), c: [6, 7), (padding), d: [8, 16), e: [16, 48),
+//  f: [48, 52), (padding)
+struct Record {
+    std::int32_t a;
+    std::int16_t b;
+    char c;
+    double d;
+    std::string e;
+    float f;
+
+    struct hana {
+        struct accessors_impl {
+            static auto apply() {
+                return make_tuple(ACCESSOR(a), ACCESSOR(b), ACCESSOR(c),
+                                  ACCESSOR(d), ACCESSOR(e), ACCESSOR(f));
+            }
+
+            static auto member_offsets() {
+                return [](auto) {
+                    return make_tuple(OFFSET(Record, a), OFFSET(Record, b),
+                                      OFFSET(Record, c), OFFSET(Record, d),
+                                      OFFSET(Record, e), OFFSET(Record, f));
+                };
+            }
+        };
+    };
+};
+
+struct Packed {
+    std::int32_t x, y, z;
+
+    struct hana {
+        struct accessors_impl {
+            static auto apply()
+            { return make_tuple(ACCESSOR(x), ACCESSOR(y), ACCESSOR(z)); }
+
+            static auto member_offsets() {
+                return [](auto) {
+                    return make_tuple(OFFSET(Packed, x), OFFSET(Packed, y),
+                                      OFFSET(Packed, z));
+                };
+            }
+        };
+    };
+};
+
+// The offsets of the members of this one are unknown.
+struct Opaque {
+    char c;
+    std::int32_t i;
+
+    struct hana {
+        struct accessors_impl {
+            static auto apply()
+            { return make_tuple(ACCESSOR(c), ACCESSOR(i)); }
+        };
+    };
+};
+
+// This one lists the same member twice, so its members don't fit in it.
+struct Twice {
+    std::int32_t x;
+
+    struct hana {
+        struct accessors_impl {
+            static auto apply()
+            { return make_tuple(ACCESSOR(x), ACCESSOR(x)); }
+        };
+    };
+};
+
+struct Empty {
+    struct hana {
+        struct accessors_impl {
+            static auto apply() { return make_tuple(); }
+
+            static auto member_offsets()
+            { return [](auto) { return make_tuple(); }; }
+        };
+    };
+};
+
+int main() {
+    // layout
+    {
+        constexpr auto members = layout<Record>();
+        static_assert(members.size() == 6, "");
+
+        static_assert(members[0].offset == offsetof(Record, a), "");
+        static_assert(members[0].size == sizeof(std::int32_t), "");
+        static_assert(members[0].alignment == alignof(std::int32_t), "");
+        static_assert(members[0].trivially_copyable, "");
+
+        static_assert(members[1].offset == offsetof(Record, b), "");
+        static_assert(members[2].offset == offsetof(Record, c), "");
+        static_assert(members[2].size == 1, "");
+        static_assert(members[3].offset == offsetof(Record, d), "");
+        static_assert(members[3].alignment == alignof(double), "");
+
+        static_assert(members[4].offset == offsetof(Record, e), "");
+        static_assert(members[4].size == sizeof(std::string), "");
+        static_assert(!members[4].trivially_copyable, "");
+
+        static_assert(members[5].offset == offsetof(Record, f), "");
+
+        static_assert(layout<Empty>().size() == 0, "");
+    }
+
+    // padding_bytes and is_tightly_packed
+    {
+        BOOST_HANA_CONSTANT_CHECK(padding_bytes<Record>() ==
+            boost::hana::size_t<sizeof(Record) - (4 + 2 + 1 + 8 +
+                                 sizeof(std::string) + 4)>);
+        BOOST_HANA_CONSTANT_CHECK(!is_tightly_packed<Record>());
+
+        BOOST_HANA_CONSTANT_CHECK(padding_bytes<Packed>() == boost::hana::size_t<0>);
+        BOOST_HANA_CONSTANT_CHECK(is_tightly_packed<Packed>());
+
+        // the offsets are not needed for these
+        BOOST_HANA_CONSTANT_CHECK(padding_bytes<Opaque>() ==
+            boost::hana::size_t<sizeof(Opaque) - 5>);
+        BOOST_HANA_CONSTANT_CHECK(!is_tightly_packed<Opaque>());
+
+        // padding_bytes would underflow for these, so it refuses them
+        using Layout = detail::struct_layout_of<
+            Twice, detail::std::is_trivially_copyable>;
+        static_assert(!Layout::fits_in(sizeof(Twice)), "");
+        static_assert(detail::struct_layout_of<
+            Record, detail::std::is_trivially_copyable
+        >::fits_in(sizeof(Record)), "");
+    }
+
+    // contiguous_trivial_runs
+    {
+        constexpr auto runs = contiguous_trivial_runs<Record>();
+        static_assert(runs.size() == 3, "");
+
+        // a, b, c
+        static_assert(runs[0].first == 0, "");
+        static_assert(runs[0].last == 3, "");
+        static_assert(runs[0].offset == 0, "");
+        static_assert(runs[0].size == 7, "");
+
+        // d, on its own because of the padding before it
+        static_assert(runs[1].first == 3, "");
+        static_assert(runs[1].last == 4, "");
+        static_assert(runs[1].offset == offsetof(Record, d), "");
+        static_assert(runs[1].size == sizeof(double), "");
+
+        // f, on its own because e is not trivially copyable
+        static_assert(runs[2].first == 5, "");
+        static_assert(runs[2].last == 6, "");
+        static_assert(runs[2].offset == offsetof(Record, f), "");
+        static_assert(runs[2].size == sizeof(float), "");
+
+        constexpr auto packed = contiguous_trivial_runs<Packed>();
+        static_assert(packed.size() == 1, "");
+        static_assert(packed[0].first == 0 && packed[0].last == 3, "");
+        static_assert(packed[0].size == sizeof(Packed), "");
+
+        static_assert(contiguous_trivial_runs<Empty>().size() == 0, "");
+    }
+}
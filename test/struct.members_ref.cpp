@@ -0,0 +1,175 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/struct.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <string>
+#include <type_traits>
+#include <utility>
+using namespace boost::hana;
+
+
+// Counts the number of times it is copied.
+struct counted {
+    static int copies;
+    int value;
+
+    counted(int v) : value{v} { }
+    counted(counted const& other) : value{other.value} { ++copies; }
+    counted(counted&&) = default;
+    counted& operator=(counted const&) = default;
+    counted& operator=(counted&&) = default;
+};
+int counted::copies = 0;
+
+struct move_only {
+    move_only() = default;
+    move_only(move_only const&) = delete;
+    move_only(move_only&&) = default;
+};
+
+#define ACCESSOR(NAME)                                                      \
+    make_pair(BOOST_HANA_STRING(#NAME), [](auto&& s) -> decltype(auto) {    \
+        return (static_cast<decltype(s)&&>(s).NAME);                        \
+    })                                                                      \
+/**/
+
+struct Person {
+    std::string name;
+    counted age;
+
+    struct hana {
+        struct accessors_impl {
+            static auto apply()
+            { return make_tuple(ACCESSOR(name), ACCESSOR(age)); }
+        };
+    };
+};
+
+struct Holder {
+    move_only m;
+
+    struct hana {
+        struct accessors_impl {
+            static auto apply()
+            { return make_tuple(ACCESSOR(m)); }
+        };
+    };
+};
+
+struct Empty {
+    struct hana {
+        struct accessors_impl {
+            static auto apply() { return make_tuple(); }
+        };
+    };
+};
+
+int main() {
+    // members_ref
+    {
+        Person john{"John", 30};
+        auto refs = members_ref(john);
+        static_assert(std::is_same<
+            decltype(refs), _tuple<std::string&, counted&>
+        >{}, "");
+        BOOST_HANA_RUNTIME_CHECK(&at_c<0>(refs) == &john.name);
+        BOOST_HANA_RUNTIME_CHECK(&at_c<1>(refs) == &john.age);
+
+        Person const& cjohn = john;
+        static_assert(std::is_same<
+            decltype(members_ref(cjohn)),
+            _tuple<std::string const&, counted const&>
+        >{}, "");
+
+        static_assert(std::is_same<
+            decltype(members_ref(std::move(john))),
+            _tuple<std::string&&, counted&&>
+        >{}, "");
+
+        Holder h;
+        auto hrefs = members_ref(h); (void)hrefs;
+
+        Empty e;
+        BOOST_HANA_CONSTANT_CHECK(members_ref(e) == make_tuple());
+    }
+
+    // tie_members
+    {
+        Person john{"John", 30};
+        auto refs = tie_members(john);
+        static_assert(std::is_same<
+            decltype(refs), _tuple<std::string&, counted&>
+        >{}, "");
+        at_c<0>(refs) = "Jane";
+        BOOST_HANA_RUNTIME_CHECK(john.name == "Jane");
+    }
+
+    // unpack, for_each and fold forward references to the members
+    {
+        Person john{"John", 30};
+        counted::copies = 0;
+
+        unpack(john, [&](auto const& name, auto const& age) {
+            BOOST_HANA_RUNTIME_CHECK(&second(name) == &john.name);
+            BOOST_HANA_RUNTIME_CHECK(&second(age) == &john.age);
+        });
+
+        for_each(john, [&](auto&& member) {
+            using Member = std::remove_reference_t<decltype(second(member))>;
+            static_assert(!std::is_const<Member>{}, "");
+            static_assert(std::is_lvalue_reference<
+                decltype(second(member))
+            >{}, "");
+        });
+
+        int total = fold.left(john, 0, [](int n, auto const& member) {
+            return n + static_cast<int>(sizeof(second(member)) > 0);
+        });
+        BOOST_HANA_RUNTIME_CHECK(total == 2);
+
+        for_each(john, [](auto member) {
+            (void)member; // copying the pair only copies references
+        });
+
+        BOOST_HANA_RUNTIME_CHECK(counted::copies == 0);
+    }
+
+    // the members of rvalues are moved, never copied
+    {
+        counted::copies = 0;
+        for_each(Person{"John", 30}, [](auto&& member) {
+            using Pair = std::remove_reference_t<decltype(member)>;
+            static_assert(!std::is_reference<decltype(Pair::second)>{}, "");
+        });
+        BOOST_HANA_RUNTIME_CHECK(counted::copies == 0);
+
+        for_each(Holder{}, [](auto&&) { });
+    }
+
+    // conversions copy the members of lvalues, and never refer to them
+    {
+        Person john{"John", 30};
+        auto map = to<Map>(john);
+        auto tuple = to<Tuple>(john);
+        john.name = "Jane";
+        BOOST_HANA_RUNTIME_CHECK(map[BOOST_HANA_STRING("name")] == "John");
+        BOOST_HANA_RUNTIME_CHECK(map[BOOST_HANA_STRING("age")].value == 30);
+        BOOST_HANA_RUNTIME_CHECK(second(at_c<0>(tuple)) == "John");
+        using Pair = std::remove_reference_t<decltype(at_c<0>(tuple))>;
+        static_assert(!std::is_reference<decltype(Pair::second)>{}, "");
+
+        auto moved = to<Map>(Person{"John", 30});
+        BOOST_HANA_RUNTIME_CHECK(moved[BOOST_HANA_STRING("age")].value == 30);
+    }
+}
@@ -0,0 +1,121 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/struct.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <string>
+#include <type_traits>
+using namespace boost::hana;
+
+
+struct Empty {
+    struct hana {
+        struct accessors_impl {
+            static auto apply() { return make_tuple(); }
+        };
+    };
+};
+
+struct Person {
+    std::string name;
+    int age;
+    double height;
+
+    struct hana {
+        struct accessors_impl {
+            static auto apply() {
+                return make_tuple(
+                    make_pair(string<'n', 'a', 'm', 'e'>, [](auto&& p) -> decltype(auto) {
+                        return (static_cast<decltype(p)&&>(p).name);
+                    }),
+                    make_pair(string<'a', 'g', 'e'>, [](auto&& p) -> decltype(auto) {
+                        return (static_cast<decltype(p)&&>(p).age);
+                    }),
+                    make_pair(string<'h', 'e', 'i', 'g', 'h', 't'>, [](auto&& p) -> decltype(auto) {
+                        return (static_cast<decltype(p)&&>(p).height);
+                    })
+                );
+            }
+        };
+    };
+};
+
+template <typename T>
+struct assign_if {
+    T value;
+    bool* assigned;
+
+    void operator()(T& member) const { member = value; *assigned = true; }
+
+    template <typename U>
+    void operator()(U&) const { }
+};
+
+int main() {
+    // hits, with std::string and char const* names
+    {
+        Person john{"John", 30, 1.80};
+        bool assigned = false;
+        std::string name = "age";
+        BOOST_HANA_RUNTIME_CHECK(visit_member(john, name, assign_if<int>{31, &assigned}));
+        BOOST_HANA_RUNTIME_CHECK(assigned);
+        BOOST_HANA_RUNTIME_CHECK(john.age == 31);
+
+        assigned = false;
+        BOOST_HANA_RUNTIME_CHECK(visit_member(john, "name",
+            assign_if<std::string>{"Jane", &assigned}));
+        BOOST_HANA_RUNTIME_CHECK(assigned);
+        BOOST_HANA_RUNTIME_CHECK(john.name == "Jane");
+
+        char const* height = "height";
+        void const* address = nullptr;
+        BOOST_HANA_RUNTIME_CHECK(visit_member(john, height, [&](auto& member) {
+            address = &member;
+        }));
+        BOOST_HANA_RUNTIME_CHECK(address == &john.height);
+    }
+
+    // misses, including prefixes and names of the wrong length
+    {
+        Person john{"John", 30, 1.80};
+        int calls = 0;
+        auto f = [&](auto&) { ++calls; };
+        BOOST_HANA_RUNTIME_CHECK(!visit_member(john, "", f));
+        BOOST_HANA_RUNTIME_CHECK(!visit_member(john, "ag", f));
+        BOOST_HANA_RUNTIME_CHECK(!visit_member(john, "ages", f));
+        BOOST_HANA_RUNTIME_CHECK(!visit_member(john, "Name", f));
+        BOOST_HANA_RUNTIME_CHECK(!visit_member(john, std::string("foobar"), f));
+        BOOST_HANA_RUNTIME_CHECK(calls == 0);
+    }
+
+    // const and rvalue objects
+    {
+        Person const john{"John", 30, 1.80};
+        bool is_const = false;
+        BOOST_HANA_RUNTIME_CHECK(visit_member(john, "age", [&](auto& member) {
+            is_const = std::is_const<std::remove_reference_t<decltype(member)>>{};
+        }));
+        BOOST_HANA_RUNTIME_CHECK(is_const);
+
+        bool is_rvalue = false;
+        BOOST_HANA_RUNTIME_CHECK(visit_member(Person{"Jane", 25, 1.65}, "name",
+        [&](auto&& member) {
+            is_rvalue = std::is_rvalue_reference<decltype(member)>{};
+        }));
+        BOOST_HANA_RUNTIME_CHECK(is_rvalue);
+    }
+
+    // empty struct
+    {
+        Empty e;
+        BOOST_HANA_RUNTIME_CHECK(!visit_member(e, "anything", [](auto&) { }));
+        BOOST_HANA_RUNTIME_CHECK(!visit_member(e, "", [](auto&) { }));
+    }
+}